@@ -0,0 +1,435 @@
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// CLASS HEADER
+#include "builder-profile.h"
+
+// EXTERNAL INCLUDES
+#include <dali/public-api/render-tasks/render-task-list.h>
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <string_view>
+
+// INTERNAL INCLUDES
+#include "shared/json-reader.h"
+#include "shared/utility.h"
+
+using namespace Dali;
+using DemoHelper::JsonReader;
+using DemoHelper::MillisecondsSince;
+
+namespace
+{
+constexpr uint32_t     SETTLE_MS             = 1000u; ///< Time given to the visuals to load before counting
+constexpr unsigned int MAX_REFERENCE_DEPTH   = 16u;   ///< Templates and styles followed to find the stage nodes using one
+const char* const      DEFINITION_SECTIONS[] = {"templates/", "styles/"};
+
+using Clock = std::chrono::steady_clock;
+
+struct ExpensiveControl
+{
+  const char* type;
+  const char* reason;
+};
+
+const ExpensiveControl EXPENSIVE_CONTROLS[] = {
+  {"SuperBlurView", "blurs its image offscreen, in one render task per blur level"},
+  {"GaussianBlurView", "renders its children offscreen and blurs them in two more passes"},
+  {"BloomView", "renders its children offscreen, then extracts, blurs and composites the bloom"},
+  {"EffectsView", "renders its children offscreen, then blurs them for the drop shadow or emboss"},
+  {"ShadowView", "renders its children again offscreen and blurs the result"},
+  {"Magnifier", "renders the scene again offscreen"},
+};
+
+/**
+ * @return The type and the name of a stage node, e.g. TextLabel "title"
+ */
+std::string DescribeNode(const std::string& node)
+{
+  JsonReader       reader(node.data(), node.size());
+  std::string_view key;
+  std::string      type;
+  std::string      name;
+  if(reader.BeginObject())
+  {
+    while(reader.NextMember(key))
+    {
+      if(key == "type" && reader.Peek() == JsonReader::Type::STRING)
+      {
+        reader.ReadString(type);
+      }
+      else if(key == "name" && reader.Peek() == JsonReader::Type::STRING)
+      {
+        reader.ReadString(name);
+      }
+      else
+      {
+        reader.Skip();
+      }
+    }
+  }
+  return name.empty() ? type : type + " \"" + name + "\"";
+}
+
+/**
+ * @return The template or style a path is in, e.g. templates/button for templates/button/children[0],
+ * or an empty string in the stage section
+ */
+std::string GetDefinition(const std::string& path)
+{
+  for(const char* section : DEFINITION_SECTIONS)
+  {
+    const size_t length = strlen(section);
+    if(path.compare(0u, length, section) == 0)
+    {
+      return path.substr(0u, path.find_first_of("/[", length));
+    }
+  }
+  return std::string();
+}
+
+} // unnamed namespace
+
+BuilderProfile::BuilderProfile(Window window, const std::string& name)
+: mWindow(window),
+  mName(name)
+{
+}
+
+bool BuilderProfile::Run(Toolkit::Builder builder, const std::string& script, Layer layer, std::function<void()> onFinished)
+{
+  mLayer      = layer;
+  mOnFinished = onFinished;
+
+  // Finds the stage nodes and counts the other sections
+  std::vector<std::pair<size_t, size_t>> stageNodes;
+  bool                                   stageRenderTasks = false;
+
+  JsonReader       reader(script.data(), script.size());
+  std::string_view key;
+  if(reader.BeginObject())
+  {
+    while(reader.NextMember(key))
+    {
+      if(key == "stage" && reader.BeginArray())
+      {
+        while(reader.NextElement() && reader.Peek() != JsonReader::Type::INVALID)
+        {
+          const size_t start = reader.GetOffset();
+          const size_t index = stageNodes.size();
+          Lint(reader, script, "stage[" + std::to_string(index) + "]");
+          stageNodes.emplace_back(start, reader.GetOffset());
+        }
+      }
+      else if((key == "templates" || key == "styles") && reader.BeginObject())
+      {
+        // Only instantiated through the stage nodes naming them, which are found when reporting
+        const std::string section(key);
+        std::string_view  name;
+        while(reader.NextMember(name))
+        {
+          Lint(reader, script, section + "/" + std::string(name));
+        }
+      }
+      else if((key == "animations" || key == "constrainers" || key == "renderTasks") && reader.BeginObject())
+      {
+        std::string_view member;
+        unsigned int     count = 0u;
+        while(reader.NextMember(member) && reader.Skip())
+        {
+          stageRenderTasks = stageRenderTasks || (key == "renderTasks" && member == "stage");
+          ++count;
+        }
+        if(key == "animations")
+        {
+          mAnimations = count;
+        }
+        else if(key == "constrainers")
+        {
+          mConstrainers = count;
+        }
+      }
+      else
+      {
+        reader.Skip();
+      }
+    }
+  }
+
+  if(!reader.Finish())
+  {
+    printf("%s: %s at offset %zu\n", mName.c_str(), reader.GetError(), reader.GetErrorOffset());
+    return false;
+  }
+
+  mInitialRenderTasks = mWindow.GetRenderTaskList().GetTaskCount();
+
+  CreateNodes(builder, script, stageNodes);
+
+  // As Builder::AddActors() does for the stage section
+  if(stageRenderTasks)
+  {
+    builder.CreateRenderTask("stage");
+  }
+
+  mTimer = Timer::New(SETTLE_MS);
+  mTimer.TickSignal().Connect(this, &BuilderProfile::OnTimer);
+  mTimer.Start();
+  return true;
+}
+
+void BuilderProfile::Lint(JsonReader& reader, const std::string& script, const std::string& path)
+{
+  std::string_view key;
+  switch(reader.Peek())
+  {
+    case JsonReader::Type::OBJECT:
+    {
+      reader.BeginObject();
+      while(reader.NextMember(key))
+      {
+        if(key == "type" && reader.Peek() == JsonReader::Type::STRING)
+        {
+          std::string type;
+          reader.ReadString(type);
+          for(const auto& control : EXPENSIVE_CONTROLS)
+          {
+            if(type == control.type)
+            {
+              mWarnings.push_back(Warning{path, type + " " + control.reason});
+            }
+          }
+          mUses["templates/" + type].push_back(path);
+        }
+        else if(key == "styles" && reader.Peek() == JsonReader::Type::ARRAY)
+        {
+          reader.BeginArray();
+          while(reader.NextElement())
+          {
+            std::string style;
+            if(reader.Peek() == JsonReader::Type::STRING && reader.ReadString(style))
+            {
+              mUses["styles/" + style].push_back(path);
+            }
+            else if(!reader.Skip())
+            {
+              break;
+            }
+          }
+        }
+        else if(key == "shader" && reader.Peek() == JsonReader::Type::OBJECT)
+        {
+          // The same shader written on several nodes is the same program, but it is still
+          // parsed and set up for each of them
+          const size_t start = reader.GetOffset();
+          reader.Skip();
+          const std::string shader      = script.substr(start, reader.GetOffset() - start);
+          size_t            shaderIndex = 0u;
+          while(shaderIndex < mShaders.size() && mShaders[shaderIndex] != shader)
+          {
+            ++shaderIndex;
+          }
+          if(shaderIndex == mShaders.size())
+          {
+            mShaders.push_back(shader);
+            mShaderPaths.push_back(path);
+            mShaderUses.push_back(0u);
+          }
+          ++mShaderUses[shaderIndex];
+        }
+        else if(key == "signals" && reader.Peek() == JsonReader::Type::ARRAY)
+        {
+          reader.BeginArray();
+          while(reader.NextElement() && reader.Skip())
+          {
+            ++mSignals;
+          }
+        }
+        else
+        {
+          Lint(reader, script, path + "/" + std::string(key));
+        }
+      }
+      break;
+    }
+    case JsonReader::Type::ARRAY:
+    {
+      reader.BeginArray();
+      for(unsigned int index = 0u; reader.NextElement(); ++index)
+      {
+        Lint(reader, script, path + "[" + std::to_string(index) + "]");
+      }
+      break;
+    }
+    default:
+    {
+      reader.Skip();
+      break;
+    }
+  }
+}
+
+void BuilderProfile::FindUses(const std::string& definition, std::vector<std::string>& uses, unsigned int depth) const
+{
+  auto iter = mUses.find(definition);
+  if(iter == mUses.end() || depth >= MAX_REFERENCE_DEPTH)
+  {
+    return;
+  }
+
+  for(const auto& path : iter->second)
+  {
+    const std::string parent = GetDefinition(path);
+    if(!parent.empty())
+    {
+      FindUses(parent, uses, depth + 1u);
+    }
+    else if(std::find(uses.begin(), uses.end(), path) == uses.end())
+    {
+      uses.push_back(path);
+    }
+  }
+}
+
+void BuilderProfile::CreateNodes(Toolkit::Builder& builder, const std::string& script, const std::vector<std::pair<size_t, size_t>>& stageNodes)
+{
+  for(const auto& range : stageNodes)
+  {
+    const std::string json = script.substr(range.first, range.second - range.first);
+
+    Node node;
+    node.name = "stage[" + std::to_string(mNodes.size()) + "] " + DescribeNode(json);
+
+    // Creating the node from its json merges it into the loaded script, so its constants and
+    // styles apply as when the whole stage section is added
+    const Clock::time_point start = Clock::now();
+    node.actor                    = Actor::DownCast(builder.CreateFromJson(json));
+    if(node.actor)
+    {
+      mLayer.Add(node.actor);
+    }
+    node.createMs = MillisecondsSince(start);
+
+    mNodes.push_back(node);
+  }
+}
+
+void BuilderProfile::Count(Actor actor, bool visible, Counts& counts)
+{
+  visible = visible && actor.GetProperty<bool>(Actor::Property::VISIBLE);
+
+  ++counts.actors;
+  counts.renderers += actor.GetRendererCount();
+  counts.visibleRenderers += visible ? actor.GetRendererCount() : 0u;
+
+  for(uint32_t i = 0u, count = actor.GetChildCount(); i < count; ++i)
+  {
+    Count(actor.GetChildAt(i), visible, counts);
+  }
+}
+
+bool BuilderProfile::OnTimer()
+{
+  Report();
+  if(mOnFinished)
+  {
+    mOnFinished();
+  }
+  return false;
+}
+
+void BuilderProfile::Report()
+{
+  printf("Profile of %s\n", mName.c_str());
+  printf("%-44s %10s %8s %10s\n", "Stage node", "Create ms", "Actors", "Renderers");
+
+  float  totalMs = 0.0f;
+  Counts total;
+  for(const auto& node : mNodes)
+  {
+    Counts counts;
+    if(node.actor)
+    {
+      Count(node.actor, true, counts);
+    }
+    printf("%-44s %10.3f %8u %10u%s\n", node.name.c_str(), node.createMs, counts.actors, counts.renderers, node.actor ? "" : " (not an actor)");
+
+    totalMs += node.createMs;
+    total.actors += counts.actors;
+    total.renderers += counts.renderers;
+  }
+  printf("%-44s %10.3f %8u %10u\n", "Total", totalMs, total.actors, total.renderers);
+
+  // Each enabled render task draws the visible renderers under its source actor
+  RenderTaskList taskList  = mWindow.GetRenderTaskList();
+  unsigned int   offscreen = 0u;
+  unsigned int   drawCalls = 0u;
+  const uint32_t taskCount = taskList.GetTaskCount();
+  for(uint32_t i = 0u; i < taskCount; ++i)
+  {
+    RenderTask task = taskList.GetTask(i);
+    offscreen += task.GetFrameBuffer() ? 1u : 0u;
+    if(Actor source = task.GetSourceActor())
+    {
+      Counts counts;
+      Count(source, true, counts);
+      drawCalls += counts.visibleRenderers;
+    }
+  }
+
+  printf("Render tasks: %u added, %u offscreen of %u\n", taskCount - std::min(taskCount, mInitialRenderTasks), offscreen, taskCount);
+  printf("Draw calls: about %u per frame, counting the visible renderers under the source of each render task\n", drawCalls);
+  printf("Script: %u animations, %u constrainers, %u signals, %zu inline shaders\n", mAnimations, mConstrainers, mSignals, mShaders.size());
+
+  for(size_t i = 0u; i < mShaders.size(); ++i)
+  {
+    if(mShaderUses[i] > 1u)
+    {
+      mWarnings.push_back(Warning{mShaderPaths[i], "the same shader is written inline on " + std::to_string(mShaderUses[i]) + " nodes; define it once in a style"});
+    }
+    else
+    {
+      mWarnings.push_back(Warning{mShaderPaths[i], "custom shader, compiled the first time it is drawn"});
+    }
+  }
+
+  if(mWarnings.empty())
+  {
+    printf("No warnings\n");
+  }
+  for(const auto& warning : mWarnings)
+  {
+    std::string       usedBy;
+    const std::string definition = GetDefinition(warning.path);
+    if(!definition.empty())
+    {
+      std::vector<std::string> uses;
+      FindUses(definition, uses, 0u);
+      for(const auto& use : uses)
+      {
+        usedBy += (usedBy.empty() ? "; used by " : ", ") + use;
+      }
+      if(uses.empty())
+      {
+        usedBy = "; not used by the stage";
+      }
+    }
+    printf("Warning: %s: %s%s\n", warning.path.c_str(), warning.message.c_str(), usedBy.c_str());
+  }
+}
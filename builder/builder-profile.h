@@ -0,0 +1,130 @@
+#ifndef DALI_BUILDER_PROFILE_H
+#define DALI_BUILDER_PROFILE_H
+
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// EXTERNAL INCLUDES
+#include <dali-toolkit/devel-api/builder/builder.h>
+#include <dali/public-api/actors/layer.h>
+#include <dali/public-api/adaptor-framework/timer.h>
+#include <dali/public-api/adaptor-framework/window.h>
+#include <dali/public-api/signals/connection-tracker.h>
+#include <functional>
+#include <map>
+#include <string>
+#include <vector>
+
+namespace DemoHelper
+{
+class JsonReader;
+}
+
+/**
+ * @brief Instantiates a builder script one top-level stage node at a time and reports its cost.
+ *
+ * The stage, templates and styles sections are first checked for patterns known to be expensive:
+ *  - controls which render their content offscreen, such as the blur views,
+ *  - shaders defined inline on the nodes rather than once in a style.
+ * A pattern found in a template or a style is reported with the stage nodes using it, through a
+ * "type" naming the template or a "styles" list, possibly via other templates and styles.
+ * Each node of the stage section is then created and added to the layer on its own, to time it.
+ * Once the visuals have had time to load, the actors, renderers, render tasks and an estimate of
+ * the draw calls are counted, and a report is printed.
+ */
+class BuilderProfile : public Dali::ConnectionTracker
+{
+public:
+  /**
+   * @brief Constructor.
+   * @param[in] window The window the script is shown in, whose render tasks are counted.
+   * @param[in] name   The name of the script in the report.
+   */
+  BuilderProfile(Dali::Window window, const std::string& name);
+
+  /**
+   * @brief Profiles a script.
+   * @param[in] builder    The builder the script was loaded into.
+   * @param[in] script     The minified script, which is sliced into its stage nodes.
+   * @param[in] layer      The layer to add the stage nodes to.
+   * @param[in] onFinished Called once the report has been printed.
+   * @return false if the script could not be read.
+   */
+  bool Run(Dali::Toolkit::Builder builder, const std::string& script, Dali::Layer layer, std::function<void()> onFinished);
+
+private:
+  struct Node
+  {
+    std::string name;
+    Dali::Actor actor;
+    float       createMs{0.0f};
+  };
+
+  struct Warning
+  {
+    std::string path; ///< Where the pattern is in the script, e.g. stage[0]/children[1]
+    std::string message;
+  };
+
+  struct Counts
+  {
+    unsigned int actors{0u};
+    unsigned int renderers{0u};
+    unsigned int visibleRenderers{0u}; ///< On actors which are visible, as are all their parents
+  };
+
+  /**
+   * @brief Looks for expensive patterns in a value of the stage, templates or styles sections, and its
+   * children, and records the templates and styles it uses.
+   */
+  void Lint(DemoHelper::JsonReader& reader, const std::string& script, const std::string& path);
+
+  /**
+   * @brief Adds the paths in the stage section which use a template or a style, directly or not.
+   * @param[in]  definition The template or style, e.g. templates/button
+   * @param[out] uses       The paths of the stage nodes using it
+   * @param[in]  depth      Number of templates and styles followed so far, which bounds the recursion
+   */
+  void FindUses(const std::string& definition, std::vector<std::string>& uses, unsigned int depth) const;
+
+  void CreateNodes(Dali::Toolkit::Builder& builder, const std::string& script, const std::vector<std::pair<size_t, size_t>>& stageNodes);
+
+  static void Count(Dali::Actor actor, bool visible, Counts& counts);
+
+  bool OnTimer();
+
+  void Report();
+
+private:
+  Dali::Window                                    mWindow;
+  std::string                                     mName;
+  Dali::Layer                                     mLayer;
+  Dali::Timer                                     mTimer;
+  std::function<void()>                           mOnFinished;
+  std::vector<Node>                               mNodes;
+  std::vector<Warning>                            mWarnings;
+  std::vector<std::string>                        mShaders;     ///< Inline shaders, as written in the script
+  std::vector<std::string>                        mShaderPaths; ///< Where each shader was first defined
+  std::vector<unsigned int>                       mShaderUses;
+  std::map<std::string, std::vector<std::string>> mUses; ///< Paths naming each template or style, by definition
+  unsigned int                                    mAnimations{0u};
+  unsigned int                                    mConstrainers{0u};
+  unsigned int                                    mSignals{0u};
+  unsigned int                                    mInitialRenderTasks{0u};
+};
+
+#endif // DALI_BUILDER_PROFILE_H
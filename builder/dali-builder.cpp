@@ -24,6 +24,19 @@
 //
 //       and edit layout.json in a text editor saving to trigger the reload
 //
+//  - precompiles scripts into the cache of the builder launcher, see shared/builder-script-cache.h
+//    ie run
+//       builder-run --precompile *.json
+//
+//       to fill the cache and compare the cold (text) and warm (cached) load times
+//
+//  - profiles a script, see builder-profile.h
+//    ie run
+//       builder-run --profile layout.json
+//
+//       to time the creation of each stage node, count the actors, renderers and render tasks,
+//       and warn about expensive patterns such as blur views and inline shaders
+//
 //------------------------------------------------------------------------------
 
 #include <dali-toolkit/dali-toolkit.h>
@@ -31,24 +44,37 @@
 #include <dali-toolkit/devel-api/builder/tree-node.h>
 #include <dali/dali.h>
 #include <dali/devel-api/adaptor-framework/file-loader.h>
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
 #include <fstream>
 #include <iostream>
 #include <map>
+#include <memory>
 #include <streambuf>
 #include <string>
+#include <vector>
 
 #include <ctime>
 #include "sys/stat.h"
 
 #include <dali/integration-api/debug.h>
+#include "builder-profile.h"
+#include "shared/builder-script-cache.h"
+#include "shared/utility.h"
 
 #define TOKEN_STRING(x) #x
 
 using namespace Dali;
 using namespace Dali::Toolkit;
+using DemoHelper::MillisecondsSince;
 
 namespace
 {
+const unsigned int PRECOMPILE_ITERATIONS = 20u; ///< Loads of each script averaged by --precompile
+
+using Clock = std::chrono::steady_clock;
+
 std::string JSON_BROKEN(
   "                                      \
 {                                                              \
@@ -176,7 +202,8 @@ class ExampleApp : public ConnectionTracker
 {
 public:
   ExampleApp(Application& app)
-  : mApp(app)
+  : mApp(app),
+    mCacheDirectory(BuilderScript::Cache::GetDefaultDirectory())
   {
     app.InitSignal().Connect(this, &ExampleApp::Create);
   }
@@ -191,8 +218,45 @@ public:
     fw.SetFilename(fn);
   };
 
+  /**
+   * Sets where the compiled scripts are kept, or an empty directory to parse the text every time
+   */
+  void SetCacheDirectory(const std::string& directory)
+  {
+    mCacheDirectory = directory;
+  }
+
+  /**
+   * Compiles the scripts into the cache and measures their load times instead of showing one
+   */
+  void SetPrecompileFilenames(const std::vector<std::string>& filenames)
+  {
+    mPrecompileFilenames = filenames;
+  }
+
+  /**
+   * Profiles the script and quits instead of watching it
+   */
+  void SetProfile(bool profile)
+  {
+    mProfiling = profile;
+  }
+
   void Create(Application& app)
   {
+    if(!mPrecompileFilenames.empty())
+    {
+      Precompile();
+      app.Quit();
+      return;
+    }
+
+    if(mProfiling)
+    {
+      Profile();
+      return;
+    }
+
     mTimer = Timer::New(500); // ms
     mTimer.TickSignal().Connect(this, &ExampleApp::OnTimer);
     mTimer.Start();
@@ -208,12 +272,26 @@ private:
   FileWatcher fw;
   Timer       mTimer;
 
-  void ReloadJsonFile(Builder& builder, Layer& layer)
+  std::string                     mCacheDirectory; ///< Created by --precompile and --profile only
+  std::vector<std::string>        mPrecompileFilenames;
+  std::unique_ptr<BuilderProfile> mProfile;
+  bool                            mProfiling{false};
+
+  Layer NewLayer()
   {
     Window window = mApp.GetWindow();
-    window.SetBackgroundColor(Color::WHITE);
 
-    builder = Builder::New();
+    Layer layer = Layer::New();
+    layer.SetProperty(Actor::Property::PARENT_ORIGIN, ParentOrigin::CENTER);
+    layer.SetProperty(Actor::Property::ANCHOR_POINT, AnchorPoint::CENTER);
+    layer.SetProperty(Actor::Property::SIZE, window.GetRootLayer().GetCurrentProperty<Vector3>(Actor::Property::SIZE));
+    window.GetRootLayer().Add(layer);
+    return layer;
+  }
+
+  Builder NewBuilder()
+  {
+    Builder builder = Builder::New();
     builder.QuitSignal().Connect(this, &ExampleApp::OnBuilderQuit);
 
     Property::Map defaultDirs;
@@ -222,14 +300,113 @@ private:
     defaultDirs[TOKEN_STRING(DEMO_SCRIPT_DIR)] = DEMO_SCRIPT_DIR;
 
     builder.AddConstants(defaultDirs);
+    return builder;
+  }
+
+  /**
+   * Average time to read a script and load it into a new builder, from the text or from the cache if given
+   */
+  float MeasureLoad(const std::string& filename, const BuilderScript::Cache* cache)
+  {
+    const Clock::time_point start = Clock::now();
+    for(unsigned int i = 0; i < PRECOMPILE_ITERATIONS; ++i)
+    {
+      std::string text(FileWatcher(filename).GetFileContents());
+      if(cache)
+      {
+        BuilderScript::Script script;
+        cache->Load(text, script);
+        text.swap(script.text);
+      }
+
+      Builder builder = NewBuilder();
+      builder.LoadFromString(text);
+    }
+    return MillisecondsSince(start) / PRECOMPILE_ITERATIONS;
+  }
+
+  void Precompile()
+  {
+    const BuilderScript::Cache cache(mCacheDirectory);
+    if(cache.GetDirectory().empty())
+    {
+      std::cout << "No cache directory to precompile into" << std::endl;
+      return;
+    }
+
+    printf("Cache: %s\n", cache.GetDirectory().c_str());
+    printf("%-28s %8s %6s %10s %10s %9s\n", "Script", "KB", "Nodes", "Cold ms", "Warm ms", "Speed-up");
+
+    for(const auto& filename : mPrecompileFilenames)
+    {
+      const std::string     name = filename.substr(filename.rfind('/') + 1u);
+      const std::string     source(FileWatcher(filename).GetFileContents());
+      BuilderScript::Script script;
+      if(source.empty() || !cache.Load(source, script))
+      {
+        printf("%-28s not compiled: %s\n", name.c_str(), source.empty() ? "could not be read" : script.error.c_str());
+        continue;
+      }
+
+      try
+      {
+        const float coldMs = MeasureLoad(filename, nullptr);
+        const float warmMs = MeasureLoad(filename, &cache);
+        printf("%-28s %8.1f %6u %10.3f %10.3f %8.2fx\n", name.c_str(), source.size() / 1024.0f, script.stageNodes, coldMs, warmMs, coldMs / std::max(warmMs, 0.001f));
+      }
+      catch(...)
+      {
+        printf("%-28s compiled, but Builder could not load it\n", name.c_str());
+      }
+    }
+    printf("Cold: reading and loading the text. Warm: reading, hashing and loading the cached script.\n"
+           "Times averaged over %u loads into a new Builder.\n",
+           PRECOMPILE_ITERATIONS);
+  }
+
+  void Profile()
+  {
+    const BuilderScript::Cache cache(mCacheDirectory);
+    BuilderScript::Script      script;
+    if(!cache.Load(fw.GetFileContents(), script))
+    {
+      std::cout << "Parser Error:" << fw.GetFilename() << " " << script.error << std::endl;
+      mApp.Quit();
+      return;
+    }
+
+    mApp.GetWindow().SetBackgroundColor(Color::WHITE);
+    mRootLayer = NewLayer();
+    mBuilder   = NewBuilder();
+
+    try
+    {
+      mBuilder.LoadFromString(script.text);
+    }
+    catch(...)
+    {
+      std::cout << "Builder could not load " << fw.GetFilename() << std::endl;
+      mApp.Quit();
+      return;
+    }
+
+    mProfile = std::make_unique<BuilderProfile>(mApp.GetWindow(), fw.GetFilename());
+    if(!mProfile->Run(mBuilder, script.text, mRootLayer, [this]() { mApp.Quit(); }))
+    {
+      mApp.Quit();
+    }
+  }
+
+  void ReloadJsonFile(Builder& builder, Layer& layer)
+  {
+    Window window = mApp.GetWindow();
+    window.SetBackgroundColor(Color::WHITE);
+
+    builder = NewBuilder();
 
     if(!layer)
     {
-      layer = Layer::New();
-      layer.SetProperty(Actor::Property::PARENT_ORIGIN, ParentOrigin::CENTER);
-      layer.SetProperty(Actor::Property::ANCHOR_POINT, AnchorPoint::CENTER);
-      layer.SetProperty(Actor::Property::SIZE, window.GetRootLayer().GetCurrentProperty<Vector3>(Actor::Property::SIZE));
-      window.GetRootLayer().Add(layer);
+      layer = NewLayer();
 
       // render tasks may have been setup last load so remove them
       RenderTaskList taskList = window.GetRenderTaskList();
@@ -262,6 +439,10 @@ private:
       layer.Remove(layer.GetChildAt(0));
     }
 
+    // Each save changes the script, so the cache would only parse it twice and keep every version:
+    // the text is loaded as is
+    const Clock::time_point start = Clock::now();
+
     std::string data(fw.GetFileContents());
 
     try
@@ -273,6 +454,8 @@ private:
       builder.LoadFromString(ReplaceQuotes(JSON_BROKEN));
     }
 
+    std::cout << "Loaded " << fw.GetFilename() << " in " << MillisecondsSince(start) << "ms" << std::endl;
+
     builder.AddActors(layer);
   }
 
@@ -316,14 +499,53 @@ int DALI_EXPORT_API main(int argc, char** argv)
   Application dali_app = Application::New(&argc, &argv, DEMO_THEME_PATH);
   ExampleApp  app(dali_app);
 
-  if(argc > 1)
+  bool                     precompile = false;
+  std::vector<std::string> filenames;
+  for(int i = 1; i < argc; ++i)
+  {
+    std::string arg(argv[i]);
+    if(arg.compare("--precompile") == 0)
+    {
+      precompile = true;
+    }
+    else if(arg.compare("--profile") == 0)
+    {
+      app.SetProfile(true);
+    }
+    else if(arg.compare("--cache") == 0 && i + 1 < argc)
+    {
+      app.SetCacheDirectory(argv[++i]);
+    }
+    else if(arg.compare("--no-cache") == 0)
+    {
+      app.SetCacheDirectory(std::string());
+    }
+    else if(arg.compare("-h") == 0 || arg.compare("--help") == 0)
+    {
+      std::cout << "usage: " << argv[0] << " <script.json>" << std::endl;
+      std::cout << "       " << argv[0] << " --profile [--cache <dir> | --no-cache] <script.json>" << std::endl;
+      std::cout << "       " << argv[0] << " --precompile [--cache <dir>] <script.json>..." << std::endl;
+      std::cout << "The cache defaults to $DALI_BUILDER_CACHE_DIR, or dali-builder in $XDG_CACHE_HOME or ~/.cache" << std::endl;
+      return 0;
+    }
+    else
+    {
+      filenames.push_back(arg);
+    }
+  }
+
+  if(filenames.empty())
+  {
+    DALI_ASSERT_ALWAYS(!"Specify JSON file on command line\n");
+  }
+  else if(precompile)
   {
-    std::cout << "Loading file:" << argc << " " << argv[1] << std::endl;
-    app.SetJSONFilename(argv[1]);
+    app.SetPrecompileFilenames(filenames);
   }
   else
   {
-    DALI_ASSERT_ALWAYS(!"Specify JSON file on command line\n");
+    std::cout << "Loading file:" << filenames.size() << " " << filenames[0] << std::endl;
+    app.SetJSONFilename(filenames[0]);
   }
 
   dali_app.MainLoop();
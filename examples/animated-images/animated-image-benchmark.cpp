@@ -0,0 +1,340 @@
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include "animated-image-benchmark.h"
+
+#include <dali-toolkit/devel-api/controls/control-devel.h>
+#include <dali-toolkit/devel-api/visual-factory/visual-base.h>
+#include <dali-toolkit/devel-api/visuals/image-visual-properties-devel.h>
+#include <dali-toolkit/devel-api/visuals/visual-properties-devel.h>
+#include <dali-toolkit/public-api/controls/control-impl.h>
+#include <dali/devel-api/adaptor-framework/animated-image-loading.h>
+#include <dali/devel-api/adaptor-framework/image-loading.h>
+#include <unistd.h>
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+
+// INTERNAL INCLUDES
+#include "shared/utility.h"
+
+using namespace Dali;
+using namespace Dali::Toolkit;
+using DemoHelper::MillisecondsSince;
+
+namespace
+{
+constexpr uint32_t SAMPLE_INTERVAL_MS = 50u;     ///< Short enough that no view loops between two samples
+constexpr float    WARM_UP_MS         = 1000.0f; ///< Lets the caches fill before measuring
+constexpr float    MEASURE_MS         = 5000.0f;
+constexpr float    SETTLE_MS          = 500.0f;  ///< Lets the destroyed views release their frames
+
+const char* const THREAD_POOL_SIZE_ENV     = "DALI_ASYNC_MANAGER_THREAD_POOL_SIZE"; ///< Decode threads of the adaptor
+constexpr int     DEFAULT_THREAD_POOL_SIZE = 8;
+
+using Clock = std::chrono::steady_clock;
+
+/**
+ * @return The resident set size of the process in KB, or 0 if unknown
+ */
+long GetResidentKB()
+{
+  std::ifstream statm("/proc/self/statm");
+  long          size = 0, resident = 0;
+  if(statm >> size >> resident)
+  {
+    return resident * (sysconf(_SC_PAGESIZE) / 1024);
+  }
+  return 0;
+}
+
+int GetDecodeThreadCount()
+{
+  const char* value = std::getenv(THREAD_POOL_SIZE_ENV);
+  return value ? std::max(1, atoi(value)) : DEFAULT_THREAD_POOL_SIZE;
+}
+
+} // namespace
+
+AnimatedImageBenchmark::AnimatedImageBenchmark(Window window, const std::vector<Property::Value>& sources, int viewCount, const std::vector<FrameCacheConfig>& configs)
+: mWindow(window),
+  mSources(sources),
+  mConfigs(configs),
+  mViewCount(viewCount)
+{
+}
+
+AnimatedImageBenchmark::~AnimatedImageBenchmark()
+{
+  UnparentAndReset(mGrid);
+  UnparentAndReset(mStatus);
+}
+
+void AnimatedImageBenchmark::Start()
+{
+  mStatus = TextLabel::New("Decoding the images");
+  mStatus.SetProperty(TextLabel::Property::MULTI_LINE, true);
+  mStatus.SetProperty(TextLabel::Property::POINT_SIZE, 7.0f);
+  mStatus.SetProperty(TextLabel::Property::FONT_FAMILY, "Monospace");
+  mStatus.SetResizePolicy(ResizePolicy::FILL_TO_PARENT, Dimension::WIDTH);
+  mStatus.SetResizePolicy(ResizePolicy::DIMENSION_DEPENDENCY, Dimension::HEIGHT);
+  mStatus.SetProperty(Actor::Property::PARENT_ORIGIN, ParentOrigin::TOP_CENTER);
+  mStatus.SetProperty(Actor::Property::ANCHOR_POINT, AnchorPoint::TOP_CENTER);
+  mWindow.Add(mStatus);
+
+  // The timer samples the frame rate and moves through the phases. The sources are measured on
+  // its first tick, once the status has been sent for rendering, as the decoding blocks this thread.
+  mTimer = Timer::New(SAMPLE_INTERVAL_MS);
+  mTimer.TickSignal().Connect(this, &AnimatedImageBenchmark::OnTimer);
+  mTimer.Start();
+  SetPhase(Phase::MEASURE_SOURCES);
+}
+
+void AnimatedImageBenchmark::MeasureSources()
+{
+  for(const auto& source : mSources)
+  {
+    SourceInfo info;
+    float      decodeMs = 0.0f;
+
+    const Property::Array* frameUrls = source.GetArray();
+    if(frameUrls)
+    {
+      info.frameCount = static_cast<int>(frameUrls->Count());
+      for(int i = 0; i < info.frameCount; ++i)
+      {
+        const auto               start  = Clock::now();
+        Dali::Devel::PixelBuffer buffer = Dali::LoadImageFromFile((*frameUrls)[i].Get<std::string>());
+        decodeMs += MillisecondsSince(start);
+        if(buffer)
+        {
+          info.frameBytes = static_cast<size_t>(buffer.GetWidth()) * buffer.GetHeight() * Pixel::GetBytesPerPixel(buffer.GetPixelFormat());
+        }
+      }
+    }
+    else
+    {
+      AnimatedImageLoading loading  = AnimatedImageLoading::New(source.Get<std::string>(), true);
+      uint32_t             interval = 0u;
+      info.frameCount               = loading ? static_cast<int>(loading.GetImageCount()) : 0;
+      for(int i = 0; i < info.frameCount; ++i)
+      {
+        const auto               start  = Clock::now();
+        Dali::Devel::PixelBuffer buffer = loading.LoadFrame(i);
+        decodeMs += MillisecondsSince(start);
+        interval += loading.GetFrameInterval(i);
+        if(buffer)
+        {
+          info.frameBytes = static_cast<size_t>(buffer.GetWidth()) * buffer.GetHeight() * Pixel::GetBytesPerPixel(buffer.GetPixelFormat());
+        }
+      }
+      info.meanFrameIntervalMs = info.frameCount > 0 ? static_cast<float>(interval) / info.frameCount : 0.0f;
+    }
+
+    info.decodeMsPerFrame = info.frameCount > 0 ? decodeMs / info.frameCount : 0.0f;
+    mSourceInfos.push_back(info);
+  }
+}
+
+void AnimatedImageBenchmark::StartConfig()
+{
+  const FrameCacheConfig& config = mConfigs[mConfigIndex];
+
+  std::ostringstream status;
+  status << "Configuration " << mConfigIndex + 1u << "/" << mConfigs.size() << ": batch " << config.batchSize << ", cache "
+         << config.cacheSize << ", " << mViewCount << " views";
+  mStatus.SetProperty(TextLabel::Property::TEXT, status.str());
+
+  mResidentBaselineKB = GetResidentKB();
+
+  const Vector2 windowSize = mWindow.GetSize();
+  const float   top        = windowSize.height * 0.1f;
+  const int     columns    = static_cast<int>(std::ceil(std::sqrt(static_cast<float>(mViewCount))));
+  const int     rows       = (mViewCount + columns - 1) / columns;
+  const Vector2 cellSize(windowSize.width / columns, (windowSize.height - top) / rows);
+
+  mGrid = Actor::New();
+  mGrid.SetProperty(Actor::Property::PARENT_ORIGIN, ParentOrigin::TOP_LEFT);
+  mGrid.SetProperty(Actor::Property::ANCHOR_POINT, AnchorPoint::TOP_LEFT);
+  mGrid.SetProperty(Actor::Property::POSITION, Vector2(0.0f, top));
+  mWindow.Add(mGrid);
+
+  for(int i = 0; i < mViewCount; ++i)
+  {
+    View view;
+    view.source = i % mSources.size();
+
+    Property::Map map;
+    map.Add(ImageVisual::Property::URL, mSources[view.source])
+      .Add(ImageVisual::Property::BATCH_SIZE, config.batchSize)
+      .Add(ImageVisual::Property::CACHE_SIZE, config.cacheSize)
+      .Add(ImageVisual::Property::FRAME_DELAY, config.frameDelay)
+      .Add(DevelVisual::Property::VISUAL_FITTING_MODE, DevelVisual::FIT_KEEP_ASPECT_RATIO);
+
+    view.imageView = ImageView::New();
+    view.imageView.SetProperty(ImageView::Property::IMAGE, map);
+    view.imageView.SetProperty(Actor::Property::PARENT_ORIGIN, ParentOrigin::TOP_LEFT);
+    view.imageView.SetProperty(Actor::Property::ANCHOR_POINT, AnchorPoint::CENTER);
+    view.imageView.SetProperty(Actor::Property::POSITION, Vector2(cellSize.width * (i % columns + 0.5f), cellSize.height * (i / columns + 0.5f)));
+    view.imageView.SetProperty(Actor::Property::SIZE, cellSize);
+    mGrid.Add(view.imageView);
+    mViews.push_back(view);
+  }
+
+  SetPhase(Phase::WARM_UP);
+}
+
+void AnimatedImageBenchmark::Sample()
+{
+  for(auto& view : mViews)
+  {
+    const int frame      = GetCurrentFrame(view.imageView);
+    const int frameCount = mSourceInfos[view.source].frameCount;
+    if(frame >= 0 && view.lastFrame >= 0 && frameCount > 0)
+    {
+      view.framesShown += (frame - view.lastFrame + frameCount) % frameCount;
+    }
+    view.lastFrame = frame;
+  }
+}
+
+void AnimatedImageBenchmark::FinishConfig()
+{
+  const FrameCacheConfig& config    = mConfigs[mConfigIndex];
+  const float             elapsedMs = MillisecondsSince(mPhaseStart);
+
+  Result result;
+  result.config           = config;
+  result.residentGrowthKB = GetResidentKB() - mResidentBaselineKB;
+
+  float framesShown = 0.0f;
+  float framesDue   = 0.0f;
+  float decodeMs    = 0.0f;
+  for(const auto& view : mViews)
+  {
+    const SourceInfo& info     = mSourceInfos[view.source];
+    const float       interval = info.meanFrameIntervalMs > 0.0f ? info.meanFrameIntervalMs : static_cast<float>(config.frameDelay);
+
+    framesShown += view.framesShown;
+    framesDue += elapsedMs / interval;
+
+    // Once warm, a cache holding all the frames doesn't load any more; otherwise each frame shown has been loaded.
+    if(config.cacheSize < info.frameCount)
+    {
+      decodeMs += view.framesShown * info.decodeMsPerFrame;
+    }
+    result.cachedFramesKB += std::min(config.cacheSize, info.frameCount) * info.frameBytes / 1024u;
+  }
+  result.frameDropRate     = framesDue > 0.0f ? std::max(0.0f, 1.0f - framesShown / framesDue) : 0.0f;
+  result.decodeUtilisation = decodeMs / (elapsedMs * GetDecodeThreadCount());
+  mResults.push_back(result);
+
+  mViews.clear();
+  UnparentAndReset(mGrid);
+}
+
+void AnimatedImageBenchmark::ReportResults()
+{
+  std::ostringstream table;
+  table << std::fixed << std::setprecision(1);
+  table << mViewCount << " views, " << GetDecodeThreadCount() << " decode threads\n";
+  table << std::setw(6) << "Batch" << std::setw(6) << "Cache" << std::setw(9) << "Drop %" << std::setw(9) << "Decode %"
+        << std::setw(11) << "RSS +KB" << std::setw(11) << "Frames KB\n";
+  for(const auto& result : mResults)
+  {
+    table << std::setw(6) << result.config.batchSize << std::setw(6) << result.config.cacheSize << std::setw(9)
+          << result.frameDropRate * 100.0f << std::setw(9) << result.decodeUtilisation * 100.0f << std::setw(11)
+          << result.residentGrowthKB << std::setw(11) << result.cachedFramesKB << "\n";
+  }
+  table << "Decode %: estimated busy time of the decode threads. Frames KB: estimated size of the cached frames.";
+
+  std::cout << table.str() << std::endl;
+  mStatus.SetProperty(TextLabel::Property::TEXT, table.str());
+}
+
+bool AnimatedImageBenchmark::OnTimer()
+{
+  switch(mPhase)
+  {
+    case Phase::MEASURE_SOURCES:
+    {
+      MeasureSources();
+      StartConfig();
+      break;
+    }
+    case Phase::WARM_UP:
+    {
+      if(MillisecondsSince(mPhaseStart) >= WARM_UP_MS)
+      {
+        Sample(); // Only sets the frame each view starts from
+        SetPhase(Phase::MEASURE);
+      }
+      break;
+    }
+    case Phase::MEASURE:
+    {
+      Sample();
+      if(MillisecondsSince(mPhaseStart) >= MEASURE_MS)
+      {
+        FinishConfig();
+        SetPhase(Phase::SETTLE);
+      }
+      break;
+    }
+    case Phase::SETTLE:
+    {
+      if(MillisecondsSince(mPhaseStart) >= SETTLE_MS)
+      {
+        if(++mConfigIndex < mConfigs.size())
+        {
+          StartConfig();
+        }
+        else
+        {
+          ReportResults();
+          return false;
+        }
+      }
+      break;
+    }
+  }
+  return true;
+}
+
+int AnimatedImageBenchmark::GetCurrentFrame(ImageView& imageView) const
+{
+  Visual::Base visual = DevelControl::GetVisual(Toolkit::Internal::GetImplementation(imageView), ImageView::Property::IMAGE);
+  if(!visual)
+  {
+    return -1;
+  }
+
+  Property::Map map;
+  visual.CreatePropertyMap(map);
+  const Property::Value* frame = map.Find(DevelImageVisual::Property::CURRENT_FRAME_NUMBER);
+  return frame ? frame->Get<int>() : -1;
+}
+
+void AnimatedImageBenchmark::SetPhase(Phase phase)
+{
+  mPhase      = phase;
+  mPhaseStart = Clock::now();
+}
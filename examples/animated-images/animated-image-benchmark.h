@@ -0,0 +1,143 @@
+#ifndef DALI_DEMO_ANIMATED_IMAGE_BENCHMARK_H
+#define DALI_DEMO_ANIMATED_IMAGE_BENCHMARK_H
+
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <dali-toolkit/dali-toolkit.h>
+#include <dali/dali.h>
+#include <chrono>
+#include <vector>
+
+/**
+ * @brief Frame cache settings of an animated image visual.
+ */
+struct FrameCacheConfig
+{
+  int batchSize;  ///< Number of frames loaded at once
+  int cacheSize;  ///< Number of frames kept loaded
+  int frameDelay; ///< Delay between the frames of an image array, in milliseconds
+};
+
+/**
+ * @brief Plays many animated images at once for each of a set of frame cache configurations.
+ *
+ * The views alternate between the given sources, animated image files and image arrays, and are laid out in a grid.
+ * For each configuration, after a warm up, the frame number of every view is sampled for a few seconds, then the
+ * views are destroyed before the next configuration. A table is logged and shown at the end, with:
+ *  - the frame drop rate, from the frames shown against the frames due given the frame delays,
+ *  - the estimated utilisation of the decode threads, from the frames shown which the cache had to load and the
+ *    decode time of each frame, measured synchronously beforehand,
+ *  - the growth of the resident memory and the estimated size of the cached frames.
+ */
+class AnimatedImageBenchmark : public Dali::ConnectionTracker
+{
+public:
+  /**
+   * @param[in] window The window the views are added to
+   * @param[in] sources The images played, each the URL of an animated image file or an array of frame URLs
+   * @param[in] viewCount The number of views playing at once
+   * @param[in] configs The frame cache configurations measured, in order
+   */
+  AnimatedImageBenchmark(Dali::Window window, const std::vector<Dali::Property::Value>& sources, int viewCount, const std::vector<FrameCacheConfig>& configs);
+
+  ~AnimatedImageBenchmark();
+
+  /**
+   * @brief Runs all the configurations.
+   */
+  void Start();
+
+private:
+  enum class Phase
+  {
+    MEASURE_SOURCES,
+    WARM_UP,
+    MEASURE,
+    SETTLE
+  };
+
+  struct SourceInfo
+  {
+    int    frameCount{0};
+    float  meanFrameIntervalMs{0.0f}; ///< Zero for image arrays, which use the frame delay of the configuration
+    float  decodeMsPerFrame{0.0f};
+    size_t frameBytes{0u}; ///< Decoded size of a frame
+  };
+
+  struct View
+  {
+    Dali::Toolkit::ImageView imageView;
+    size_t                   source;
+    int                      lastFrame{-1};
+    uint64_t                 framesShown{0u};
+  };
+
+  struct Result
+  {
+    FrameCacheConfig config;
+    float            frameDropRate{0.0f};
+    float            decodeUtilisation{0.0f};
+    long             residentGrowthKB{0};
+    size_t           cachedFramesKB{0u};
+  };
+
+  /**
+   * @brief Decodes every frame of every source once, which also warms up the file cache.
+   */
+  void MeasureSources();
+
+  void StartConfig();
+
+  /**
+   * @brief Counts the frames each view has moved on by since the last sample.
+   */
+  void Sample();
+
+  /**
+   * @brief Computes the result of the current configuration and destroys its views.
+   */
+  void FinishConfig();
+
+  void ReportResults();
+
+  bool OnTimer();
+
+  int GetCurrentFrame(Dali::Toolkit::ImageView& imageView) const;
+
+  void SetPhase(Phase phase);
+
+private:
+  Dali::Window                       mWindow;
+  std::vector<Dali::Property::Value> mSources;
+  std::vector<SourceInfo>            mSourceInfos;
+  std::vector<FrameCacheConfig>      mConfigs;
+  std::vector<Result>                mResults;
+  std::vector<View>                  mViews;
+  int                                mViewCount;
+
+  Dali::Actor              mGrid;
+  Dali::Toolkit::TextLabel mStatus;
+  Dali::Timer              mTimer;
+
+  Phase                                 mPhase{Phase::MEASURE_SOURCES};
+  std::chrono::steady_clock::time_point mPhaseStart;
+  size_t                                mConfigIndex{0u};
+  long                                  mResidentBaselineKB{0};
+};
+
+#endif // DALI_DEMO_ANIMATED_IMAGE_BENCHMARK_H
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2022 Samsung Electronics Co., Ltd.
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -20,6 +20,9 @@
 #include <dali-toolkit/devel-api/controls/table-view/table-view.h>
 #include <dali-toolkit/devel-api/visuals/animated-image-visual-actions-devel.h>
 #include <dali-toolkit/devel-api/visuals/visual-properties-devel.h>
+#include <iostream>
+#include <memory>
+#include "animated-image-benchmark.h"
 
 using namespace Dali;
 using namespace Dali::Toolkit;
@@ -47,6 +50,20 @@ int ANIMATED_ARRAY_NUMBER_OF_FRAMES[ANIMATED_IMAGE_COUNT] =
     8,
     15};
 
+const FrameCacheConfig DEFAULT_FRAME_CACHE = {4, 10, 150};
+
+/// Frame cache configurations swept by the benchmark, from the lightest to the heaviest
+const std::vector<FrameCacheConfig> BENCHMARK_FRAME_CACHES =
+  {
+    {1, 2, 150},
+    {2, 4, 150},
+    {4, 10, 150},
+    {8, 16, 150},
+    {16, 32, 150}};
+
+bool gRunBenchmark(false);    ///< Play many animated images for each frame cache configuration, set with the --benchmark option
+int  gBenchmarkViewCount(48); ///< Set with the -n option
+
 const char* ANIMATION_RADIO_BUTTON_NAME("Animation Image");
 const char* ARRAY_RADIO_BUTTON_NAME("Array");
 
@@ -108,6 +125,12 @@ private:
     window.SetBackgroundColor(Color::WHITE);
     window.KeyEventSignal().Connect(this, &AnimatedImageController::OnKeyEvent);
 
+    if(gRunBenchmark)
+    {
+      StartBenchmark(window);
+      return;
+    }
+
     // Create the animated image-views
     CreateAnimatedImageViews(window);
 
@@ -119,6 +142,22 @@ private:
     mTapDetector.DetectedSignal().Connect(this, &AnimatedImageController::OnTap);
   }
 
+  /**
+   * @brief Plays each animated image and image array in many views at once, for each frame cache configuration.
+   */
+  void StartBenchmark(Window window)
+  {
+    std::vector<Property::Value> sources;
+    for(unsigned int index = 0; index < ANIMATED_IMAGE_COUNT; ++index)
+    {
+      sources.push_back(Property::Value(ANIMATED_IMAGE_URLS[index]));
+      sources.push_back(Property::Value(GetFrameUrls(index)));
+    }
+
+    mBenchmark = std::make_unique<AnimatedImageBenchmark>(window, sources, gBenchmarkViewCount, BENCHMARK_FRAME_CACHES);
+    mBenchmark->Start();
+  }
+
   /**
    * @brief Creates and lays out radio buttons to allow changing between the different image types.
    */
@@ -325,21 +364,32 @@ private:
     }
     else
     {
-      Property::Array frameUrls;
+      map.Add(Toolkit::ImageVisual::Property::URL, Property::Value(GetFrameUrls(index)));
+    }
+    map.Add(DevelVisual::Property::VISUAL_FITTING_MODE, DevelVisual::FIT_KEEP_ASPECT_RATIO);
+  }
+
+  /**
+   * @brief Gets the frame URLs of an image array, formatted on first use only.
+   * @param[in]  index  The index
+   * @return The frame URLs
+   */
+  const Property::Array& GetFrameUrls(int index)
+  {
+    Property::Array& frameUrls = mFrameUrls[index];
+    if(frameUrls.Empty())
+    {
+      char buffer[256];
       for(int i = 1; i <= ANIMATED_ARRAY_NUMBER_OF_FRAMES[index]; ++i)
       {
-        char* buffer;
-        int   len = asprintf(&buffer, ANIMATED_ARRAY_URL_FORMATS[index], i);
-        if(len > 0)
+        int len = snprintf(buffer, sizeof(buffer), ANIMATED_ARRAY_URL_FORMATS[index], i);
+        if(len > 0 && len < static_cast<int>(sizeof(buffer)))
         {
-          std::string frameUrl(buffer);
-          free(buffer);
-          frameUrls.Add(Property::Value(frameUrl));
+          frameUrls.Add(Property::Value(std::string(buffer, len)));
         }
       }
-      map.Add(Toolkit::ImageVisual::Property::URL, Property::Value(frameUrls));
     }
-    map.Add(DevelVisual::Property::VISUAL_FITTING_MODE, DevelVisual::FIT_KEEP_ASPECT_RATIO);
+    return frameUrls;
   }
 
   /**
@@ -353,9 +403,9 @@ private:
     if(type == ImageType::IMAGE_ARRAY)
     {
       map
-        .Add(Toolkit::ImageVisual::Property::BATCH_SIZE, 4)
-        .Add(Toolkit::ImageVisual::Property::CACHE_SIZE, 10)
-        .Add(Toolkit::ImageVisual::Property::FRAME_DELAY, 150);
+        .Add(Toolkit::ImageVisual::Property::BATCH_SIZE, DEFAULT_FRAME_CACHE.batchSize)
+        .Add(Toolkit::ImageVisual::Property::CACHE_SIZE, DEFAULT_FRAME_CACHE.cacheSize)
+        .Add(Toolkit::ImageVisual::Property::FRAME_DELAY, DEFAULT_FRAME_CACHE.frameDelay);
     }
   }
 
@@ -371,10 +421,36 @@ private:
   TapGestureDetector mTapDetector; ///< The tap detector.
 
   ImageType mImageType; ///< The current Image type.
+
+  Property::Array mFrameUrls[ANIMATED_IMAGE_COUNT]; ///< The frame URLs of each image array, once formatted.
+
+  std::unique_ptr<AnimatedImageBenchmark> mBenchmark; ///< Only created with the --benchmark option.
 };
 
 int DALI_EXPORT_API main(int argc, char** argv)
 {
+  for(int i(1); i < argc; ++i)
+  {
+    std::string arg(argv[i]);
+    if(arg.compare("--benchmark") == 0)
+    {
+      gRunBenchmark = true;
+    }
+    else if(arg.compare(0, 2, "-n") == 0)
+    {
+      gBenchmarkViewCount = std::max(1, atoi(arg.substr(2, arg.size()).c_str()));
+    }
+    else if((arg.compare("--help") == 0) || (arg.compare("-h") == 0))
+    {
+      std::cout << "animated-images.example [OPTIONS]" << std::endl;
+      std::cout << "  Options:" << std::endl;
+      std::cout << "    --benchmark    Plays many animated images at once for several batch and cache sizes, and shows a table" << std::endl;
+      std::cout << "    -n[count]      Number of animated images played by the benchmark, 48 by default" << std::endl;
+      std::cout << "    -h|--help      Help" << std::endl;
+      return 0;
+    }
+  }
+
   Application application = Application::New(&argc, &argv);
 
   AnimatedImageController test(application);
@@ -20,14 +20,27 @@
 #include <dali-toolkit/devel-api/visuals/image-visual-properties-devel.h>
 #include <dali-toolkit/devel-api/visuals/visual-properties-devel.h>
 #include <dali/devel-api/adaptor-framework/key-devel.h>
+#include <dali/devel-api/common/stage.h>
 #include <dali/devel-api/events/hit-test-algorithm.h>
+#include <dali/devel-api/update/frame-callback-interface.h>
+#include <dali/devel-api/update/update-proxy.h>
 #include <dali/integration-api/debug.h>
 
 #include <chipmunk/chipmunk.h>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
 #include <cstdlib>
+#include <iomanip>
 #include <iostream>
+#include <memory>
+#include <sstream>
 #include <string>
 #include <unistd.h>
+#include <utility>
+
+#include "shared/frame-stats.h"
+#include "spatial-hash.h"
 
 using namespace Dali;
 using namespace Dali::Toolkit::Physics;
@@ -41,6 +54,7 @@ Debug::Filter* gPhysicsDemo = Debug::Filter::New(Debug::Concise, false, "LOG_PHY
 const float    MAX_ANIMATION_DURATION{60.0f};
 const uint32_t ANIMATION_TIME{30000};
 const uint32_t DEFAULT_BALL_COUNT{500};
+const uint32_t STATS_INTERVAL{1000};
 
 #if defined(_ARCH_ARM_)
 #define DEMO_ICON_DIR "/usr/share/icons"
@@ -66,19 +80,201 @@ const cpBitmask BALL_COLLIDES_WITH{BALL_GROUP | BOUNDS_GROUP};
 enum BenchmarkType
 {
   ANIMATION,
+  FRAME_CALLBACK,
   PHYSICS_2D,
 };
 
+const char* BENCHMARK_NAMES[] = {"Animation", "Frame callback", "Physics"};
+
+/**
+ * @brief Moves all the balls in a single pass on the update thread.
+ * Positions and velocities are packed in separate arrays, and bounces off the walls are
+ * resolved in place, so nothing goes back to the event thread.
+ * Optionally balls also collide with each other, found with a uniform grid broadphase.
+ */
+class BallFrameCallback : public FrameCallbackInterface
+{
+public:
+  /**
+   * Adds a ball, must be called before the callback is added to the stage.
+   * @param[in] actorId Id of the actor of the ball
+   * @param[in] position Initial position of the ball relative to the window center
+   * @param[in] velocity Velocity in pixels per second
+   */
+  void AddBall(uint32_t actorId, const Vector2& position, const Vector2& velocity)
+  {
+    mActorIds.push_back(actorId);
+    mPositionX.push_back(position.x);
+    mPositionY.push_back(position.y);
+    mVelocityX.push_back(velocity.x);
+    mVelocityY.push_back(velocity.y);
+  }
+
+  /**
+   * Sets the furthest the center of a ball can be from the window center.
+   */
+  void SetBounds(const Vector2& bounds)
+  {
+    mBoundX = bounds.x;
+    mBoundY = bounds.y;
+  }
+
+  /**
+   * Enables elastic collisions between balls of equal mass, must be called before the callback is added to the stage.
+   * @param[in] radius Radius of the balls, 0 to disable collisions
+   */
+  void SetCollisionRadius(float radius)
+  {
+    mRadius = radius;
+  }
+
+  /**
+   * Returns the number of ball contacts since the previous call and restarts counting.
+   */
+  uint64_t ResetContacts()
+  {
+    return mContacts.exchange(0u);
+  }
+
+  /**
+   * Returns the time spent in Update since the previous call, in microseconds, and restarts counting.
+   */
+  uint64_t ResetUpdateTime()
+  {
+    return mUpdateTimeUs.exchange(0u);
+  }
+
+private:
+  /**
+   * Integrates one axis of all the balls, reflecting them off the bounds.
+   */
+  static void Integrate(float* position, float* velocity, size_t count, float bound, float elapsedSeconds)
+  {
+    for(size_t i = 0; i < count; ++i)
+    {
+      float p = position[i] + velocity[i] * elapsedSeconds;
+      if(p < -bound)
+      {
+        p           = -2.0f * bound - p;
+        velocity[i] = fabsf(velocity[i]);
+      }
+      else if(p > bound)
+      {
+        p           = 2.0f * bound - p;
+        velocity[i] = -fabsf(velocity[i]);
+      }
+      position[i] = std::min(bound, std::max(-bound, p));
+    }
+  }
+
+  /**
+   * Separates overlapping balls and exchanges the normal component of their velocities if they approach.
+   */
+  void ResolveContacts()
+  {
+    float* positionX = mPositionX.data();
+    float* positionY = mPositionY.data();
+    float* velocityX = mVelocityX.data();
+    float* velocityY = mVelocityY.data();
+
+    const float diameter = mRadius * 2.0f;
+    const float boundX   = mBoundX;
+    const float boundY   = mBoundY;
+    mGrid.Build(positionX, positionY, mActorIds.size(), -boundX, -boundY, boundX, boundY, diameter);
+
+    // The grid refers to the positions it was built from, so find all the pairs before moving any ball
+    mPairs.clear();
+    mGrid.ForEachPair(positionX, positionY, diameter, [this](uint32_t i, uint32_t j) { mPairs.emplace_back(i, j); });
+
+    for(const auto& pair : mPairs)
+    {
+      const uint32_t i        = pair.first;
+      const uint32_t j        = pair.second;
+      const float    dx       = positionX[j] - positionX[i];
+      const float    dy       = positionY[j] - positionY[i];
+      const float    distance = sqrtf(dx * dx + dy * dy);
+      if(distance <= 0.0f || distance >= diameter)
+      {
+        continue; // Coincident, or already separated by an earlier pair
+      }
+
+      const float normalX = dx / distance;
+      const float normalY = dy / distance;
+      const float push    = (diameter - distance) * 0.5f;
+      positionX[i] -= normalX * push;
+      positionY[i] -= normalY * push;
+      positionX[j] += normalX * push;
+      positionY[j] += normalY * push;
+
+      const float approach = (velocityX[j] - velocityX[i]) * normalX + (velocityY[j] - velocityY[i]) * normalY;
+      if(approach < 0.0f)
+      {
+        velocityX[i] += approach * normalX;
+        velocityY[i] += approach * normalY;
+        velocityX[j] -= approach * normalX;
+        velocityY[j] -= approach * normalY;
+      }
+    }
+
+    // Separation can push balls against a wall past it
+    const size_t count = mActorIds.size();
+    for(size_t i = 0; i < count; ++i)
+    {
+      positionX[i] = std::min(boundX, std::max(-boundX, positionX[i]));
+      positionY[i] = std::min(boundY, std::max(-boundY, positionY[i]));
+    }
+
+    mContacts += mPairs.size();
+  }
+
+  virtual bool Update(Dali::UpdateProxy& updateProxy, float elapsedSeconds)
+  {
+    const auto start = std::chrono::steady_clock::now();
+
+    const size_t count = mActorIds.size();
+    Integrate(mPositionX.data(), mVelocityX.data(), count, mBoundX, elapsedSeconds);
+    Integrate(mPositionY.data(), mVelocityY.data(), count, mBoundY, elapsedSeconds);
+
+    if(mRadius > 0.0f)
+    {
+      ResolveContacts();
+    }
+
+    for(size_t i = 0; i < count; ++i)
+    {
+      updateProxy.SetPosition(mActorIds[i], Vector3(mPositionX[i], mPositionY[i], 0.0f));
+    }
+
+    mUpdateTimeUs += std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start).count();
+    return true;
+  }
+
+private:
+  std::vector<uint32_t>                      mActorIds;
+  std::vector<float>                         mPositionX;
+  std::vector<float>                         mPositionY;
+  std::vector<float>                         mVelocityX;
+  std::vector<float>                         mVelocityY;
+  std::atomic<float>                         mBoundX{0.0f};
+  std::atomic<float>                         mBoundY{0.0f};
+  std::atomic<uint64_t>                      mUpdateTimeUs{0u};
+  std::atomic<uint64_t>                      mContacts{0u};
+  float                                      mRadius{0.0f};
+  SpatialHash                                mGrid;
+  std::vector<std::pair<uint32_t, uint32_t>> mPairs; ///< Overlapping balls found in the current frame
+};
+
 /**
  * @brief The physics demo using Chipmunk2D APIs.
  */
 class Physics2dBenchmarkController : public ConnectionTracker
 {
 public:
-  Physics2dBenchmarkController(Application& app, BenchmarkType startType, int numberOfBalls)
+  Physics2dBenchmarkController(Application& app, BenchmarkType startType, int numberOfBalls, bool fairContacts)
   : mApplication(app),
     mType(startType),
-    mBallNumber(numberOfBalls)
+    mBallNumber(numberOfBalls),
+    mFairContacts(fairContacts)
   {
     app.InitSignal().Connect(this, &Physics2dBenchmarkController::OnInit);
     app.TerminateSignal().Connect(this, &Physics2dBenchmarkController::OnTerminate);
@@ -94,11 +290,18 @@ public:
     mWindow.GetRootLayer().TouchedSignal().Connect(this, &Physics2dBenchmarkController::OnTouched);
     mWindow.SetBackgroundColor(Color::DARK_SLATE_GRAY);
 
+    mUpdateThreadStats = std::make_unique<DemoHelper::FrameStats>();
+    DevelStage::AddFrameCallback(Stage::GetCurrent(), *mUpdateThreadStats, mWindow.GetRootLayer());
+
     CreateSimulation();
 
     mTimer = Timer::New(ANIMATION_TIME);
     mTimer.TickSignal().Connect(this, &Physics2dBenchmarkController::AnimationSimFinished);
     mTimer.Start();
+
+    mStatsTimer = Timer::New(STATS_INTERVAL);
+    mStatsTimer.TickSignal().Connect(this, &Physics2dBenchmarkController::OnStatsTimer);
+    mStatsTimer.Start();
   }
 
   void CreateSimulation()
@@ -112,6 +315,12 @@ public:
         CreateAnimationSimulation();
         break;
       }
+      case BenchmarkType::FRAME_CALLBACK:
+      {
+        DALI_LOG_ERROR("CreateFrameCallbackSimulation\n");
+        CreateFrameCallbackSimulation();
+        break;
+      }
       case BenchmarkType::PHYSICS_2D:
       {
         DALI_LOG_ERROR("CreatePhysicsSimulation\n");
@@ -123,6 +332,14 @@ public:
 
   bool AnimationSimFinished()
   {
+    OnStatsTimer();
+    LogResult(mType, mTotalFrames, mTotalElapsedUs, mTotalCpuTimeUs, mTotalCallbackUs, mTotalContacts);
+    mTotalFrames     = 0u;
+    mTotalElapsedUs  = 0u;
+    mTotalCpuTimeUs  = 0u;
+    mTotalCallbackUs = 0u;
+    mTotalContacts   = 0u;
+
     switch(mType)
     {
       case BenchmarkType::ANIMATION:
@@ -135,6 +352,16 @@ public:
           animation.Clear();
         }
         mBallAnimations.clear();
+        mBallActors.clear();
+
+        mType = BenchmarkType::FRAME_CALLBACK;
+
+        CreateSimulation();
+        return true;
+      }
+      case BenchmarkType::FRAME_CALLBACK:
+      {
+        DestroyFrameCallbackSimulation();
 
         mType = BenchmarkType::PHYSICS_2D;
 
@@ -150,10 +377,100 @@ public:
     return false;
   }
 
+  /**
+   * Logs the frame rate and update cost of the running benchmark since the previous tick.
+   */
+  bool OnStatsTimer()
+  {
+    const DemoHelper::FrameStats::Sample stats      = mUpdateThreadStats->Reset();
+    const uint32_t                       frames     = stats.frames;
+    const uint64_t                       elapsedUs  = stats.elapsedUs;
+    const uint64_t                       cpuTimeUs  = stats.cpuTimeUs;
+    const uint64_t                       callbackUs = mBallFrameCallback ? mBallFrameCallback->ResetUpdateTime() : 0u;
+    uint64_t                             contacts   = mBallFrameCallback ? mBallFrameCallback->ResetContacts() : 0u;
+    if(mType == BenchmarkType::PHYSICS_2D && mPhysicsAdaptor)
+    {
+      // Chipmunk keeps no running count, so the contacts of the current step stand for the whole interval
+      contacts = CountPhysicsContacts() * frames;
+    }
+
+    mTotalFrames += frames;
+    mTotalElapsedUs += elapsedUs;
+    mTotalCpuTimeUs += cpuTimeUs;
+    mTotalCallbackUs += callbackUs;
+    mTotalContacts += contacts;
+
+    if(frames && mTitle)
+    {
+      std::ostringstream oss;
+      oss << BENCHMARK_NAMES[mType] << " simulation of " << mBallNumber << " balls\n"
+          << std::fixed << std::setprecision(1) << frames * 1000000.0f / elapsedUs << " fps, update "
+          << std::setprecision(2) << cpuTimeUs / 1000.0f / frames << " ms/frame";
+      if(mType == BenchmarkType::FRAME_CALLBACK)
+      {
+        oss << " (balls " << callbackUs / 1000.0f / frames << " ms)";
+      }
+      if(mType == BenchmarkType::PHYSICS_2D || (mType == BenchmarkType::FRAME_CALLBACK && mFairContacts))
+      {
+        oss << "\n" << std::setprecision(1) << float(contacts) / frames << " contacts/frame";
+      }
+      mTitle[Toolkit::TextLabel::Property::MULTI_LINE] = true;
+      mTitle[Toolkit::TextLabel::Property::TEXT]       = oss.str();
+    }
+    return true;
+  }
+
+  /**
+   * Counts the contacts between balls in the latest step of the physics world.
+   */
+  uint64_t CountPhysicsContacts()
+  {
+    auto     scopedAccessor = mPhysicsAdaptor.GetPhysicsAccessor();
+    cpSpace* space          = scopedAccessor->GetNative().Get<cpSpace*>();
+    uint64_t contacts       = 0u;
+    cpSpaceEachBody(
+      space,
+      [](cpBody* body, void* data) {
+        cpBodyEachArbiter(
+          body,
+          [](cpBody* body, cpArbiter* arbiter, void* data) {
+            // The iterated body always comes first, and each pair of balls is listed by both balls.
+            // Contacts with the static bounds are left out.
+            CP_ARBITER_GET_BODIES(arbiter, self, other);
+            if(cpBodyGetType(other) == CP_BODY_TYPE_DYNAMIC && self < other)
+            {
+              ++*static_cast<uint64_t*>(data);
+            }
+          },
+          data);
+      },
+      &contacts);
+    return contacts;
+  }
+
+  void LogResult(BenchmarkType type, uint32_t frames, uint64_t elapsedUs, uint64_t cpuTimeUs, uint64_t callbackUs, uint64_t contacts)
+  {
+    if(frames && elapsedUs)
+    {
+      DALI_LOG_RELEASE_INFO("%s: %d balls, %.1f fps, update thread %.2f ms/frame, ball update %.3f ms/frame, %.1f contacts/frame\n",
+                            BENCHMARK_NAMES[type],
+                            mBallNumber,
+                            frames * 1000000.0f / elapsedUs,
+                            cpuTimeUs / 1000.0f / frames,
+                            callbackUs / 1000.0f / frames,
+                            float(contacts) / frames);
+    }
+  }
+
   void OnTerminate(Application& application)
   {
     UnparentAndReset(mAnimationSimRootActor);
     UnparentAndReset(mPhysicsRoot);
+    DestroyFrameCallbackSimulation();
+    if(mUpdateThreadStats)
+    {
+      DevelStage::RemoveFrameCallback(Stage::GetCurrent(), *mUpdateThreadStats);
+    }
   }
 
   void OnWindowResize(Window window, Window::WindowSize newSize)
@@ -166,6 +483,14 @@ public:
         // TODO : Implement here if you want.
         break;
       }
+      case BenchmarkType::FRAME_CALLBACK:
+      {
+        if(mBallFrameCallback)
+        {
+          mBallFrameCallback->SetBounds(Vector2(newSize.GetWidth() * 0.5f - mBallMargin, newSize.GetHeight() * 0.5f - mBallMargin));
+        }
+        break;
+      }
       case BenchmarkType::PHYSICS_2D:
       {
         if(mPhysicsAdaptor)
@@ -216,7 +541,7 @@ public:
     mWindow.Add(mAnimationSimRootActor);
     std::ostringstream oss;
     oss << "Animation simulation of " << mBallNumber << " balls";
-    auto title = Toolkit::TextLabel::New(oss.str());
+    auto title = mTitle = Toolkit::TextLabel::New(oss.str());
     mAnimationSimRootActor.Add(title);
     title[Toolkit::TextLabel::Property::TEXT_COLOR]           = Color::WHITE;
     title[Actor::Property::PARENT_ORIGIN]                     = Dali::ParentOrigin::TOP_CENTER;
@@ -329,6 +654,84 @@ public:
     }
   }
 
+  // BenchmarkType::FRAME_CALLBACK
+
+  void CreateFrameCallbackSimulation()
+  {
+    DALI_LOG_RELEASE_INFO("Creating frame callback simulation with %d balls\n", mBallNumber);
+
+    Window::WindowSize windowSize = mWindow.GetSize();
+    mBallActors.resize(mBallNumber);
+
+    mFrameCallbackRootActor = Layer::New();
+    mFrameCallbackRootActor.SetResizePolicy(ResizePolicy::FILL_TO_PARENT, Dimension::ALL_DIMENSIONS);
+    mFrameCallbackRootActor[Actor::Property::PARENT_ORIGIN] = Dali::ParentOrigin::CENTER;
+    mFrameCallbackRootActor[Actor::Property::ANCHOR_POINT]  = Dali::AnchorPoint::CENTER;
+
+    mWindow.Add(mFrameCallbackRootActor);
+    std::ostringstream oss;
+    oss << "Frame callback simulation of " << mBallNumber << " balls";
+    auto title = mTitle = Toolkit::TextLabel::New(oss.str());
+    mFrameCallbackRootActor.Add(title);
+    title[Toolkit::TextLabel::Property::TEXT_COLOR]           = Color::WHITE;
+    title[Actor::Property::PARENT_ORIGIN]                     = Dali::ParentOrigin::TOP_CENTER;
+    title[Actor::Property::ANCHOR_POINT]                      = Dali::AnchorPoint::TOP_CENTER;
+    title[Toolkit::TextLabel::Property::HORIZONTAL_ALIGNMENT] = HorizontalAlignment::CENTER;
+    title.SetResizePolicy(ResizePolicy::USE_NATURAL_SIZE, Dimension::ALL_DIMENSIONS);
+
+    // Same balls and speeds as the animation simulation, or as the physics simulation,
+    // including the collisions between balls, when comparing contacts
+    const Vector2 ballSize = mFairContacts ? BALL_SIZE * 0.5f : BALL_SIZE;
+    mBallMargin            = ballSize.width * 0.5f;
+    const float width      = windowSize.GetWidth() * 0.5f - mBallMargin;
+    const float height     = windowSize.GetHeight() * 0.5f - mBallMargin;
+
+    mBallFrameCallback = std::make_unique<BallFrameCallback>();
+    mBallFrameCallback->SetBounds(Vector2(width, height));
+    mBallFrameCallback->SetCollisionRadius(mFairContacts ? mBallMargin : 0.0f);
+
+    for(int i = 0; i < mBallNumber; ++i)
+    {
+      Actor ball = mBallActors[i]          = Toolkit::ImageView::New(BALL_IMAGES[rand() % 4]);
+      ball[Actor::Property::PARENT_ORIGIN] = Dali::ParentOrigin::CENTER;
+      ball[Actor::Property::ANCHOR_POINT]  = Dali::AnchorPoint::CENTER;
+      ball[Actor::Property::NAME]          = "Ball";
+      ball[Actor::Property::SIZE]          = ballSize;
+      mFrameCallbackRootActor.Add(ball);
+
+      Vector2 velocity;
+      if(mFairContacts)
+      {
+        velocity = Vector2(Random::Range(-100.0f, 100.0f), Random::Range(-100.0f, 100.0f));
+      }
+      else
+      {
+        velocity = Vector2(Random::Range(-25.0f, 25.0f), Random::Range(-25.0f, 25.0f));
+        velocity.Normalize();
+        velocity *= Random::Range(15.0f, 50.0f);
+      }
+
+      mBallFrameCallback->AddBall(ball.GetProperty<int>(Actor::Property::ID),
+                                  Vector2(Random::Range(-width, width), Random::Range(-height, height)),
+                                  velocity);
+    }
+
+    title.RaiseToTop();
+
+    DevelStage::AddFrameCallback(Stage::GetCurrent(), *mBallFrameCallback, mFrameCallbackRootActor);
+  }
+
+  void DestroyFrameCallbackSimulation()
+  {
+    if(mBallFrameCallback)
+    {
+      DevelStage::RemoveFrameCallback(Stage::GetCurrent(), *mBallFrameCallback);
+      mBallFrameCallback.reset();
+    }
+    UnparentAndReset(mFrameCallbackRootActor);
+    mBallActors.clear();
+  }
+
   // BenchmarkType::PHYSICS_2D
 
   void CreatePhysicsSimulation()
@@ -364,7 +767,7 @@ public:
 
     std::ostringstream oss;
     oss << "Physics simulation of " << mBallNumber << " balls";
-    auto title = Toolkit::TextLabel::New(oss.str());
+    auto title = mTitle = Toolkit::TextLabel::New(oss.str());
     mPhysicsRoot.Add(title);
     title[Toolkit::TextLabel::Property::TEXT_COLOR]           = Color::WHITE;
     title[Actor::Property::PARENT_ORIGIN]                     = Dali::ParentOrigin::TOP_CENTER;
@@ -449,6 +852,7 @@ private:
   Actor                     mPhysicsRoot;
   Layer                     mPhysicsDebugLayer;
   Layer                     mAnimationSimRootActor;
+  Layer                     mFrameCallbackRootActor;
   cpShape*                  mLeftBound{nullptr};
   cpShape*                  mRightBound{nullptr};
   cpShape*                  mTopBound{nullptr};
@@ -458,7 +862,19 @@ private:
   std::vector<Vector3>   mBallVelocity;
   std::vector<Animation> mBallAnimations;
   int                    mBallNumber;
+  bool                   mFairContacts; ///< Frame callback balls collide like the physics ones
+  float                  mBallMargin{0.0f};
   Timer                  mTimer;
+
+  Toolkit::TextLabel                      mTitle;
+  Timer                                   mStatsTimer;
+  std::unique_ptr<DemoHelper::FrameStats> mUpdateThreadStats;
+  std::unique_ptr<BallFrameCallback>      mBallFrameCallback;
+  uint32_t                                mTotalFrames{0u};     ///< Frames of the running benchmark
+  uint64_t                                mTotalElapsedUs{0u};  ///< Duration of those frames
+  uint64_t                                mTotalCpuTimeUs{0u};  ///< Update thread CPU time of those frames
+  uint64_t                                mTotalCallbackUs{0u}; ///< Time spent moving the balls in the frame callback
+  uint64_t                                mTotalContacts{0u};   ///< Contacts between balls
 };
 
 int DALI_EXPORT_API main(int argc, char** argv)
@@ -467,16 +883,23 @@ int DALI_EXPORT_API main(int argc, char** argv)
   Application application = Application::New(&argc, &argv);
   BenchmarkType startType = BenchmarkType::ANIMATION;
 
-  int numberOfBalls = DEFAULT_BALL_COUNT;
+  int  numberOfBalls = DEFAULT_BALL_COUNT;
+  bool fairContacts  = false;
   int opt=0;
   optind=1;
-  while((opt=getopt(argc, argv, "ap")) != -1)
+  while((opt=getopt(argc, argv, "acfp")) != -1)
   {
     switch(opt)
     {
       case 'a':
         startType = BenchmarkType::ANIMATION;
         break;
+      case 'c':
+        fairContacts = true;
+        break;
+      case 'f':
+        startType = BenchmarkType::FRAME_CALLBACK;
+        break;
       case 'p':
         startType = BenchmarkType::PHYSICS_2D;
         break;
@@ -485,7 +908,7 @@ int DALI_EXPORT_API main(int argc, char** argv)
         numberOfBalls = atoi(optarg);
         break;
       default:
-        fprintf(stderr, "Usage: %s [-p][-a] [n-balls]\n", argv[0]);
+        fprintf(stderr, "Usage: %s [-p][-f][-a][-c] [n-balls]\n", argv[0]);
         exit(1);
     }
   }
@@ -494,7 +917,7 @@ int DALI_EXPORT_API main(int argc, char** argv)
     numberOfBalls = atoi(argv[optind]);
   }
 
-  Physics2dBenchmarkController controller(application, startType, numberOfBalls);
+  Physics2dBenchmarkController controller(application, startType, numberOfBalls, fairContacts);
   application.MainLoop();
   return 0;
 }
@@ -0,0 +1,63 @@
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "spatial-hash.h"
+
+#include <algorithm>
+#include <cmath>
+
+constexpr int32_t SpatialHash::FORWARD_NEIGHBOURS[4][2];
+
+void SpatialHash::Build(const float* x, const float* y, uint32_t count, float minX, float minY, float maxX, float maxY, float cellSize)
+{
+  const float inverseCellSize = 1.0f / cellSize;
+  mColumns                    = std::max(1u, uint32_t(std::ceil((maxX - minX) * inverseCellSize)));
+  mRows                       = std::max(1u, uint32_t(std::ceil((maxY - minY) * inverseCellSize)));
+
+  const uint32_t cellCount = mColumns * mRows;
+  mCellStart.assign(cellCount + 1u, 0u);
+  mItems.resize(count);
+  mItemCell.resize(count);
+
+  // Count the points of each cell
+  const int32_t lastColumn = int32_t(mColumns) - 1;
+  const int32_t lastRow    = int32_t(mRows) - 1;
+  for(uint32_t i = 0u; i < count; ++i)
+  {
+    const int32_t  column = std::min(lastColumn, std::max(0, int32_t((x[i] - minX) * inverseCellSize)));
+    const int32_t  row    = std::min(lastRow, std::max(0, int32_t((y[i] - minY) * inverseCellSize)));
+    const uint32_t cell   = uint32_t(row) * mColumns + uint32_t(column);
+    mItemCell[i]          = cell;
+    ++mCellStart[cell + 1u];
+  }
+
+  // Turn the counts into start offsets
+  for(uint32_t cell = 0u; cell < cellCount; ++cell)
+  {
+    mCellStart[cell + 1u] += mCellStart[cell];
+  }
+
+  // Scatter using the start of each cell as its cursor, which leaves it at the start of the next cell, then shift back
+  for(uint32_t i = 0u; i < count; ++i)
+  {
+    mItems[mCellStart[mItemCell[i]]++] = i;
+  }
+  for(uint32_t cell = cellCount; cell > 0u; --cell)
+  {
+    mCellStart[cell] = mCellStart[cell - 1u];
+  }
+  mCellStart[0] = 0u;
+}
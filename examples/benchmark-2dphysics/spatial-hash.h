@@ -0,0 +1,119 @@
+#ifndef DALI_BENCHMARK_2D_PHYSICS_SPATIAL_HASH_H
+#define DALI_BENCHMARK_2D_PHYSICS_SPATIAL_HASH_H
+
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cstdint>
+#include <vector>
+
+/**
+ * @brief Uniform grid broadphase for circles of the same radius.
+ *
+ * Points are bucketed into square cells with a counting sort, so building the grid and
+ * finding all the pairs closer than a cell size are both linear in the number of points
+ * for a roughly even distribution.
+ */
+class SpatialHash
+{
+public:
+  SpatialHash() = default;
+
+  /**
+   * Buckets the points into cells covering the given area, points outside it go to the border cells.
+   * @param[in] x X coordinates of the points
+   * @param[in] y Y coordinates of the points
+   * @param[in] count Number of points
+   * @param[in] minX Left edge of the area
+   * @param[in] minY Top edge of the area
+   * @param[in] maxX Right edge of the area
+   * @param[in] maxY Bottom edge of the area
+   * @param[in] cellSize Size of a cell, at least the largest distance queried
+   */
+  void Build(const float* x, const float* y, uint32_t count, float minX, float minY, float maxX, float maxY, float cellSize);
+
+  /**
+   * Calls callback(i, j) once for every pair of points closer than maxDistance.
+   * The coordinates must be the ones passed to Build().
+   * @param[in] x X coordinates of the points
+   * @param[in] y Y coordinates of the points
+   * @param[in] maxDistance Distance below which points are paired, at most the cell size
+   * @param[in] callback Called with the indices of the points of each pair
+   */
+  template<typename Callback>
+  void ForEachPair(const float* x, const float* y, float maxDistance, Callback&& callback) const
+  {
+    const float maxDistanceSquared = maxDistance * maxDistance;
+
+    for(uint32_t cellY = 0u; cellY < mRows; ++cellY)
+    {
+      for(uint32_t cellX = 0u; cellX < mColumns; ++cellX)
+      {
+        const uint32_t cell  = cellY * mColumns + cellX;
+        const uint32_t begin = mCellStart[cell];
+        const uint32_t end   = mCellStart[cell + 1u];
+
+        for(uint32_t a = begin; a < end; ++a)
+        {
+          const uint32_t i = mItems[a];
+
+          // Rest of the same cell, then the half of the neighbours ahead so each pair is visited once
+          for(uint32_t b = a + 1u; b < end; ++b)
+          {
+            TestPair(x, y, i, mItems[b], maxDistanceSquared, callback);
+          }
+          for(const auto& offset : FORWARD_NEIGHBOURS)
+          {
+            const int32_t neighbourX = int32_t(cellX) + offset[0];
+            const int32_t neighbourY = int32_t(cellY) + offset[1];
+            if(neighbourX < 0 || neighbourX >= int32_t(mColumns) || neighbourY >= int32_t(mRows))
+            {
+              continue;
+            }
+
+            const uint32_t neighbour = uint32_t(neighbourY) * mColumns + uint32_t(neighbourX);
+            for(uint32_t b = mCellStart[neighbour]; b < mCellStart[neighbour + 1u]; ++b)
+            {
+              TestPair(x, y, i, mItems[b], maxDistanceSquared, callback);
+            }
+          }
+        }
+      }
+    }
+  }
+
+private:
+  template<typename Callback>
+  static void TestPair(const float* x, const float* y, uint32_t i, uint32_t j, float maxDistanceSquared, Callback& callback)
+  {
+    const float dx = x[j] - x[i];
+    const float dy = y[j] - y[i];
+    if(dx * dx + dy * dy < maxDistanceSquared)
+    {
+      callback(i, j);
+    }
+  }
+
+  static constexpr int32_t FORWARD_NEIGHBOURS[4][2] = {{1, 0}, {-1, 1}, {0, 1}, {1, 1}};
+
+  std::vector<uint32_t> mCellStart; ///< Index into mItems of the first point of each cell, plus the end
+  std::vector<uint32_t> mItems;     ///< Point indices sorted by cell
+  std::vector<uint32_t> mItemCell;  ///< Cell of each point, used while building
+  uint32_t              mColumns{0u};
+  uint32_t              mRows{0u};
+};
+
+#endif // DALI_BENCHMARK_2D_PHYSICS_SPATIAL_HASH_H
@@ -16,14 +16,26 @@
  */
 
 #include <algorithm>
+#include <atomic>
+#include <cfloat>
+#include <chrono>
+#include <cmath>
 #include <iostream>
 #include <map>
+#include <memory>
+#include <mutex>
 #include <sstream>
 #include <string>
+#include <vector>
 
 #include <dali-toolkit/dali-toolkit.h>
 #include <dali-toolkit/devel-api/visuals/visual-properties-devel.h>
 #include <dali/dali.h>
+#include <dali/devel-api/adaptor-framework/event-thread-callback.h>
+#include <dali/devel-api/common/stage.h>
+#include <dali/devel-api/update/frame-callback-interface.h>
+#include <dali/devel-api/update/update-proxy.h>
+#include <dali/integration-api/debug.h>
 #include "shared/view.h"
 
 using namespace Dali;
@@ -71,6 +83,11 @@ const Vector2 PADDLE_HIT_MARGIN(0.1, 0.15f);     ///< Extra hit Area for Paddle
 const int TOTAL_LIVES(3);  ///< Total lives in game before it's game over!
 const int TOTAL_LEVELS(3); ///< 3 Levels total, then repeats.
 
+const uint32_t GRID_STATS_INTERVAL(5000); ///< Milliseconds between two logs of the brick grid cost.
+
+bool gUseBrickGrid(false); ///< Test the ball against a brick grid in a frame callback, set with the --grid option
+int  gBrickScale(1);       ///< Bricks are this many times smaller in both directions, set with the -s option
+
 // constraints ////////////////////////////////////////////////////////////////
 
 /**
@@ -199,6 +216,242 @@ struct WobbleConstraint
   Radian mDeviation; ///< Deviation factor in radians.
 };
 
+/**
+ * BrickGrid tests the ball against a uniform grid of bricks in a frame callback.
+ *
+ * Only the cells along the path of the ball since the previous frame, widened by the ball
+ * radius, are tested, so the cost per frame doesn't depend on the number of bricks. A brick
+ * is removed from the grid as soon as it is hit; the hit is queued and the event thread is
+ * woken up to bounce the ball and destroy the brick actor.
+ */
+class BrickGrid : public FrameCallbackInterface
+{
+public:
+  /**
+   * A brick hit by the ball
+   */
+  struct Hit
+  {
+    int     cell;            ///< Index of the cell of the brick, row major
+    Vector2 collisionVector; ///< Normalized vector from the brick to the ball
+  };
+
+  /**
+   * @param[in] ballId Id of the ball actor, which must share its parent origin with the bricks
+   * @param[in] ballRadius Radius of the ball
+   * @param[in] onHit Called on the event thread after bricks were hit, takes ownership
+   */
+  BrickGrid(uint32_t ballId, float ballRadius, CallbackBase* onHit)
+  : mBallId(ballId),
+    mBallRadius(ballRadius),
+    mHitTrigger(new EventThreadCallback(onHit))
+  {
+  }
+
+  /**
+   * Replaces the bricks of the grid.
+   * @param[in] origin Top left corner of the grid
+   * @param[in] cellSize Size of a brick
+   * @param[in] columns Number of columns
+   * @param[in] rows Number of rows
+   * @param[in] cells Non zero for each cell holding a brick, row major
+   */
+  void SetLevel(const Vector2& origin, const Vector2& cellSize, int columns, int rows, std::vector<uint8_t> cells)
+  {
+    std::lock_guard<std::mutex> lock(mMutex);
+    mOrigin      = origin;
+    mCellSize    = cellSize;
+    mColumns     = columns;
+    mRows        = rows;
+    mCells       = std::move(cells);
+    mHasPrevious = false;
+    mHits.clear();
+  }
+
+  /**
+   * Tells the grid that the ball is being moved rather than animated to the given position, so
+   * that the jump isn't tested as a path. Testing resumes from the first frame the ball is there.
+   * @param[in] position The new position of the ball
+   */
+  void Teleport(const Vector2& position)
+  {
+    std::lock_guard<std::mutex> lock(mMutex);
+    mTeleportTarget = position;
+    mTeleporting    = true;
+  }
+
+  /**
+   * Moves the hits queued since the previous call into hits.
+   */
+  void TakeHits(std::vector<Hit>& hits)
+  {
+    std::lock_guard<std::mutex> lock(mMutex);
+    hits.swap(mHits);
+    mHits.clear();
+  }
+
+  /**
+   * Returns the number of frames and the time spent testing since the previous call, and restarts counting.
+   */
+  void ResetStats(uint32_t& frames, uint64_t& updateTimeUs)
+  {
+    frames       = mFrames.exchange(0u);
+    updateTimeUs = mUpdateTimeUs.exchange(0u);
+  }
+
+private:
+  virtual bool Update(Dali::UpdateProxy& updateProxy, float elapsedSeconds)
+  {
+    const auto start = std::chrono::steady_clock::now();
+    bool       hit   = false;
+
+    Vector3 position;
+    if(updateProxy.GetPosition(mBallId, position))
+    {
+      std::lock_guard<std::mutex> lock(mMutex);
+      const Vector2               to(position.x, position.y);
+      if(mTeleporting)
+      {
+        // Frames before the new position is applied still see the old one
+        mTeleporting = (to - mTeleportTarget).LengthSquared() > Math::MACHINE_EPSILON_1;
+        mHasPrevious = false;
+      }
+      if(mHasPrevious && !mCells.empty())
+      {
+        hit = TestPath(mPrevious, to);
+      }
+      mPrevious    = to;
+      mHasPrevious = true;
+    }
+
+    if(hit)
+    {
+      mHitTrigger->Trigger();
+    }
+
+    mUpdateTimeUs += std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start).count();
+    ++mFrames;
+    return true;
+  }
+
+  /**
+   * Walks the cells crossed by the segment from-to and tests the bricks within a ball radius of each.
+   * @return true if a brick was hit
+   */
+  bool TestPath(const Vector2& from, const Vector2& to)
+  {
+    const Vector2 a((from.x - mOrigin.x) / mCellSize.x, (from.y - mOrigin.y) / mCellSize.y);
+    const Vector2 b((to.x - mOrigin.x) / mCellSize.x, (to.y - mOrigin.y) / mCellSize.y);
+
+    int       x     = int(std::floor(a.x));
+    int       y     = int(std::floor(a.y));
+    const int steps = std::abs(int(std::floor(b.x)) - x) + std::abs(int(std::floor(b.y)) - y);
+
+    const Vector2 delta(b - a);
+    const int     stepX   = delta.x > 0.0f ? 1 : -1;
+    const int     stepY   = delta.y > 0.0f ? 1 : -1;
+    const float   tDeltaX = delta.x != 0.0f ? std::fabs(1.0f / delta.x) : FLT_MAX;
+    const float   tDeltaY = delta.y != 0.0f ? std::fabs(1.0f / delta.y) : FLT_MAX;
+    float         tMaxX   = delta.x != 0.0f ? (delta.x > 0.0f ? (x + 1 - a.x) : (a.x - x)) * tDeltaX : FLT_MAX;
+    float         tMaxY   = delta.y != 0.0f ? (delta.y > 0.0f ? (y + 1 - a.y) : (a.y - y)) * tDeltaY : FLT_MAX;
+
+    // Cells further than this from the path can't touch the ball
+    const int reachX = int(std::ceil(mBallRadius / mCellSize.x));
+    const int reachY = int(std::ceil(mBallRadius / mCellSize.y));
+
+    for(int i = 0;; ++i)
+    {
+      for(int row = std::max(0, y - reachY); row <= std::min(mRows - 1, y + reachY); ++row)
+      {
+        for(int column = std::max(0, x - reachX); column <= std::min(mColumns - 1, x + reachX); ++column)
+        {
+          const int cell = row * mColumns + column;
+          Vector2   collisionVector;
+          if(mCells[cell] && TestBrick(column, row, from, to, collisionVector))
+          {
+            mCells[cell] = 0u;
+            mHits.push_back({cell, collisionVector});
+            return true;
+          }
+        }
+      }
+
+      if(i == steps)
+      {
+        return false;
+      }
+      if(tMaxX < tMaxY)
+      {
+        tMaxX += tDeltaX;
+        x += stepX;
+      }
+      else
+      {
+        tMaxY += tDeltaY;
+        y += stepY;
+      }
+    }
+  }
+
+  /**
+   * Tests the ball, at the point of its path closest to the brick, against the brick.
+   * Same test as CollisionCircleRectangleConstraint.
+   */
+  bool TestBrick(int column, int row, const Vector2& from, const Vector2& to, Vector2& collisionVector) const
+  {
+    const Vector2 center(mOrigin.x + (column + 0.5f) * mCellSize.x, mOrigin.y + (row + 0.5f) * mCellSize.y);
+    const Vector2 halfSize(mCellSize * 0.5f);
+
+    const Vector2 path(to - from);
+    const float   lengthSquared = path.LengthSquared();
+    const float   t             = lengthSquared > 0.0f ? std::min(1.0f, std::max(0.0f, (center - from).Dot(path) / lengthSquared)) : 1.0f;
+    Vector2       delta(from + path * t - center);
+
+    // reduce rectangle to 0.
+    delta.x = delta.x > halfSize.x ? delta.x - halfSize.x : (delta.x < -halfSize.x ? delta.x + halfSize.x : 0.0f);
+    delta.y = delta.y > halfSize.y ? delta.y - halfSize.y : (delta.y < -halfSize.y ? delta.y + halfSize.y : 0.0f);
+
+    if(delta.Length() >= mBallRadius)
+    {
+      return false;
+    }
+
+    // Center of the ball inside the brick, push it back the way it came
+    if(delta.LengthSquared() < Math::MACHINE_EPSILON_1)
+    {
+      delta = -path;
+      if(delta.LengthSquared() < Math::MACHINE_EPSILON_1)
+      {
+        delta = Vector2(0.0f, 1.0f);
+      }
+    }
+    delta.Normalize();
+    collisionVector = delta;
+    return true;
+  }
+
+private:
+  const uint32_t                       mBallId;
+  const float                          mBallRadius;
+  std::unique_ptr<EventThreadCallback> mHitTrigger;
+
+  std::mutex           mMutex; ///< Guards the level and the hits
+  Vector2              mOrigin;
+  Vector2              mCellSize{Vector2::ONE};
+  int                  mColumns{0};
+  int                  mRows{0};
+  std::vector<uint8_t> mCells;
+  std::vector<Hit>     mHits;
+
+  Vector2 mPrevious; ///< Ball position in the previous frame
+  bool    mHasPrevious{false};
+  Vector2 mTeleportTarget; ///< Position the ball is being moved to, if teleporting
+  bool    mTeleporting{false};
+
+  std::atomic<uint32_t> mFrames{0u};
+  std::atomic<uint64_t> mUpdateTimeUs{0u};
+};
+
 } // unnamed namespace
 
 /**
@@ -327,6 +580,16 @@ private:
     PropertyNotification bottomNotification = mBall.AddPropertyNotification(Actor::Property::POSITION_Y, GreaterThanCondition(windowSize.height + margin));
     bottomNotification.NotifySignal().Connect(this, &ExampleController::OnHitBottomWall);
 
+    if(gUseBrickGrid)
+    {
+      mBrickGrid = std::make_unique<BrickGrid>(mBall.GetProperty<int>(Actor::Property::ID), margin, MakeCallback(this, &ExampleController::OnBrickGridHit));
+      DevelStage::AddFrameCallback(Stage::GetCurrent(), *mBrickGrid, mContentLayer);
+
+      mGridStatsTimer = Timer::New(GRID_STATS_INTERVAL);
+      mGridStatsTimer.TickSignal().Connect(this, &ExampleController::OnGridStatsTick);
+      mGridStatsTimer.Start();
+    }
+
     // Set up notification for ball colliding against paddle.
     Actor delegate = Actor::New();
     window.Add(delegate);
@@ -344,6 +607,18 @@ private:
     RestartGame();
   }
 
+  /**
+   * Moves the ball back to its start position
+   */
+  void ResetBall()
+  {
+    mBall.SetProperty(Actor::Property::POSITION, mBallStartPosition);
+    if(mBrickGrid)
+    {
+      mBrickGrid->Teleport(Vector2(mBallStartPosition.x, mBallStartPosition.y));
+    }
+  }
+
   /**
    * Restarts Game
    * Resets Lives count and other stats, and loads level
@@ -352,7 +627,7 @@ private:
   {
     mLives = TOTAL_LIVES;
     mLevel = 0;
-    mBall.SetProperty(Actor::Property::POSITION, mBallStartPosition);
+    ResetBall();
     mBallVelocity = Vector3::ZERO;
     mPaddle.SetProperty(Actor::Property::SIZE, mPaddleFullSize + mPaddleHitMargin);
     mPaddleImage.SetProperty(Actor::Property::SIZE, mPaddleFullSize);
@@ -384,8 +659,7 @@ private:
 
     if(mBrickImageMap.Empty())
     {
-      Vector2       windowSize(mApplication.GetWindow().GetSize());
-      const Vector2 brickSize(BRICK_SIZE * Vector2(windowSize.x, windowSize.x));
+      const Vector2 brickSize(GetBrickSize());
 
       mBrickImageMap["desiredWidth"]  = static_cast<int>(brickSize.width);
       mBrickImageMap["desiredHeight"] = static_cast<int>(brickSize.height);
@@ -393,6 +667,14 @@ private:
       mBrickImageMap["samplingMode"]  = "BOX_THEN_LINEAR";
     }
 
+    if(gUseBrickGrid)
+    {
+      int     columns, rows;
+      Vector2 offset;
+      GetBrickLayout(columns, rows, offset);
+      mGridBricks.assign(columns * rows, Actor());
+    }
+
     switch(level % TOTAL_LEVELS)
     {
       case 0:
@@ -415,6 +697,47 @@ private:
         break;
       }
     } // end switch
+
+    if(gUseBrickGrid)
+    {
+      int     columns, rows;
+      Vector2 offset;
+      GetBrickLayout(columns, rows, offset);
+
+      std::vector<uint8_t> cells(mGridBricks.size());
+      for(size_t i = 0; i < mGridBricks.size(); ++i)
+      {
+        cells[i] = mGridBricks[i] ? 1u : 0u;
+      }
+      mBrickGrid->SetLevel(offset, GetBrickSize(), columns, rows, std::move(cells));
+    }
+
+    DALI_LOG_RELEASE_INFO("Blocks: level %d, %d bricks, %s\n", level, mBrickCount, gUseBrickGrid ? "brick grid" : "constraint per brick");
+  }
+
+  /**
+   * Returns the size of a brick
+   */
+  Vector2 GetBrickSize() const
+  {
+    const float windowWidth = mApplication.GetWindow().GetSize().GetWidth();
+    return BRICK_SIZE * windowWidth / static_cast<float>(gBrickScale);
+  }
+
+  /**
+   * Calculates the layout of the bricks shared by all levels
+   * @param[out] columns Number of columns of bricks
+   * @param[out] rows Number of rows of bricks
+   * @param[out] offset Position of the top left corner of the bricks
+   */
+  void GetBrickLayout(int& columns, int& rows, Vector2& offset) const
+  {
+    Vector2       windowSize(mApplication.GetWindow().GetSize());
+    const Vector2 brickSize(GetBrickSize());
+
+    columns = (0.85f * windowSize.width) / brickSize.width;  // 85 percent of the width of the screen covered with bricks.
+    rows    = (0.3f * windowSize.height) / brickSize.height; // 30 percent of the height of the screen covered with bricks.
+    offset  = Vector2((windowSize.x - (columns * brickSize.width)) * 0.5f, windowSize.y * 0.125f);
   }
 
   /**
@@ -422,13 +745,11 @@ private:
    */
   void GenerateLevel0()
   {
-    Vector2       windowSize(mApplication.GetWindow().GetSize());
-    const Vector2 brickSize(BRICK_SIZE * windowSize.width);
+    const Vector2 brickSize(GetBrickSize());
 
-    const int     columns = (0.85f * windowSize.width) / brickSize.width;  // 85 percent of the width of the screen covered with bricks.
-    const int     rows    = (0.3f * windowSize.height) / brickSize.height; // 30 percent of the height of the screen covered with bricks.
-    const Vector2 offset((windowSize.x - (columns * brickSize.width)) * 0.5f,
-                         windowSize.y * 0.125f);
+    int     columns, rows;
+    Vector2 offset;
+    GetBrickLayout(columns, rows, offset);
 
     for(int j = 0; j < rows; j++)
     {
@@ -446,13 +767,11 @@ private:
    */
   void GenerateLevel1()
   {
-    Vector2       windowSize(mApplication.GetWindow().GetSize());
-    const Vector2 brickSize(BRICK_SIZE * windowSize.width);
+    const Vector2 brickSize(GetBrickSize());
 
-    const int     columns = (0.85f * windowSize.width) / brickSize.width;  // 85 percent of the width of the screen covered with bricks.
-    const int     rows    = (0.3f * windowSize.height) / brickSize.height; // 30 percent of the height of the screen covered with bricks.
-    const Vector2 offset((windowSize.x - (columns * brickSize.width)) * 0.5f,
-                         windowSize.y * 0.125f);
+    int     columns, rows;
+    Vector2 offset;
+    GetBrickLayout(columns, rows, offset);
 
     for(int j = 0; j < rows; j++)
     {
@@ -475,13 +794,11 @@ private:
    */
   void GenerateLevel2()
   {
-    Vector2       windowSize(mApplication.GetWindow().GetSize());
-    const Vector2 brickSize(BRICK_SIZE * windowSize.width);
+    const Vector2 brickSize(GetBrickSize());
 
-    const int     columns = (0.85f * windowSize.width) / brickSize.width;  // 85 percent of the width of the screen covered with bricks.
-    const int     rows    = (0.3f * windowSize.height) / brickSize.height; // 30 percent of the height of the screen covered with bricks.
-    const Vector2 offset((windowSize.x - (columns * brickSize.width)) * 0.5f,
-                         windowSize.y * 0.125f);
+    int     columns, rows;
+    Vector2 offset;
+    GetBrickLayout(columns, rows, offset);
 
     // lays down bricks in a spiral formation starting at i,j = (0,0) top left corner
     // travelling right di,dj = (1,0) initially
@@ -556,6 +873,22 @@ private:
     brick.SetProperty(Actor::Property::ANCHOR_POINT, AnchorPoint::CENTER);
     brick.SetProperty(Actor::Property::POSITION, position);
 
+    if(gUseBrickGrid)
+    {
+      // The brick grid tests the ball against all the bricks in a frame callback
+      int     columns, rows;
+      Vector2 offset;
+      GetBrickLayout(columns, rows, offset);
+      const Vector2 brickSize(GetBrickSize());
+      const int     column = static_cast<int>((position.x - offset.x) / brickSize.width);
+      const int     row    = static_cast<int>((position.y - offset.y) / brickSize.height);
+      if(column >= 0 && column < columns && row >= 0 && row < rows)
+      {
+        mGridBricks[row * columns + column] = brick;
+      }
+      return brick;
+    }
+
     // Add a constraint on the brick between it and the ball generating a collision-property
     Property::Index property   = brick.RegisterProperty(COLLISION_PROPERTY_NAME, Vector3::ZERO);
     Constraint      constraint = Constraint::New<Vector3>(brick, property, CollisionCircleRectangleConstraint(BRICK_COLLISION_MARGIN));
@@ -722,7 +1055,7 @@ private:
   void OnPaddleShrunk(Animation& source)
   {
     // Reposition Ball in start position, and make ball appear.
-    mBall.SetProperty(Actor::Property::POSITION, mBallStartPosition);
+    ResetBall();
     mBall.SetProperty(Actor::Property::COLOR, Vector4(1.0f, 1.0f, 1.0f, 0.1f));
     Animation appear = Animation::New(0.5f);
     appear.AnimateTo(Property(mBall, Actor::Property::COLOR), Vector4(1.0f, 1.0f, 1.0f, 1.0f));
@@ -778,6 +1111,57 @@ private:
     Actor   brick           = Actor::DownCast(source.GetTarget());
     Vector3 collisionVector = brick.GetCurrentProperty<Vector3>(source.GetTargetProperty());
 
+    BounceOffBrick(collisionVector);
+
+    // remove collision-constraint and notification.
+    brick.RemovePropertyNotification(source);
+    brick.RemoveConstraints();
+
+    DestroyBrick(brick);
+  }
+
+  /**
+   * Called on the event thread when the brick grid reports hits
+   */
+  void OnBrickGridHit()
+  {
+    std::vector<BrickGrid::Hit> hits;
+    mBrickGrid->TakeHits(hits);
+
+    for(const auto& hit : hits)
+    {
+      if(hit.cell < static_cast<int>(mGridBricks.size()) && mGridBricks[hit.cell])
+      {
+        Actor brick = mGridBricks[hit.cell];
+        mGridBricks[hit.cell].Reset();
+
+        BounceOffBrick(Vector3(hit.collisionVector.x, hit.collisionVector.y, 0.0f));
+        DestroyBrick(brick);
+      }
+    }
+  }
+
+  /**
+   * Logs the average cost of the brick grid per frame
+   */
+  bool OnGridStatsTick()
+  {
+    uint32_t frames;
+    uint64_t updateTimeUs;
+    mBrickGrid->ResetStats(frames, updateTimeUs);
+    if(frames)
+    {
+      DALI_LOG_RELEASE_INFO("Blocks: brick grid %.1f us/frame, %d bricks left\n", static_cast<float>(updateTimeUs) / frames, mBrickCount);
+    }
+    return true;
+  }
+
+  /**
+   * Reflects the ball velocity off a brick
+   * @param[in] collisionVector Normalized vector from the brick to the ball
+   */
+  void BounceOffBrick(const Vector3& collisionVector)
+  {
     const float normalVelocity = fabsf(mBallVelocity.Dot(collisionVector));
     mBallVelocity += collisionVector * normalVelocity * 2.0f;
     const float currentSpeed = mBallVelocity.Length();
@@ -785,11 +1169,13 @@ private:
     mBallVelocity            = mBallVelocity * limitedSpeed / currentSpeed;
 
     ContinueAnimation();
+  }
 
-    // remove collision-constraint and notification.
-    brick.RemovePropertyNotification(source);
-    brick.RemoveConstraints();
-
+  /**
+   * Fades out a brick, which is removed once the animation finishes
+   */
+  void DestroyBrick(Actor brick)
+  {
     // fade brick (destroy)
     Animation destroyAnimation = Animation::New(0.5f);
     destroyAnimation.AnimateTo(Property(brick, Actor::Property::COLOR_ALPHA), 0.0f, AlphaFunction::EASE_IN);
@@ -858,10 +1244,39 @@ private:
   int                        mLevel;               ///< Current level
   int                        mLives;               ///< Total lives.
   int                        mBrickCount;          ///< Total bricks on screen.
+
+  // brick grid level engine
+
+  std::unique_ptr<BrickGrid> mBrickGrid;      ///< Tests the ball against the bricks, if enabled
+  std::vector<Actor>         mGridBricks;     ///< Brick actor of each cell of the grid, empty if none
+  Timer                      mGridStatsTimer; ///< Logs the cost of the brick grid
 };
 
 int DALI_EXPORT_API main(int argc, char** argv)
 {
+  for(int i(1); i < argc; ++i)
+  {
+    std::string arg(argv[i]);
+    if(arg.compare("--grid") == 0)
+    {
+      gUseBrickGrid = true;
+    }
+    else if(arg.compare(0, 2, "-s") == 0)
+    {
+      gBrickScale = std::max(1, atoi(arg.substr(2, arg.size()).c_str()));
+    }
+    else if((arg.compare("--help") == 0) || (arg.compare("-h") == 0))
+    {
+      std::cout << "blocks.example [OPTIONS]" << std::endl;
+      std::cout << "  Options:" << std::endl;
+      std::cout << "    --grid      Tests the ball against a grid of bricks in a single frame callback" << std::endl;
+      std::cout << "                instead of a constraint and a notification per brick" << std::endl;
+      std::cout << "    -s[scale]   Makes bricks [scale] times smaller, i.e. -s4 for 16 times more bricks" << std::endl;
+      std::cout << "    -h|--help   Help" << std::endl;
+      return 0;
+    }
+  }
+
   Application       app = Application::New(&argc, &argv, DEMO_THEME_PATH);
   ExampleController test(app);
   app.MainLoop();
@@ -22,7 +22,6 @@
 
 #include <dali-toolkit/dali-toolkit.h>
 #include <dali-toolkit/devel-api/builder/builder.h>
-#include <dali-toolkit/devel-api/builder/json-parser.h>
 #include <dali-toolkit/devel-api/builder/tree-node.h>
 #include <dali-toolkit/devel-api/controls/navigation-view/navigation-view.h>
 #include <dali-toolkit/devel-api/controls/popup/popup.h>
@@ -30,6 +29,7 @@
 
 #include <dirent.h>
 #include <stdio.h>
+#include <chrono>
 #include <fstream>
 #include <iostream>
 #include <map>
@@ -43,12 +43,15 @@
 
 #include <dali/devel-api/adaptor-framework/file-loader.h>
 #include <dali/integration-api/debug.h>
+#include "shared/builder-script-cache.h"
 #include "shared/view.h"
+#include "shared/utility.h"
 
 #define TOKEN_STRING(x) #x
 
 using namespace Dali;
 using namespace Dali::Toolkit;
+using DemoHelper::MillisecondsSince;
 
 namespace
 {
@@ -58,6 +61,9 @@ const char* EDIT_IMAGE(DEMO_IMAGE_DIR "icon-change.png");
 const char* EDIT_IMAGE_SELECTED(DEMO_IMAGE_DIR "icon-change-selected.png");
 
 std::string USER_DIRECTORY;
+std::string CACHE_DIRECTORY(BuilderScript::Cache::GetDefaultDirectory());
+
+using Clock = std::chrono::steady_clock;
 
 std::string JSON_BROKEN(
   "                                      \
@@ -238,7 +244,8 @@ class ExampleApp : public ConnectionTracker, public Toolkit::ItemFactory
 {
 public:
   ExampleApp(Application& app)
-  : mApp(app)
+  : mApp(app),
+    mScriptCache(CACHE_DIRECTORY)
   {
     app.InitSignal().Connect(this, &ExampleApp::Create);
   }
@@ -301,41 +308,31 @@ public:
 
     std::sort(files.begin(), files.end());
 
+    // The scripts are only parsed the first time they are listed, then read from the cache
+    const Clock::time_point start  = Clock::now();
+    unsigned int            cached = 0u;
     for(FileList::iterator iter = files.begin(); iter != files.end(); ++iter)
     {
-      JsonParser parser = JsonParser::New();
-
-      std::string data(GetFileContents(*iter));
-
-      parser.Parse(data);
-
-      if(parser.ParseError())
+      BuilderScript::Script script;
+      if(!mScriptCache.Load(GetFileContents(*iter), script))
       {
         std::cout << "Parser Error:" << *iter << std::endl;
-        std::cout << parser.GetErrorLineNumber() << "(" << parser.GetErrorColumn() << "):" << parser.GetErrorDescription() << std::endl;
+        std::cout << script.error << std::endl;
         exit(1);
       }
+      cached += script.fromCache ? 1u : 0u;
 
-      if(parser.GetRoot())
+      // only those with a stage section
+      if(script.stageNodes)
       {
-        if(const TreeNode* node = parser.GetRoot()->Find("stage"))
-        {
-          // only those with a stage section
-          if(node->Size())
-          {
-            mFiles.push_back(*iter);
-          }
-          else
-          {
-            std::cout << "Ignored file (stage has no nodes?):" << *iter << std::endl;
-          }
-        }
-        else
-        {
-          std::cout << "Ignored file (no stage section):" << *iter << std::endl;
-        }
+        mFiles.push_back(*iter);
+      }
+      else
+      {
+        std::cout << "Ignored file (no stage nodes):" << *iter << std::endl;
       }
     }
+    std::cout << "Listed " << files.size() << " scripts (" << cached << " cached) in " << MillisecondsSince(start) << "ms" << std::endl;
 
     // Activate the layout
     Vector3 size(window.GetSize());
@@ -365,13 +362,17 @@ public:
   {
     if(mFileWatcher.FileHasChanged())
     {
-      LoadFromFile(mFileWatcher.GetFilename());
+      LoadFromFile(mFileWatcher.GetFilename(), false);
     }
 
     return true;
   }
 
-  void ReloadJsonFile(const std::string& filename, Builder& builder, Layer& layer)
+  /**
+   * @param[in] cached Whether to read the compiled script from the cache. Each save of an edited
+   *                   script changes it, so the cache would only parse it twice and keep every version.
+   */
+  void ReloadJsonFile(const std::string& filename, Builder& builder, Layer& layer, bool cached)
   {
     Window window = mApp.GetWindow();
 
@@ -415,17 +416,29 @@ public:
       layer.Remove(layer.GetChildAt(0));
     }
 
-    std::string data(GetFileContents(filename));
+    const Clock::time_point start = Clock::now();
+
+    BuilderScript::Script script;
+    if(cached)
+    {
+      mScriptCache.Load(GetFileContents(filename), script);
+    }
+    else
+    {
+      script.text = GetFileContents(filename);
+    }
 
     try
     {
-      builder.LoadFromString(data);
+      builder.LoadFromString(script.text);
     }
     catch(...)
     {
       builder.LoadFromString(ReplaceQuotes(JSON_BROKEN));
     }
 
+    std::cout << "Loaded " << ShortName(filename) << (script.fromCache ? " from the cache" : " from the text") << " in " << MillisecondsSince(start) << "ms" << std::endl;
+
     builder.AddActors(layer);
   }
 
@@ -435,13 +448,13 @@ public:
     {
       const std::string& name = mFiles[index];
       mFileWatcher.SetFilename(name);
-      LoadFromFile(name);
+      LoadFromFile(name, true);
     }
   }
 
-  void LoadFromFile(const std::string& name)
+  void LoadFromFile(const std::string& name, bool cached)
   {
-    ReloadJsonFile(name, mBuilder, mBuilderLayer);
+    ReloadJsonFile(name, mBuilder, mBuilderLayer, cached);
 
     mBuilderLayer.SetProperty(Actor::Property::PARENT_ORIGIN, ParentOrigin::BOTTOM_CENTER);
     mBuilderLayer.SetProperty(Actor::Property::ANCHOR_POINT, AnchorPoint::BOTTOM_CENTER);
@@ -564,6 +577,8 @@ private:
 
   FileList mFiles;
 
+  BuilderScript::Cache mScriptCache;
+
   FileWatcher mFileWatcher;
   Timer       mTimer;
 };
@@ -575,11 +590,16 @@ private:
 //------------------------------------------------------------------------------
 int DALI_EXPORT_API main(int argc, char** argv)
 {
-  if(argc > 2)
+  for(int i = 1; i + 1 < argc; i += 2)
   {
-    if(strcmp(argv[1], "-f") == 0)
+    if(strcmp(argv[i], "-f") == 0)
+    {
+      USER_DIRECTORY = argv[i + 1];
+    }
+    else if(strcmp(argv[i], "-c") == 0)
     {
-      USER_DIRECTORY = argv[2];
+      // An empty directory parses the scripts every time
+      CACHE_DIRECTORY = argv[i + 1];
     }
   }
 
@@ -28,6 +28,7 @@ const char* TEXTURE_URL = DEMO_IMAGE_DIR "/wood.png";
 
 Dali::Geometry   CubeRenderer::gCubeGeometry;
 Dali::TextureSet CubeRenderer::gCubeTextureSet;
+Dali::Renderer   CubeRenderer::gCubeRenderer;
 
 Dali::Shader CreateShader()
 {
@@ -151,6 +152,18 @@ Dali::Renderer CubeRenderer::CreateRenderer(TextureSet textures)
  * Creates new actor and renderer.
  */
 Actor CubeRenderer::CreateActor(Vector3 size, Vector4 color)
+{
+  if(!gCubeTextureSet)
+  {
+    gCubeTextureSet = CreateTexture(TEXTURE_URL);
+  }
+  return CreateActor(size, color, CreateRenderer(gCubeTextureSet));
+}
+
+/**
+ * Creates new actor using the given renderer.
+ */
+Actor CubeRenderer::CreateActor(Vector3 size, Vector4 color, Renderer renderer)
 {
   Actor actor = Actor::New();
   actor.SetProperty(Actor::Property::ANCHOR_POINT, AnchorPoint::CENTER);
@@ -159,15 +172,23 @@ Actor CubeRenderer::CreateActor(Vector3 size, Vector4 color)
   // Mesh is 2x2x2, so halve the size
   actor.SetProperty(Actor::Property::SIZE, Vector3(size.x, size.y, size.z) * 0.5f);
   actor.SetProperty(Actor::Property::COLOR, color);
-  if(!gCubeTextureSet)
-  {
-    gCubeTextureSet = CreateTexture(TEXTURE_URL);
-  }
-  Renderer renderer = CreateRenderer(gCubeTextureSet);
   actor.AddRenderer(renderer);
   return actor;
 }
 
+Renderer CubeRenderer::GetSharedRenderer()
+{
+  if(!gCubeRenderer)
+  {
+    if(!gCubeTextureSet)
+    {
+      gCubeTextureSet = CreateTexture(TEXTURE_URL);
+    }
+    gCubeRenderer = CreateRenderer(gCubeTextureSet);
+  }
+  return gCubeRenderer;
+}
+
 Actor CubeRenderer::CreateActor(Vector3 size, std::string url)
 {
   Actor actor = Actor::New();
@@ -39,6 +39,18 @@ public:
   static Dali::Actor CreateActor(Dali::Vector3 size, Dali::Vector4 color);
   static Dali::Actor CreateActor(Dali::Vector3 size, std::string url);
 
+  /**
+   * Creates an actor drawn by the given renderer, so many actors can share a single one.
+   * The color is set on the actor and doesn't affect the renderer.
+   */
+  static Dali::Actor CreateActor(Dali::Vector3 size, Dali::Vector4 color, Dali::Renderer renderer);
+
+  /**
+   * Returns a renderer using the default texture, created on first use and shared by all callers.
+   */
+  static Dali::Renderer GetSharedRenderer();
+
   static Geometry   gCubeGeometry;
   static TextureSet gCubeTextureSet;
+  static Renderer   gCubeRenderer;
 };
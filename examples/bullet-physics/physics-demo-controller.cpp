@@ -20,15 +20,22 @@
 #include "dali-physics/public-api/physics-adaptor.h"
 
 #include <dali/devel-api/adaptor-framework/key-devel.h>
+#include <dali/devel-api/common/stage.h>
 #include <dali/devel-api/events/hit-test-algorithm.h>
+#include <dali/integration-api/debug.h>
 
+#include <algorithm>
+#include <iomanip>
 #include <iostream>
+#include <memory>
+#include <sstream>
 #include <string>
 
 #include <btBulletDynamicsCommon.h>
 
 #include "ball-renderer.h"
 #include "cube-renderer.h"
+#include "shared/physics-step-timer.h"
 
 using namespace Dali;
 using namespace Dali::Toolkit::Physics;
@@ -54,6 +61,32 @@ const std::string BALL_IMAGE    = DEMO_IMAGE_DIR "/blocks-ball.png";
 const std::string BRICK_URIS[4] = {
   DEMO_IMAGE_DIR "/blocks-brick-1.png", DEMO_IMAGE_DIR "/blocks-brick-2.png", DEMO_IMAGE_DIR "/blocks-brick-3.png", DEMO_IMAGE_DIR "/blocks-brick-4.png"};
 
+const uint32_t STATS_INTERVAL{1000}; ///< Milliseconds between two updates of the statistics overlay
+
+int gPyramidRows(10); ///< Number of rows of the brick pyramid, modifiable with the --rows option
+
+/**
+ * Times the step of the world with its internal tick callbacks, which run for every simulation
+ * substep. The rest of the physics adaptor time is mostly the sync of the actors.
+ * @param[in] world The world, whose user info becomes the timer
+ * @param[in] timer The timer of the physics adaptor
+ */
+void AttachStepTimer(btDynamicsWorld* world, DemoHelper::PhysicsStepTimer& timer)
+{
+  world->setInternalTickCallback(
+    [](btDynamicsWorld* world, btScalar timeStep) {
+      static_cast<DemoHelper::PhysicsStepTimer*>(world->getWorldUserInfo())->StartStep();
+    },
+    &timer,
+    true);
+  world->setInternalTickCallback(
+    [](btDynamicsWorld* world, btScalar timeStep) {
+      static_cast<DemoHelper::PhysicsStepTimer*>(world->getWorldUserInfo())->EndStep();
+    },
+    &timer,
+    false);
+}
+
 class PhysicsDemoController : public ConnectionTracker
 {
 public:
@@ -89,8 +122,12 @@ public:
                                              windowSize.GetHeight() * 0.5f,
                                              -100.0f));
 
+    mStepTimer = std::make_unique<DemoHelper::PhysicsStepTimer>();
+    mStepTimer->AddStartCallback(mWindow.GetRootLayer());
+
     mPhysicsAdaptor = PhysicsAdaptor::New(mPhysicsTransform, windowSize);
     mPhysicsRoot    = mPhysicsAdaptor.GetRootActor();
+    mStepTimer->AddEndCallback(mWindow.GetRootLayer());
 
     mPhysicsRoot.TouchedSignal().Connect(this, &PhysicsDemoController::OnTouched);
     mPhysicsRoot.WheelEventSignal().Connect(this, &PhysicsDemoController::OnWheel);
@@ -108,7 +145,63 @@ public:
     CreateBall(scopedAccessor);
     CreateBrickPyramid(scopedAccessor, windowSize);
 
+    AttachStepTimer(bulletWorld, *mStepTimer);
+
     mPhysicsAdaptor.CreateSyncPoint();
+
+    mStatsLabel                                           = Toolkit::TextLabel::New();
+    mStatsLabel[Actor::Property::PARENT_ORIGIN]           = ParentOrigin::TOP_LEFT;
+    mStatsLabel[Actor::Property::ANCHOR_POINT]            = AnchorPoint::TOP_LEFT;
+    mStatsLabel[Toolkit::TextLabel::Property::TEXT_COLOR] = Color::WHITE;
+    mStatsLabel[Toolkit::TextLabel::Property::MULTI_LINE] = true;
+    mStatsLabel[Toolkit::TextLabel::Property::POINT_SIZE] = 10.0f;
+    mStatsLabel[Actor::Property::SENSITIVE]               = false;
+    mWindow.Add(mStatsLabel);
+
+    mStatsTimer = Timer::New(STATS_INTERVAL);
+    mStatsTimer.TickSignal().Connect(this, &PhysicsDemoController::OnStatsTick);
+    mStatsTimer.Start();
+  }
+
+  bool OnStatsTick()
+  {
+    const DemoHelper::PhysicsStepTimer::Sample step    = mStepTimer->Reset();
+    const uint32_t                             frames  = step.frames;
+    const uint64_t                             totalUs = step.totalUs;
+    const uint64_t                             stepUs  = step.stepUs;
+
+    int bodies = 0;
+    int active = 0;
+    {
+      auto  scopedAccessor = mPhysicsAdaptor.GetPhysicsAccessor();
+      auto  bulletWorld    = scopedAccessor->GetNative().Get<btDiscreteDynamicsWorld*>();
+      auto& objects        = bulletWorld->getCollisionObjectArray();
+      for(int i = 0; i < objects.size(); ++i)
+      {
+        if(!objects[i]->isStaticObject())
+        {
+          ++bodies;
+          active += objects[i]->isActive() ? 1 : 0;
+        }
+      }
+    }
+
+    const float stepMs = frames ? stepUs / 1000.0f / frames : 0.0f;
+    const float syncMs = frames ? (totalUs - std::min(totalUs, stepUs)) / 1000.0f / frames : 0.0f;
+
+    std::ostringstream oss;
+    oss << std::fixed << std::setprecision(2)
+        << "Step: " << stepMs << " ms, sync: " << syncMs << " ms, " << frames << " frames/s\n"
+        << "Bodies: " << bodies << " (" << bodies - active << " sleeping), " << gPyramidRows << " rows";
+    mStatsLabel[Toolkit::TextLabel::Property::TEXT] = oss.str();
+
+    DALI_LOG_RELEASE_INFO("Physics: step %.2f ms, sync %.2f ms over %u frames, %d bodies (%d sleeping)\n",
+                          stepMs,
+                          syncMs,
+                          frames,
+                          bodies,
+                          bodies - active);
+    return true;
   }
 
   btRigidBody* CreateRigidBody(btDiscreteDynamicsWorld* bulletWorld, float mass, const btTransform& bulletTransform, btCollisionShape* shape)
@@ -170,10 +263,16 @@ public:
   {
     btVector3   halfExtents(size.width * 0.5f, size.height * 0.5f, size.depth * 0.5f);
     btBoxShape* shape = new btBoxShape(halfExtents); // @todo Fix leak
-    btVector3   inertia;
-    inertia.setZero();
-    shape->calculateLocalInertia(mass, inertia);
+    return CreateBrick(scopedAccessor, actor, mass, elasticity, friction, shape);
+  }
 
+  PhysicsActor CreateBrick(PhysicsAdaptor::ScopedPhysicsAccessorPtr& scopedAccessor,
+                           Dali::Actor                               actor,
+                           float                                     mass,
+                           float                                     elasticity,
+                           float                                     friction,
+                           btCollisionShape*                         shape)
+  {
     btTransform startTransform;
     startTransform.setIdentity();
     auto         bulletWorld = scopedAccessor->GetNative().Get<btDiscreteDynamicsWorld*>();
@@ -216,7 +315,12 @@ public:
 
     Dali::Vector4 colors[5] = {Dali::Color::AQUA_MARINE, Dali::Color::DARK_SEA_GREEN, Dali::Color::BLUE_VIOLET, Dali::Color::MISTY_ROSE, Dali::Color::ORCHID};
 
-    int numberOfRows = 10;
+    // All the bricks have the same size, so they share the collision shape and the renderer
+    const Vector3 brickSize(BRICK_WIDTH, BRICK_HEIGHT, BRICK_DEPTH);
+    mBrickShape       = std::make_unique<btBoxShape>(btVector3(brickSize.width * 0.5f, brickSize.height * 0.5f, brickSize.depth * 0.5f));
+    Renderer renderer = CubeRenderer::GetSharedRenderer();
+
+    int numberOfRows = gPyramidRows;
     int oY           = -(1 + numberOfRows) * (BRICK_HEIGHT + BRICK_GAP);
     for(int i = 0; i < numberOfRows; ++i)
     {
@@ -224,8 +328,8 @@ public:
       float oX = w * -0.5f;
       for(int j = 0; j < i + 1; ++j)
       {
-        auto brick        = CubeRenderer::CreateActor(Vector3(BRICK_WIDTH, BRICK_HEIGHT, BRICK_DEPTH), colors[(i + j) % 5]);
-        auto physicsActor = CreateBrick(scopedAccessor, brick, BRICK_MASS, BRICK_ELASTICITY, BRICK_FRICTION, Vector3(BRICK_WIDTH, BRICK_HEIGHT, BRICK_DEPTH));
+        auto brick        = CubeRenderer::CreateActor(brickSize, colors[(i + j) % 5], renderer);
+        auto physicsActor = CreateBrick(scopedAccessor, brick, BRICK_MASS, BRICK_ELASTICITY, BRICK_FRICTION, mBrickShape.get());
 
         physicsActor.AsyncSetPhysicsPosition(Vector3(oX + j * (BRICK_WIDTH + BRICK_GAP), oY + i * (BRICK_HEIGHT + BRICK_GAP), -300.0f));
         // Create slight rotation offset to trigger automatic collapse
@@ -253,6 +357,10 @@ public:
 
   void OnTerminate(Application& application)
   {
+    if(mStepTimer)
+    {
+      mStepTimer->RemoveCallbacks();
+    }
     UnparentAndReset(mPhysicsRoot);
   }
 
@@ -622,12 +730,13 @@ private:
   Application& mApplication;
   Window       mWindow;
 
-  Matrix         mPhysicsTransform;
-  PhysicsAdaptor mPhysicsAdaptor;
-  Actor          mPhysicsRoot;
-  Layer          mPhysicsDebugLayer;
-  PhysicsActor   mBrick;
-  PhysicsActor   mSelectedActor;
+  Matrix                      mPhysicsTransform;
+  std::unique_ptr<btBoxShape> mBrickShape; ///< Shared by all the pyramid bricks, must outlive the world
+  PhysicsAdaptor              mPhysicsAdaptor;
+  Actor                       mPhysicsRoot;
+  Layer                       mPhysicsDebugLayer;
+  PhysicsActor                mBrick;
+  PhysicsActor                mSelectedActor;
 
   btRigidBody*                     mPickedBody{nullptr};
   float                            mOldPickingDistance{0.0f};
@@ -639,10 +748,31 @@ private:
   bool mCtrlDown{false};
   bool mAltDown{false};
   bool mShiftDown{false};
+
+  Timer                                         mStatsTimer;
+  Toolkit::TextLabel                            mStatsLabel;
+  std::unique_ptr<DemoHelper::PhysicsStepTimer> mStepTimer;
 };
 
 int main(int argc, char** argv)
 {
+  for(int i(1); i < argc; ++i)
+  {
+    std::string arg(argv[i]);
+    if(arg.compare("--rows") == 0 && i + 1 < argc)
+    {
+      gPyramidRows = std::max(1, atoi(argv[++i]));
+    }
+    else if((arg.compare("--help") == 0) || (arg.compare("-h") == 0))
+    {
+      std::cout << "bullet-physics.example [OPTIONS]" << std::endl;
+      std::cout << "  Options:" << std::endl;
+      std::cout << "    --rows N   Number of rows of the brick pyramid. Default is 10." << std::endl;
+      std::cout << "    -h|--help  Help" << std::endl;
+      return 0;
+    }
+  }
+
   Application           application = Application::New(&argc, &argv);
   PhysicsDemoController controller(application);
   application.MainLoop();
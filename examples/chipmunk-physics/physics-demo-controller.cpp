@@ -20,16 +20,21 @@
 #include <dali-toolkit/devel-api/visuals/image-visual-properties-devel.h>
 #include <dali-toolkit/devel-api/visuals/visual-properties-devel.h>
 #include <dali/devel-api/adaptor-framework/key-devel.h>
+#include <dali/devel-api/common/stage.h>
 #include <dali/devel-api/events/hit-test-algorithm.h>
 #include <dali/integration-api/debug.h>
 
 #include <chipmunk/chipmunk.h>
+#include <iomanip>
 #include <iostream>
+#include <memory>
+#include <sstream>
 #include <string>
 #include "letter-a.h"
 #include "letter-d.h"
 #include "letter-i.h"
 #include "letter-l.h"
+#include "shared/physics-step-timer.h"
 #include "split-letter-d.h"
 
 using namespace Dali;
@@ -41,6 +46,11 @@ Debug::Filter* gPhysicsDemo = Debug::Filter::New(Debug::Concise, false, "LOG_PHY
 
 const bool DEBUG_STATE{false};
 
+const uint32_t STATS_INTERVAL{1000}; ///< Milliseconds between two updates of the statistics overlay
+
+int gSolverIterations(0); ///< Chipmunk solver iterations, 0 keeps the default. Modifiable with the -i option
+int gBallCount(0);        ///< Number of balls, 0 to fit the window size. Modifiable with the -b option
+
 namespace KeyModifier
 {
 enum Key
@@ -121,6 +131,46 @@ static cpFloat SpringForce(cpConstraint* spring, cpFloat distance)
          cpDampedSpringGetStiffness(spring);
 }
 
+/**
+ * @brief Counts of the bodies and contacts of the space after the last step.
+ */
+struct SpaceStats
+{
+  uint32_t bodies{0u};
+  uint32_t sleeping{0u};
+  uint32_t arbiters{0u}; ///< Colliding shape pairs
+  uint32_t contacts{0u}; ///< Contact points of those pairs
+};
+
+static void CountArbiter(cpBody* body, cpArbiter* arbiter, void* data)
+{
+  // Each arbiter is on the list of both its bodies, static bodies aren't iterated
+  CP_ARBITER_GET_BODIES(arbiter, a, b);
+  cpBody* other = (a == body) ? b : a;
+  if(cpBodyGetType(other) == CP_BODY_TYPE_STATIC || body < other)
+  {
+    auto* stats = static_cast<SpaceStats*>(data);
+    ++stats->arbiters;
+    stats->contacts += cpArbiterGetCount(arbiter);
+  }
+}
+
+static void CountBody(cpBody* body, void* data)
+{
+  if(cpBodyGetType(body) == CP_BODY_TYPE_STATIC)
+  {
+    return;
+  }
+
+  auto* stats = static_cast<SpaceStats*>(data);
+  ++stats->bodies;
+  if(cpBodyIsSleeping(body))
+  {
+    ++stats->sleeping;
+  }
+  cpBodyEachArbiter(body, CountArbiter, data);
+}
+
 /**
  * @brief The physics demo using Chipmunk2D APIs.
  */
@@ -147,6 +197,9 @@ public:
     mWindow.SetBackgroundColor(Color::DARK_SLATE_GRAY);
     Window::WindowSize windowSize = mWindow.GetSize();
 
+    mStepTimer = std::make_unique<DemoHelper::PhysicsStepTimer>();
+    mStepTimer->AddStartCallback(mWindow.GetRootLayer());
+
     // Map Physics space (origin bottom left, +ve Y up)
     // to DALi space (origin center, +ve Y down)
     mPhysicsTransform.SetIdentityAndScale(Vector3(1.0f, -1.0f, 1.0f));
@@ -159,6 +212,8 @@ public:
     mPhysicsRoot.TouchedSignal().Connect(this, &PhysicsDemoController::OnTouched);
 
     mWindow.Add(mPhysicsRoot);
+    mStepTimer->AddEndCallback(mWindow.GetRootLayer());
+
     mPopcornTimer = Timer::New(7000);
     mPopcornTimer.TickSignal().Connect(this, &PhysicsDemoController::OnPopcornTick);
     mPopcornTimer.Start();
@@ -168,9 +223,18 @@ public:
 
     CreateBounds(space, windowSize);
 
+    if(gSolverIterations > 0)
+    {
+      cpSpaceSetIterations(space, gSolverIterations);
+    }
+
     // Ball area = 2*PI*26^2 ~= 6.28*26*26 ~= 5400
     // Fill top quarter of the screen...
     uint32_t numBalls = 10u + static_cast<uint32_t>(windowSize.GetWidth()) * static_cast<uint32_t>(windowSize.GetHeight()) / 20000;
+    if(gBallCount > 0)
+    {
+      numBalls = gBallCount;
+    }
     for(uint32_t i = 0; i < numBalls; ++i)
     {
       mBalls.push_back(CreateBall(space));
@@ -190,6 +254,55 @@ public:
       mPhysicsDebugLayer = mPhysicsAdaptor.CreateDebugLayer(mWindow);
       mPhysicsAdaptor.SetDebugState(PhysicsAdaptor::DebugState::ON);
     }
+
+    mStatsLabel = Toolkit::TextLabel::New();
+    mStatsLabel[Actor::Property::PARENT_ORIGIN]           = ParentOrigin::TOP_LEFT;
+    mStatsLabel[Actor::Property::ANCHOR_POINT]            = AnchorPoint::TOP_LEFT;
+    mStatsLabel[Toolkit::TextLabel::Property::TEXT_COLOR] = Color::WHITE;
+    mStatsLabel[Toolkit::TextLabel::Property::MULTI_LINE] = true;
+    mStatsLabel[Toolkit::TextLabel::Property::POINT_SIZE] = 10.0f;
+    mStatsLabel[Actor::Property::SENSITIVE]               = false;
+    mWindow.Add(mStatsLabel);
+
+    DALI_LOG_RELEASE_INFO("Physics: %u balls, %d solver iterations\n", numBalls, cpSpaceGetIterations(space));
+
+    mStatsTimer = Timer::New(STATS_INTERVAL);
+    mStatsTimer.TickSignal().Connect(this, &PhysicsDemoController::OnStatsTick);
+    mStatsTimer.Start();
+  }
+
+  bool OnStatsTick()
+  {
+    const DemoHelper::PhysicsStepTimer::Sample step    = mStepTimer->Reset();
+    const uint32_t                             frames  = step.frames;
+    const uint64_t                             totalUs = step.totalUs;
+    const uint64_t                             maxUs   = step.maxUs;
+
+    SpaceStats stats;
+    {
+      auto     scopedAccessor = mPhysicsAdaptor.GetPhysicsAccessor();
+      cpSpace* space          = scopedAccessor->GetNative().Get<cpSpace*>();
+      cpSpaceEachBody(space, CountBody, &stats);
+    }
+
+    const float averageMs = frames ? totalUs / 1000.0f / frames : 0.0f;
+
+    std::ostringstream oss;
+    oss << std::fixed << std::setprecision(2)
+        << "Step: " << averageMs << " ms avg, " << maxUs / 1000.0f << " ms max, " << frames << " frames/s\n"
+        << "Bodies: " << stats.bodies << " (" << stats.sleeping << " sleeping)\n"
+        << "Contacts: " << stats.contacts << " in " << stats.arbiters << " pairs";
+    mStatsLabel[Toolkit::TextLabel::Property::TEXT]       = oss.str();
+
+    DALI_LOG_RELEASE_INFO("Physics: step %.2f ms avg %.2f ms max over %u frames, %u bodies (%u sleeping), %u contacts in %u pairs\n",
+                          averageMs,
+                          maxUs / 1000.0f,
+                          frames,
+                          stats.bodies,
+                          stats.sleeping,
+                          stats.contacts,
+                          stats.arbiters);
+    return true;
   }
 
   PhysicsActor CreateBall(cpSpace* space)
@@ -395,6 +508,10 @@ public:
 
   void OnTerminate(Application& application)
   {
+    if(mStepTimer)
+    {
+      mStepTimer->RemoveCallbacks();
+    }
     UnparentAndReset(mPhysicsRoot);
   }
 
@@ -421,6 +538,7 @@ public:
       cpBodyActivate(body);
       cpBodyApplyImpulseAtLocalPoint(body, cpv(rand() % 200 - 100, -10000), cpv(0, 25));
     }
+    DALI_LOG_RELEASE_INFO("Physics: popcorn, impulse applied to %d balls\n", randValue);
     return true;
   }
 
@@ -681,6 +799,10 @@ private:
   cpConstraint*             mPickedConstraint{nullptr};
   int                       mPickedSavedState = -1; /// 0 : Active, 1 : Sleeping
   Timer                     mPopcornTimer;
+  Timer                     mStatsTimer;
+  Toolkit::TextLabel        mStatsLabel;
+
+  std::unique_ptr<DemoHelper::PhysicsStepTimer> mStepTimer;
 
   PhysicsAdaptor::DebugState mDebugState{PhysicsAdaptor::DebugState::OFF};
 
@@ -696,6 +818,28 @@ private:
 
 int DALI_EXPORT_API main(int argc, char** argv)
 {
+  for(int i(1); i < argc; ++i)
+  {
+    std::string arg(argv[i]);
+    if(arg.compare(0, 2, "-i") == 0)
+    {
+      gSolverIterations = atoi(arg.substr(2, arg.size()).c_str());
+    }
+    else if(arg.compare(0, 2, "-b") == 0)
+    {
+      gBallCount = atoi(arg.substr(2, arg.size()).c_str());
+    }
+    else if((arg.compare("--help") == 0) || (arg.compare("-h") == 0))
+    {
+      std::cout << "chipmunk-physics.example [OPTIONS]" << std::endl;
+      std::cout << "  Options:" << std::endl;
+      std::cout << "    -i[iterations]  Chipmunk solver iterations, i.e. -i20. Default is 10." << std::endl;
+      std::cout << "    -b[balls]       Number of balls, i.e. -b1000. Default depends on the window size." << std::endl;
+      std::cout << "    -h|--help       Help" << std::endl;
+      return 0;
+    }
+  }
+
   Application           application = Application::New(&argc, &argv);
   PhysicsDemoController controller(application);
   application.MainLoop();
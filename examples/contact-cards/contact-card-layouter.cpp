@@ -18,6 +18,12 @@
 // CLASS HEADER
 #include "contact-card-layouter.h"
 
+// EXTERNAL INCLUDES
+#include <dali/public-api/adaptor-framework/key.h>
+#include <dali/public-api/events/key-event.h>
+#include <dali/public-api/events/tap-gesture.h>
+#include <cmath>
+
 // INTERNAL INCLUDES
 #include "contact-card.h"
 
@@ -42,8 +48,16 @@ const float FOLDED_TEXT_POSITION_AS_RATIO_OF_IMAGE_SIZE(1.01f);
 ContactCardLayouter::ContactCardLayouter()
 : mContactCardLayoutInfo(),
   mContactCards(),
+  mLayer(),
+  mFoldedCards(),
+  mOverlay(),
+  mTapDetector(),
+  mAnimation(),
+  mUnfoldedCards(),
+  mAnimatingCards(),
   mLastPosition(),
   mPositionIncrementer(),
+  mWindowSize(),
   mItemsPerRow(0),
   mInitialized(false)
 {
@@ -51,51 +65,237 @@ ContactCardLayouter::ContactCardLayouter()
 
 ContactCardLayouter::~ContactCardLayouter()
 {
-  // Nothing to do as ContactCardContainer uses intrusive pointers so they will be automatically deleted
+  // ContactCardContainer uses intrusive pointers so they will be automatically deleted
+  if(mLayer)
+  {
+    mLayer.Unparent();
+  }
 }
 
 void ContactCardLayouter::AddContact(Dali::Window window, const std::string& contactName, const std::string& contactAddress, const std::string& imagePath)
 {
   if(!mInitialized)
   {
-    // Set up the common layouting info shared between all contact cards when first called
+    Initialize(window);
+  }
+
+  // Create a new contact card and add to our container
+  mContactCards.push_back(new ContactCard(mFoldedCards, mContactCardLayoutInfo, contactName, contactAddress, imagePath, NextCardPosition()));
+}
+
+void ContactCardLayouter::Initialize(Dali::Window window)
+{
+  // Set up the common layouting info shared between all contact cards when first called
+  mWindowSize = Vector2(window.GetSize());
+
+  mContactCardLayoutInfo.unfoldedPosition = mContactCardLayoutInfo.padding = Vector2(DEFAULT_PADDING, DEFAULT_PADDING);
+  mContactCardLayoutInfo.unfoldedSize                                      = mWindowSize - mContactCardLayoutInfo.padding * (MINIMUM_ITEMS_PER_ROW_OR_COLUMN - 1.0f);
+
+  // Calculate the size of the folded card (use the minimum of width/height as size)
+  mContactCardLayoutInfo.foldedSize       = (mContactCardLayoutInfo.unfoldedSize - (mContactCardLayoutInfo.padding * (MINIMUM_ITEMS_PER_ROW_OR_COLUMN - 1.0f))) / MINIMUM_ITEMS_PER_ROW_OR_COLUMN;
+  mContactCardLayoutInfo.foldedSize.width = mContactCardLayoutInfo.foldedSize.height = std::min(mContactCardLayoutInfo.foldedSize.width, mContactCardLayoutInfo.foldedSize.height);
 
-    mContactCardLayoutInfo.unfoldedPosition = mContactCardLayoutInfo.padding = Vector2(DEFAULT_PADDING, DEFAULT_PADDING);
-    mContactCardLayoutInfo.unfoldedSize                                      = Vector2(window.GetSize()) - mContactCardLayoutInfo.padding * (MINIMUM_ITEMS_PER_ROW_OR_COLUMN - 1.0f);
+  // Set the size and positions of the header
+  mContactCardLayoutInfo.headerSize.width       = mContactCardLayoutInfo.unfoldedSize.width;
+  mContactCardLayoutInfo.headerSize.height      = mContactCardLayoutInfo.unfoldedSize.height * HEADER_HEIGHT_TO_UNFOLDED_SIZE_RATIO;
+  mContactCardLayoutInfo.headerFoldedPosition   = mContactCardLayoutInfo.headerSize * HEADER_FOLDED_POSITION_AS_RATIO_OF_SIZE;
+  mContactCardLayoutInfo.headerUnfoldedPosition = HEADER_UNFOLDED_POSITION;
 
-    // Calculate the size of the folded card (use the minimum of width/height as size)
-    mContactCardLayoutInfo.foldedSize       = (mContactCardLayoutInfo.unfoldedSize - (mContactCardLayoutInfo.padding * (MINIMUM_ITEMS_PER_ROW_OR_COLUMN - 1.0f))) / MINIMUM_ITEMS_PER_ROW_OR_COLUMN;
-    mContactCardLayoutInfo.foldedSize.width = mContactCardLayoutInfo.foldedSize.height = std::min(mContactCardLayoutInfo.foldedSize.width, mContactCardLayoutInfo.foldedSize.height);
+  // Set the image size and positions
+  mContactCardLayoutInfo.imageSize               = mContactCardLayoutInfo.foldedSize * IMAGE_SIZE_AS_RATIO_TO_FOLDED_SIZE;
+  mContactCardLayoutInfo.imageFoldedPosition     = mContactCardLayoutInfo.imageSize * IMAGE_FOLDED_POSITION_AS_RATIO_OF_SIZE;
+  mContactCardLayoutInfo.imageUnfoldedPosition.x = mContactCardLayoutInfo.padding.width;
+  mContactCardLayoutInfo.imageUnfoldedPosition.y = mContactCardLayoutInfo.headerSize.height + mContactCardLayoutInfo.padding.height;
 
-    // Set the size and positions of the header
-    mContactCardLayoutInfo.headerSize.width       = mContactCardLayoutInfo.unfoldedSize.width;
-    mContactCardLayoutInfo.headerSize.height      = mContactCardLayoutInfo.unfoldedSize.height * HEADER_HEIGHT_TO_UNFOLDED_SIZE_RATIO;
-    mContactCardLayoutInfo.headerFoldedPosition   = mContactCardLayoutInfo.headerSize * HEADER_FOLDED_POSITION_AS_RATIO_OF_SIZE;
-    mContactCardLayoutInfo.headerUnfoldedPosition = HEADER_UNFOLDED_POSITION;
+  // Set the positions of the contact name
+  mContactCardLayoutInfo.textFoldedPosition.x   = 0.0f;
+  mContactCardLayoutInfo.textFoldedPosition.y   = mContactCardLayoutInfo.imageFoldedPosition.x + mContactCardLayoutInfo.imageSize.height * FOLDED_TEXT_POSITION_AS_RATIO_OF_IMAGE_SIZE;
+  mContactCardLayoutInfo.textUnfoldedPosition.x = mContactCardLayoutInfo.padding.width;
+  mContactCardLayoutInfo.textUnfoldedPosition.y = mContactCardLayoutInfo.imageUnfoldedPosition.y + mContactCardLayoutInfo.imageSize.height + mContactCardLayoutInfo.padding.height;
 
-    // Set the image size and positions
-    mContactCardLayoutInfo.imageSize               = mContactCardLayoutInfo.foldedSize * IMAGE_SIZE_AS_RATIO_TO_FOLDED_SIZE;
-    mContactCardLayoutInfo.imageFoldedPosition     = mContactCardLayoutInfo.imageSize * IMAGE_FOLDED_POSITION_AS_RATIO_OF_SIZE;
-    mContactCardLayoutInfo.imageUnfoldedPosition.x = mContactCardLayoutInfo.padding.width;
-    mContactCardLayoutInfo.imageUnfoldedPosition.y = mContactCardLayoutInfo.headerSize.height + mContactCardLayoutInfo.padding.height;
+  // Figure out the positions of the contact cards
+  mItemsPerRow           = (mContactCardLayoutInfo.unfoldedSize.width + mContactCardLayoutInfo.padding.width) / (mContactCardLayoutInfo.foldedSize.width + mContactCardLayoutInfo.padding.width);
+  mLastPosition          = mContactCardLayoutInfo.unfoldedPosition;
+  mPositionIncrementer.x = mContactCardLayoutInfo.foldedSize.width + mContactCardLayoutInfo.padding.width;
+  mPositionIncrementer.y = mContactCardLayoutInfo.foldedSize.height + mContactCardLayoutInfo.padding.height;
 
-    // Set the positions of the contact name
-    mContactCardLayoutInfo.textFoldedPosition.x   = 0.0f;
-    mContactCardLayoutInfo.textFoldedPosition.y   = mContactCardLayoutInfo.imageFoldedPosition.x + mContactCardLayoutInfo.imageSize.height * FOLDED_TEXT_POSITION_AS_RATIO_OF_IMAGE_SIZE;
-    mContactCardLayoutInfo.textUnfoldedPosition.x = mContactCardLayoutInfo.padding.width;
-    mContactCardLayoutInfo.textUnfoldedPosition.y = mContactCardLayoutInfo.imageUnfoldedPosition.y + mContactCardLayoutInfo.imageSize.height + mContactCardLayoutInfo.padding.height;
+  // All the cards are added to one layer: taps are detected on the layer and the folded cards are faded together
+  mLayer = Layer::New();
+  mLayer.SetResizePolicy(ResizePolicy::FILL_TO_PARENT, Dimension::ALL_DIMENSIONS);
+  mLayer.SetProperty(Actor::Property::PARENT_ORIGIN, ParentOrigin::TOP_LEFT);
+  mLayer.SetProperty(Actor::Property::ANCHOR_POINT, AnchorPoint::TOP_LEFT);
+  window.Add(mLayer);
 
-    // Figure out the positions of the contact cards
-    mItemsPerRow           = (mContactCardLayoutInfo.unfoldedSize.width + mContactCardLayoutInfo.padding.width) / (mContactCardLayoutInfo.foldedSize.width + mContactCardLayoutInfo.padding.width);
-    mLastPosition          = mContactCardLayoutInfo.unfoldedPosition;
-    mPositionIncrementer.x = mContactCardLayoutInfo.foldedSize.width + mContactCardLayoutInfo.padding.width;
-    mPositionIncrementer.y = mContactCardLayoutInfo.foldedSize.height + mContactCardLayoutInfo.padding.height;
+  mFoldedCards = Actor::New();
+  mFoldedCards.SetResizePolicy(ResizePolicy::FILL_TO_PARENT, Dimension::ALL_DIMENSIONS);
+  mFoldedCards.SetProperty(Actor::Property::PARENT_ORIGIN, ParentOrigin::TOP_LEFT);
+  mFoldedCards.SetProperty(Actor::Property::ANCHOR_POINT, AnchorPoint::TOP_LEFT);
+  mLayer.Add(mFoldedCards);
 
-    mInitialized = true;
+  mOverlay = Actor::New();
+  mOverlay.SetResizePolicy(ResizePolicy::FILL_TO_PARENT, Dimension::ALL_DIMENSIONS);
+  mOverlay.SetProperty(Actor::Property::PARENT_ORIGIN, ParentOrigin::TOP_LEFT);
+  mOverlay.SetProperty(Actor::Property::ANCHOR_POINT, AnchorPoint::TOP_LEFT);
+  mLayer.Add(mOverlay);
+
+  mTapDetector = TapGestureDetector::New();
+  mTapDetector.Attach(mLayer);
+  mTapDetector.DetectedSignal().Connect(this, &ContactCardLayouter::OnTap);
+
+  // Connect to the window's key signal to allow Back and Escape to fold the unfolded contact cards
+  window.KeyEventSignal().Connect(this, &ContactCardLayouter::OnKeyEvent);
+
+  mAnimation = Animation::New(0.0f); // Overall duration is unimportant as superseded by TimePeriods set by the cards
+  mAnimation.FinishedSignal().Connect(this, &ContactCardLayouter::OnAnimationFinished);
+
+  mInitialized = true;
+}
+
+void ContactCardLayouter::Clear()
+{
+  if(mInitialized)
+  {
+    mAnimation.Clear();
+    mAnimatingCards.clear();
+    mUnfoldedCards.clear();
+    mContactCards.clear();
+
+    mFoldedCards.SetProperty(Actor::Property::COLOR_ALPHA, 1.0f);
+    mFoldedCards.SetProperty(Actor::Property::SENSITIVE, true);
+    mLastPosition = mContactCardLayoutInfo.unfoldedPosition;
   }
+}
 
-  // Create a new contact card and add to our container
-  mContactCards.push_back(new ContactCard(window, mContactCardLayoutInfo, contactName, contactAddress, imagePath, NextCardPosition()));
+void ContactCardLayouter::ToggleContacts(size_t first, size_t count)
+{
+  if(!mUnfoldedCards.empty())
+  {
+    Animate(mUnfoldedCards);
+  }
+  else
+  {
+    std::vector<size_t> cards;
+    for(size_t i = first; i < first + count && i < mContactCards.size(); ++i)
+    {
+      cards.push_back(i);
+    }
+    Animate(cards);
+  }
+}
+
+size_t ContactCardLayouter::GetVisibleContactCount() const
+{
+  if(!mInitialized || mWindowSize.height < mContactCardLayoutInfo.padding.height + mContactCardLayoutInfo.foldedSize.height)
+  {
+    return 0;
+  }
+
+  const size_t rows = static_cast<size_t>((mWindowSize.height - mContactCardLayoutInfo.padding.height - mContactCardLayoutInfo.foldedSize.height) / mPositionIncrementer.y) + 1;
+  return std::min(mContactCards.size(), rows * mItemsPerRow);
+}
+
+void ContactCardLayouter::OnTap(Actor /* actor */, const TapGesture& gesture)
+{
+  const Vector2& point = gesture.GetLocalPoint();
+
+  if(!mUnfoldedCards.empty())
+  {
+    // The folded cards are hidden so only a tap on an unfolded card folds them back
+    for(size_t index : mUnfoldedCards)
+    {
+      if(mContactCards[index]->Contains(point))
+      {
+        Animate(mUnfoldedCards);
+        break;
+      }
+    }
+  }
+  else
+  {
+    const size_t index = HitTest(point);
+    if(index < mContactCards.size())
+    {
+      Animate({index});
+    }
+  }
+}
+
+size_t ContactCardLayouter::HitTest(const Vector2& point) const
+{
+  const Vector2 gridPoint = point - mContactCardLayoutInfo.unfoldedPosition;
+  if(gridPoint.x < 0.0f || gridPoint.y < 0.0f)
+  {
+    return mContactCards.size();
+  }
+
+  // Ignore taps in the padding between the cards
+  if(std::fmod(gridPoint.x, mPositionIncrementer.x) >= mContactCardLayoutInfo.foldedSize.width ||
+     std::fmod(gridPoint.y, mPositionIncrementer.y) >= mContactCardLayoutInfo.foldedSize.height)
+  {
+    return mContactCards.size();
+  }
+
+  const size_t column = static_cast<size_t>(gridPoint.x / mPositionIncrementer.x);
+  const size_t row    = static_cast<size_t>(gridPoint.y / mPositionIncrementer.y);
+  if(column >= mItemsPerRow)
+  {
+    return mContactCards.size();
+  }
+  return std::min(row * mItemsPerRow + column, mContactCards.size());
+}
+
+void ContactCardLayouter::Animate(std::vector<size_t> cards)
+{
+  // The timeline is not restarted while playing so that a stale finished signal is never received
+  if(cards.empty() || IsAnimating())
+  {
+    return;
+  }
+
+  const bool unfold = mContactCards[cards.front()]->IsFolded();
+
+  mAnimation.Clear();
+  for(size_t index : cards)
+  {
+    mContactCards[index]->AddAnimators(mAnimation, mOverlay);
+  }
+  ContactCard::AddSiblingAnimators(mAnimation, mFoldedCards, unfold);
+
+  if(unfold)
+  {
+    mUnfoldedCards = cards;
+  }
+  else
+  {
+    mUnfoldedCards.clear();
+  }
+  mAnimatingCards.swap(cards);
+  mAnimation.Play();
+}
+
+void ContactCardLayouter::OnAnimationFinished(Animation& /* animation */)
+{
+  std::vector<size_t> cards;
+  cards.swap(mAnimatingCards);
+  for(size_t index : cards)
+  {
+    if(index < mContactCards.size())
+    {
+      mContactCards[index]->OnAnimationFinished();
+    }
+  }
+}
+
+void ContactCardLayouter::OnKeyEvent(const KeyEvent& event)
+{
+  if((!mUnfoldedCards.empty()) && // If all the cards are folded then there's no need to do any more checking
+     (event.GetState() == KeyEvent::DOWN))
+  {
+    if(IsKey(event, Dali::DALI_KEY_ESCAPE) || IsKey(event, Dali::DALI_KEY_BACK))
+    {
+      Animate(mUnfoldedCards);
+    }
+  }
 }
 
 const Vector2& ContactCardLayouter::NextCardPosition()
@@ -19,9 +19,13 @@
  */
 
 // EXTERNAL INCLUDES
+#include <dali/public-api/actors/layer.h>
 #include <dali/public-api/adaptor-framework/window.h>
+#include <dali/public-api/animation/animation.h>
 #include <dali/public-api/common/intrusive-ptr.h>
+#include <dali/public-api/events/tap-gesture-detector.h>
 #include <dali/public-api/math/vector2.h>
+#include <dali/public-api/signals/connection-tracker.h>
 #include <string>
 #include <vector>
 
@@ -31,14 +35,16 @@
 class ContactCard;
 
 /**
- * @brief This class lays out contact cards on the screen appropriately.
+ * @brief This class lays out contact cards in a grid on the screen and folds/unfolds them.
  *
- * The contact cards are added to the passed in window directly and it uses the window size to figure out exactly how to layout them.
- * It supports a minimum of 3 items on each row or column.
+ * The cards are added to a single layer on the passed in window, and the window size is used to figure out exactly how to
+ * layout them. It supports a minimum of 3 items on each row or column.
+ * The layer has the only tap detector: the tapped card is found from its position in the grid. An unfolded card is moved to
+ * an overlay above the folded ones, and all the cards folding or unfolding at the same time share one animation timeline.
  *
  * Relayouting is not supported.
  */
-class ContactCardLayouter
+class ContactCardLayouter : public Dali::ConnectionTracker
 {
 public:
   /**
@@ -60,7 +66,82 @@ public:
    */
   void AddContact(Dali::Window window, const std::string& contactName, const std::string& contactAddress, const std::string& imagePath);
 
+  /**
+   * @brief Removes all the contact cards.
+   */
+  void Clear();
+
+  /**
+   * @brief Unfolds the given contact cards together, or folds the unfolded contact cards if there are any.
+   *
+   * Does nothing while contact cards are folding or unfolding.
+   * @param[in]  first  The index of the first contact card.
+   * @param[in]  count  The number of contact cards.
+   */
+  void ToggleContacts(size_t first, size_t count);
+
+  /**
+   * @brief Retrieves the number of contact cards.
+   */
+  size_t GetContactCount() const
+  {
+    return mContactCards.size();
+  }
+
+  /**
+   * @brief Retrieves the number of contact cards which fit in the window.
+   */
+  size_t GetVisibleContactCount() const;
+
+  /**
+   * @brief Whether contact cards are folding or unfolding.
+   */
+  bool IsAnimating() const
+  {
+    return !mAnimatingCards.empty();
+  }
+
 private:
+  /**
+   * @brief Creates the layer and computes the layout when the first contact card is added.
+   * @param[in]  window  The window to add the layer to.
+   */
+  void Initialize(Dali::Window window);
+
+  /**
+   * @brief Called when the layer is tapped, folds or unfolds the tapped contact card.
+   * @param[in]  actor    The tapped actor.
+   * @param[in]  gesture  The tap gesture.
+   */
+  void OnTap(Dali::Actor actor, const Dali::TapGesture& gesture);
+
+  /**
+   * @brief Retrieves the index of the folded contact card at the given point.
+   * @param[in]  point  The point in the coordinates of the layer.
+   * @return The index of the contact card or the number of contact cards if there is no card at that point.
+   */
+  size_t HitTest(const Dali::Vector2& point) const;
+
+  /**
+   * @brief Folds or unfolds the given contact cards on the shared animation.
+   * @param[in]  cards  The indices of the contact cards.
+   */
+  void Animate(std::vector<size_t> cards);
+
+  /**
+   * @brief Called when the shared animation finishes.
+   * @param[in]  animation  The animation which has just finished.
+   */
+  void OnAnimationFinished(Dali::Animation& animation);
+
+  /**
+   * @brief Called when any key event is received
+   *
+   * Will use this to fold the unfolded contact cards.
+   * @param[in]  event  The key event information
+   */
+  void OnKeyEvent(const Dali::KeyEvent& event);
+
   /**
    * @brief Calculates the next position of the contact card that's about to be added to our container.
    * @return A reference to the next position.
@@ -73,8 +154,17 @@ private:
   typedef std::vector<ContactCardPtr>     ContactCardContainer;
   ContactCardContainer                    mContactCards; ///< Contains all the contact cards.
 
+  Dali::Layer              mLayer;          ///< Contains the cards, tap detection is attached to it.
+  Dali::Actor              mFoldedCards;    ///< The parent of the folded cards, faded out when a card is unfolded.
+  Dali::Actor              mOverlay;        ///< The parent of the unfolded cards, above the folded ones.
+  Dali::TapGestureDetector mTapDetector;    ///< Used for tap detection on all the cards.
+  Dali::Animation          mAnimation;      ///< The fold/unfold animation shared by all the cards.
+  std::vector<size_t>      mUnfoldedCards;  ///< The indices of the unfolded, or unfolding, cards.
+  std::vector<size_t>      mAnimatingCards; ///< The indices of the cards on the shared animation.
+
   Dali::Vector2 mLastPosition;        ///< The last position a contact card was added.
   Dali::Vector2 mPositionIncrementer; ///< Calculated once when AddContact is first called.
+  Dali::Vector2 mWindowSize;          ///< Stored when AddContact is first called.
   size_t        mItemsPerRow;         ///< Calculated once when AddContact is first called and stores the number of items we have in a row.
 
   bool mInitialized; ///< Whether initialization has taken place or not.
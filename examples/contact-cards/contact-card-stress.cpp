@@ -0,0 +1,225 @@
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// CLASS HEADER
+#include "contact-card-stress.h"
+
+// EXTERNAL INCLUDES
+#include <dali-toolkit/dali-toolkit.h>
+#include <dali/devel-api/common/stage-devel.h>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+
+// INTERNAL INCLUDES
+#include "contact-card-layouter.h"
+#include "contact-data.h"
+#include "shared/frame-stats.h"
+#include "shared/utility.h"
+
+using namespace Dali;
+using namespace Dali::Toolkit;
+using DemoHelper::MillisecondsSince;
+
+namespace
+{
+constexpr uint32_t POLL_INTERVAL_MS = 16u;   ///< How often the state of the cards is checked
+constexpr uint32_t SETTLE_MS        = 1000u; ///< How long the frames are measured after creating the cards
+
+using Clock = std::chrono::steady_clock;
+
+} // unnamed namespace
+
+ContactCardStress::ContactCardStress(Window window, ContactCardLayouter& layouter, const std::vector<size_t>& cardCounts)
+: mWindow(window),
+  mLayouter(layouter),
+  mCardCounts(cardCounts)
+{
+}
+
+ContactCardStress::~ContactCardStress()
+{
+  if(mFrameStats)
+  {
+    DevelStage::RemoveFrameCallback(Stage::GetCurrent(), *mFrameStats);
+  }
+  UnparentAndReset(mStatusLayer);
+}
+
+void ContactCardStress::Start()
+{
+  // The status has its own layer, raised above the layer of the cards whenever they are recreated
+  mStatusLayer = Layer::New();
+  mStatusLayer.SetResizePolicy(ResizePolicy::FILL_TO_PARENT, Dimension::ALL_DIMENSIONS);
+  mStatusLayer.SetProperty(Actor::Property::SENSITIVE, false);
+  mWindow.Add(mStatusLayer);
+
+  mStatus = TextLabel::New();
+  mStatus.SetProperty(TextLabel::Property::MULTI_LINE, true);
+  mStatus.SetProperty(TextLabel::Property::TEXT_COLOR, Color::BLACK);
+  mStatus.SetProperty(TextLabel::Property::POINT_SIZE, 7.0f);
+  mStatus.SetProperty(TextLabel::Property::FONT_FAMILY, "Monospace");
+  mStatus.SetProperty(Actor::Property::PARENT_ORIGIN, ParentOrigin::BOTTOM_LEFT);
+  mStatus.SetProperty(Actor::Property::ANCHOR_POINT, AnchorPoint::BOTTOM_LEFT);
+  mStatusLayer.Add(mStatus);
+
+  mFrameStats = std::make_unique<DemoHelper::FrameStats>();
+  DevelStage::AddFrameCallback(Stage::GetCurrent(), *mFrameStats, mWindow.GetRootLayer());
+
+  mStep       = Step::CREATE;
+  mCountIndex = 0u;
+  mResults.clear();
+
+  mTimer = Timer::New(POLL_INTERVAL_MS);
+  mTimer.TickSignal().Connect(this, &ContactCardStress::OnTimer);
+  mTimer.Start();
+}
+
+void ContactCardStress::CreateCards()
+{
+  Result result;
+  result.cards = mCardCounts[mCountIndex];
+
+  std::ostringstream status;
+  status << "Laying out " << result.cards << " contacts";
+  mStatus.SetProperty(TextLabel::Property::TEXT, status.str());
+
+  // Generating the contacts is not part of the layout
+  const std::vector<ContactData::GeneratedItem> contacts = ContactData::Generate(result.cards);
+
+  mLayouter.Clear();
+
+  const Clock::time_point start = Clock::now();
+  for(const auto& contact : contacts)
+  {
+    mLayouter.AddContact(mWindow, contact.name, contact.address, contact.imagePath);
+  }
+  result.createMs     = MillisecondsSince(start);
+  result.visibleCards = mLayouter.GetVisibleContactCount();
+  mResults.push_back(result);
+
+  mStatusLayer.RaiseToTop();
+  mFrameStats->Reset();
+}
+
+bool ContactCardStress::Toggle(size_t count)
+{
+  if(mLayouter.IsAnimating())
+  {
+    return false;
+  }
+
+  // First unfold, then fold back once unfolded
+  if(mToggles < 2u)
+  {
+    mLayouter.ToggleContacts(0u, count);
+    ++mToggles;
+    return false;
+  }
+
+  mToggles = 0u;
+  return true;
+}
+
+ContactCardStress::FrameTimes ContactCardStress::TakeFrameTimes()
+{
+  const DemoHelper::FrameStats::Sample stats = mFrameStats->Reset();
+
+  FrameTimes frameTimes;
+  frameTimes.averageMs       = stats.GetAverageFrameMs();
+  frameTimes.maxMs           = stats.GetMaxFrameMs();
+  frameTimes.averageUpdateMs = stats.GetAverageUpdateMs();
+  return frameTimes;
+}
+
+bool ContactCardStress::OnTimer()
+{
+  switch(mStep)
+  {
+    case Step::CREATE:
+    {
+      CreateCards();
+      mStepStart = Clock::now();
+      mStep      = Step::SETTLE;
+      break;
+    }
+    case Step::SETTLE:
+    {
+      if(MillisecondsSince(mStepStart) >= SETTLE_MS)
+      {
+        mResults.back().layout = TakeFrameTimes();
+        mToggles               = 0u;
+        mStep                  = Step::TOGGLE_ONE;
+      }
+      break;
+    }
+    case Step::TOGGLE_ONE:
+    {
+      if(Toggle(1u))
+      {
+        mResults.back().toggleOne = TakeFrameTimes();
+        mStep                     = Step::TOGGLE_VISIBLE;
+      }
+      break;
+    }
+    case Step::TOGGLE_VISIBLE:
+    {
+      if(Toggle(mResults.back().visibleCards))
+      {
+        mResults.back().toggleVisible = TakeFrameTimes();
+        if(++mCountIndex < mCardCounts.size())
+        {
+          mStep = Step::CREATE;
+        }
+        else
+        {
+          ReportResults();
+          return false;
+        }
+      }
+      break;
+    }
+  }
+  return true;
+}
+
+void ContactCardStress::ReportResults()
+{
+  std::ostringstream table;
+  table << std::fixed << std::setprecision(1);
+  table << std::setw(7) << "Cards" << std::setw(9) << "Create" << std::setw(10) << "Layout" << std::setw(9) << "Update"
+        << std::setw(12) << "Fold 1" << std::setw(9) << "Update" << std::setw(16) << "Fold visible" << std::setw(9) << "Update" << "\n";
+
+  for(const auto& result : mResults)
+  {
+    std::ostringstream foldOne;
+    foldOne << std::fixed << std::setprecision(1) << result.toggleOne.averageMs << "/" << result.toggleOne.maxMs;
+    std::ostringstream foldVisible;
+    foldVisible << std::fixed << std::setprecision(1) << result.toggleVisible.averageMs << "/" << result.toggleVisible.maxMs << " (" << result.visibleCards << ")";
+
+    table << std::setw(7) << result.cards << std::setw(9) << result.createMs << std::setw(10) << result.layout.maxMs
+          << std::setw(9) << result.layout.averageUpdateMs << std::setw(12) << foldOne.str() << std::setw(9)
+          << result.toggleOne.averageUpdateMs << std::setw(16) << foldVisible.str() << std::setw(9)
+          << result.toggleVisible.averageUpdateMs << "\n";
+  }
+  table << "Times in ms. Create: adding the cards. Layout: longest frame in the " << SETTLE_MS << "ms after.\n"
+        << "Fold: mean/longest frame while unfolding and folding back one card, or all the cards fitting in the window.\n"
+        << "Update: mean update thread CPU time per frame.";
+
+  std::cout << table.str() << std::endl;
+  mStatus.SetProperty(TextLabel::Property::TEXT, table.str());
+}
@@ -0,0 +1,128 @@
+#ifndef CONTACT_CARD_STRESS_H
+#define CONTACT_CARD_STRESS_H
+
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// EXTERNAL INCLUDES
+#include <dali-toolkit/public-api/controls/text-controls/text-label.h>
+#include <dali/public-api/actors/layer.h>
+#include <dali/public-api/adaptor-framework/timer.h>
+#include <dali/public-api/adaptor-framework/window.h>
+#include <dali/public-api/signals/connection-tracker.h>
+#include <chrono>
+#include <memory>
+#include <vector>
+
+class ContactCardLayouter;
+
+namespace DemoHelper
+{
+class FrameStats;
+}
+
+/**
+ * @brief Lays out an increasing number of synthetic contacts and measures the frame times.
+ *
+ * For each card count, the layouter is cleared and the generated contacts are added, then:
+ *  - the time taken to create the cards and the longest frame while they are first laid out are measured,
+ *  - one card is unfolded and folded back,
+ *  - all the cards which fit in the window are unfolded and folded back together, on the shared timeline.
+ * A table of the frame times is logged and shown at the end.
+ */
+class ContactCardStress : public Dali::ConnectionTracker
+{
+public:
+  /**
+   * @brief Constructor.
+   * @param[in]  window      The window to show the results in.
+   * @param[in]  layouter    The layouter to add the contact cards to.
+   * @param[in]  cardCounts  The numbers of contact cards measured, in order.
+   */
+  ContactCardStress(Dali::Window window, ContactCardLayouter& layouter, const std::vector<size_t>& cardCounts);
+
+  /**
+   * @brief Destructor.
+   */
+  ~ContactCardStress();
+
+  /**
+   * @brief Runs all the card counts.
+   */
+  void Start();
+
+private:
+  enum class Step
+  {
+    CREATE,
+    SETTLE,
+    TOGGLE_ONE,
+    TOGGLE_VISIBLE
+  };
+
+  struct FrameTimes
+  {
+    float averageMs{0.0f};
+    float maxMs{0.0f};
+    float averageUpdateMs{0.0f};
+  };
+
+  struct Result
+  {
+    size_t     cards{0u};
+    size_t     visibleCards{0u};
+    float      createMs{0.0f};
+    FrameTimes layout;
+    FrameTimes toggleOne;
+    FrameTimes toggleVisible;
+  };
+
+  /**
+   * @brief Replaces the contact cards with the current card count.
+   */
+  void CreateCards();
+
+  /**
+   * @brief Unfolds, then folds back, the given contact cards.
+   * @return Whether the contact cards are back to folded.
+   */
+  bool Toggle(size_t count);
+
+  FrameTimes TakeFrameTimes();
+
+  void ReportResults();
+
+  bool OnTimer();
+
+private:
+  Dali::Window                            mWindow;
+  ContactCardLayouter&                    mLayouter;
+  std::vector<size_t>                     mCardCounts;
+  std::vector<Result>                     mResults;
+  std::unique_ptr<DemoHelper::FrameStats> mFrameStats;
+
+  Dali::Layer              mStatusLayer;
+  Dali::Toolkit::TextLabel mStatus;
+  Dali::Timer              mTimer;
+
+  Step                                  mStep{Step::CREATE};
+  std::chrono::steady_clock::time_point mStepStart;
+  size_t                                mCountIndex{0u};
+  unsigned int                          mToggles{0u};
+};
+
+#endif // CONTACT_CARD_STRESS_H
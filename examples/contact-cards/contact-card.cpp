@@ -87,29 +87,27 @@ const Vector4 HEADER_COLOR(231.0f / 255.0f, 231.0f / 255.0f, 231.0f / 255.0f, 1.
 } // unnamed namespace
 
 ContactCard::ContactCard(
-  Dali::Window                 window,
+  Dali::Actor                  container,
   const ContactCardLayoutInfo& contactCardLayoutInfo,
   const std::string&           contactName,
   const std::string&           contactAddress,
   const std::string&           imagePath,
   const Vector2&               position)
-: mTapDetector(),
+: mContainer(container),
   mContactCard(),
   mHeader(),
   mClippedImage(),
   mMaskedImage(),
   mNameText(),
   mDetailText(),
-  mAnimation(),
-  mSlotDelegate(this),
+  mContactName(contactName),
+  mContactAddress(contactAddress),
+  mImagePath(imagePath),
   mContactCardLayoutInfo(contactCardLayoutInfo),
   foldedPosition(position),
   mClippedImagePropertyIndex(Property::INVALID_INDEX),
   mFolded(true)
 {
-  // Connect to the window's key signal to allow Back and Escape to fold a contact card if it is unfolded
-  window.KeyEventSignal().Connect(mSlotDelegate, &ContactCard::OnKeyEvent);
-
   // Create a control which will be used for the background and to clip the contents
   mContactCard = Control::New();
   mContactCard.SetProperty(Control::Property::BACKGROUND,
@@ -120,8 +118,36 @@ ContactCard::ContactCard(
   mContactCard.SetProperty(Actor::Property::ANCHOR_POINT, AnchorPoint::TOP_LEFT);
   mContactCard.SetProperty(Actor::Property::POSITION, Vector2(foldedPosition.x, foldedPosition.y));
   mContactCard.SetProperty(Actor::Property::SIZE, mContactCardLayoutInfo.foldedSize);
-  window.Add(mContactCard);
+  mContainer.Add(mContactCard);
+
+  // Create an image with a mask which is to be used when the contact is folded
+  mMaskedImage = MaskedImage::Create(imagePath);
+  mMaskedImage.SetProperty(Actor::Property::SIZE, mContactCardLayoutInfo.imageSize);
+  mMaskedImage.SetProperty(Actor::Property::PARENT_ORIGIN, ParentOrigin::TOP_LEFT);
+  mMaskedImage.SetProperty(Actor::Property::ANCHOR_POINT, AnchorPoint::TOP_LEFT);
+  mMaskedImage.SetProperty(Actor::Property::POSITION, Vector2(mContactCardLayoutInfo.imageFoldedPosition.x, mContactCardLayoutInfo.imageFoldedPosition.y));
+  mContactCard.Add(mMaskedImage);
+
+  // Add the text label for just the name
+  mNameText = TextLabel::New(contactName);
+  mNameText.SetStyleName("ContactNameTextLabel");
+  mNameText.SetProperty(Actor::Property::PARENT_ORIGIN, ParentOrigin::TOP_LEFT);
+  mNameText.SetProperty(Actor::Property::ANCHOR_POINT, AnchorPoint::TOP_LEFT);
+  mNameText.SetResizePolicy(ResizePolicy::FILL_TO_PARENT, Dimension::WIDTH);
+  mNameText.SetProperty(Actor::Property::POSITION, Vector2(mContactCardLayoutInfo.textFoldedPosition.x, mContactCardLayoutInfo.textFoldedPosition.y));
+  mContactCard.Add(mNameText);
+}
+
+ContactCard::~ContactCard()
+{
+  if(mContactCard)
+  {
+    mContactCard.Unparent();
+  }
+}
 
+void ContactCard::CreateUnfoldedControls()
+{
   // Create the header which will be shown only when the contact is unfolded
   mHeader = Control::New();
   mHeader.SetProperty(Actor::Property::SIZE, mContactCardLayoutInfo.headerSize);
@@ -133,7 +159,7 @@ ContactCard::ContactCard(
   mHeader.SetProperty(Actor::Property::POSITION, Vector2(mContactCardLayoutInfo.headerFoldedPosition.x, mContactCardLayoutInfo.headerFoldedPosition.y));
 
   // Create a clipped image (whose clipping can be animated)
-  mClippedImage = ClippedImage::Create(imagePath, mClippedImagePropertyIndex);
+  mClippedImage = ClippedImage::Create(mImagePath, mClippedImagePropertyIndex);
   mClippedImage.SetProperty(Actor::Property::SIZE, mContactCardLayoutInfo.imageSize);
   mClippedImage.SetProperty(Actor::Property::PARENT_ORIGIN, ParentOrigin::TOP_LEFT);
   mClippedImage.SetProperty(Actor::Property::ANCHOR_POINT, AnchorPoint::TOP_LEFT);
@@ -141,27 +167,10 @@ ContactCard::ContactCard(
   mClippedImage.SetProperty(Actor::Property::VISIBLE, false); // Hide image as we only want to display it if we are animating or unfolded
   mContactCard.Add(mClippedImage);
 
-  // Create an image with a mask which is to be used when the contact is folded
-  mMaskedImage = MaskedImage::Create(imagePath);
-  mMaskedImage.SetProperty(Actor::Property::SIZE, mContactCardLayoutInfo.imageSize);
-  mMaskedImage.SetProperty(Actor::Property::PARENT_ORIGIN, ParentOrigin::TOP_LEFT);
-  mMaskedImage.SetProperty(Actor::Property::ANCHOR_POINT, AnchorPoint::TOP_LEFT);
-  mMaskedImage.SetProperty(Actor::Property::POSITION, Vector2(mContactCardLayoutInfo.imageFoldedPosition.x, mContactCardLayoutInfo.imageFoldedPosition.y));
-  mContactCard.Add(mMaskedImage);
-
-  // Add the text label for just the name
-  mNameText = TextLabel::New(contactName);
-  mNameText.SetStyleName("ContactNameTextLabel");
-  mNameText.SetProperty(Actor::Property::PARENT_ORIGIN, ParentOrigin::TOP_LEFT);
-  mNameText.SetProperty(Actor::Property::ANCHOR_POINT, AnchorPoint::TOP_LEFT);
-  mNameText.SetResizePolicy(ResizePolicy::FILL_TO_PARENT, Dimension::WIDTH);
-  mNameText.SetProperty(Actor::Property::POSITION, Vector2(mContactCardLayoutInfo.textFoldedPosition.x, mContactCardLayoutInfo.textFoldedPosition.y));
-  mContactCard.Add(mNameText);
-
   // Create the detail text-label
-  std::string detailString(contactName);
+  std::string detailString(mContactName);
   detailString += "\n\n";
-  detailString += contactAddress;
+  detailString += mContactAddress;
 
   mDetailText = TextLabel::New(detailString);
   mDetailText.SetStyleName("ContactDetailTextLabel");
@@ -170,40 +179,48 @@ ContactCard::ContactCard(
   mDetailText.SetProperty(Actor::Property::POSITION, Vector2(mContactCardLayoutInfo.textFoldedPosition.x, mContactCardLayoutInfo.textFoldedPosition.y));
   mDetailText.SetProperty(Actor::Property::SIZE, Vector2(mContactCardLayoutInfo.unfoldedSize.width - mContactCardLayoutInfo.textFoldedPosition.x * 2.0f, 0.0f));
   mDetailText.SetProperty(Actor::Property::OPACITY, 0.0f);
-
-  // Attach tap detection to the overall clip control
-  mTapDetector = TapGestureDetector::New();
-  mTapDetector.Attach(mContactCard);
-  mTapDetector.DetectedSignal().Connect(mSlotDelegate, &ContactCard::OnTap);
 }
 
-ContactCard::~ContactCard()
+bool ContactCard::Contains(const Vector2& point) const
 {
-  if(mContactCard)
-  {
-    mContactCard.Unparent();
-  }
+  const Vector3 position = mContactCard.GetCurrentProperty<Vector3>(Actor::Property::POSITION);
+  const Vector3 size     = mContactCard.GetCurrentProperty<Vector3>(Actor::Property::SIZE);
+  return point.x >= position.x && point.x < position.x + size.width &&
+         point.y >= position.y && point.y < position.y + size.height;
 }
 
-void ContactCard::OnTap(Actor actor, const TapGesture& /* gesture */)
+void ContactCard::AddSiblingAnimators(Animation& animation, Actor siblings, bool unfold)
 {
-  if(actor == mContactCard)
+  // The siblings are faded as one through their container so the cost does not depend on the number of cards
+  if(unfold)
   {
-    Animate();
+    animation.AnimateTo(Property(siblings, Actor::Property::COLOR_ALPHA), 0.0f, ALPHA_FUNCTION_UNFOLD, TIME_PERIOD_UNFOLD_SIBLING_OPACITY);
+    siblings.SetProperty(Actor::Property::SENSITIVE, false);
+  }
+  else
+  {
+    animation.AnimateTo(Property(siblings, Actor::Property::COLOR_ALPHA), 1.0f, ALPHA_FUNCTION_FOLD, TIME_PERIOD_FOLD_SIBLING_OPACITY);
+    siblings.SetProperty(Actor::Property::SENSITIVE, true);
   }
 }
 
-void ContactCard::Animate()
+void ContactCard::AddAnimators(Animation& animation, Actor overlay)
 {
   KeyInputFocusManager keyInputFocusManager = KeyInputFocusManager::Get();
 
-  mAnimation = Animation::New(0.0f); // Overall duration is unimportant as superseded by TimePeriods set later
-
   if(mFolded)
   {
+    if(!mHeader)
+    {
+      CreateUnfoldedControls();
+    }
+
     // Set key-input-focus to our contact-card so that we can fold the contact-card if we receive a Back or Esc key
     keyInputFocusManager.SetFocus(mContactCard);
 
+    // Move above the other cards so they can be faded out without fading this one
+    overlay.Add(mContactCard);
+
     mContactCard.Add(mHeader);
     mContactCard.Add(mDetailText);
 
@@ -212,44 +229,29 @@ void ContactCard::Animate()
     mMaskedImage.SetProperty(Actor::Property::VISIBLE, false);
 
     // Animate the size of the control (and clipping area)
-    mAnimation.AnimateTo(Property(mContactCard, Actor::Property::POSITION_X), mContactCardLayoutInfo.unfoldedPosition.x, ALPHA_FUNCTION_UNFOLD, TIME_PERIOD_UNFOLD_X);
-    mAnimation.AnimateTo(Property(mContactCard, Actor::Property::POSITION_Y), mContactCardLayoutInfo.unfoldedPosition.y, ALPHA_FUNCTION_UNFOLD, TIME_PERIOD_UNFOLD_Y);
-    mAnimation.AnimateTo(Property(mContactCard, Actor::Property::SIZE_WIDTH), mContactCardLayoutInfo.unfoldedSize.width, ALPHA_FUNCTION_UNFOLD, TIME_PERIOD_UNFOLD_WIDTH);
-    mAnimation.AnimateTo(Property(mContactCard, Actor::Property::SIZE_HEIGHT), mContactCardLayoutInfo.unfoldedSize.height, ALPHA_FUNCTION_UNFOLD, TIME_PERIOD_UNFOLD_HEIGHT);
+    animation.AnimateTo(Property(mContactCard, Actor::Property::POSITION_X), mContactCardLayoutInfo.unfoldedPosition.x, ALPHA_FUNCTION_UNFOLD, TIME_PERIOD_UNFOLD_X);
+    animation.AnimateTo(Property(mContactCard, Actor::Property::POSITION_Y), mContactCardLayoutInfo.unfoldedPosition.y, ALPHA_FUNCTION_UNFOLD, TIME_PERIOD_UNFOLD_Y);
+    animation.AnimateTo(Property(mContactCard, Actor::Property::SIZE_WIDTH), mContactCardLayoutInfo.unfoldedSize.width, ALPHA_FUNCTION_UNFOLD, TIME_PERIOD_UNFOLD_WIDTH);
+    animation.AnimateTo(Property(mContactCard, Actor::Property::SIZE_HEIGHT), mContactCardLayoutInfo.unfoldedSize.height, ALPHA_FUNCTION_UNFOLD, TIME_PERIOD_UNFOLD_HEIGHT);
 
     // Animate the header area into position
-    mAnimation.AnimateTo(Property(mHeader, Actor::Property::POSITION_X), mContactCardLayoutInfo.headerUnfoldedPosition.x, ALPHA_FUNCTION_UNFOLD, TIME_PERIOD_UNFOLD_X);
-    mAnimation.AnimateTo(Property(mHeader, Actor::Property::POSITION_Y), mContactCardLayoutInfo.headerUnfoldedPosition.y, ALPHA_FUNCTION_UNFOLD, TIME_PERIOD_UNFOLD_Y);
+    animation.AnimateTo(Property(mHeader, Actor::Property::POSITION_X), mContactCardLayoutInfo.headerUnfoldedPosition.x, ALPHA_FUNCTION_UNFOLD, TIME_PERIOD_UNFOLD_X);
+    animation.AnimateTo(Property(mHeader, Actor::Property::POSITION_Y), mContactCardLayoutInfo.headerUnfoldedPosition.y, ALPHA_FUNCTION_UNFOLD, TIME_PERIOD_UNFOLD_Y);
 
     // Animate the clipped image into the unfolded position and into a quad
-    mAnimation.AnimateTo(Property(mClippedImage, Actor::Property::POSITION_X), mContactCardLayoutInfo.imageUnfoldedPosition.x, ALPHA_FUNCTION_UNFOLD, TIME_PERIOD_UNFOLD_X);
-    mAnimation.AnimateTo(Property(mClippedImage, Actor::Property::POSITION_Y), mContactCardLayoutInfo.imageUnfoldedPosition.y, ALPHA_FUNCTION_UNFOLD, TIME_PERIOD_UNFOLD_Y);
-    mAnimation.AnimateTo(Property(mClippedImage, mClippedImagePropertyIndex), ClippedImage::QUAD_GEOMETRY, ALPHA_FUNCTION_UNFOLD, TIME_PERIOD_UNFOLD_MESH_MORPH);
+    animation.AnimateTo(Property(mClippedImage, Actor::Property::POSITION_X), mContactCardLayoutInfo.imageUnfoldedPosition.x, ALPHA_FUNCTION_UNFOLD, TIME_PERIOD_UNFOLD_X);
+    animation.AnimateTo(Property(mClippedImage, Actor::Property::POSITION_Y), mContactCardLayoutInfo.imageUnfoldedPosition.y, ALPHA_FUNCTION_UNFOLD, TIME_PERIOD_UNFOLD_Y);
+    animation.AnimateTo(Property(mClippedImage, mClippedImagePropertyIndex), ClippedImage::QUAD_GEOMETRY, ALPHA_FUNCTION_UNFOLD, TIME_PERIOD_UNFOLD_MESH_MORPH);
 
     // Fade out the opacity of the name, and animate into the unfolded position
-    mAnimation.AnimateTo(Property(mNameText, Actor::Property::COLOR_ALPHA), 0.0f, ALPHA_FUNCTION_UNFOLD, TIME_PERIOD_UNFOLD_NAME_OPACITY);
-    mAnimation.AnimateTo(Property(mNameText, Actor::Property::POSITION_X), mContactCardLayoutInfo.textUnfoldedPosition.x, ALPHA_FUNCTION_UNFOLD, TIME_PERIOD_UNFOLD_X);
-    mAnimation.AnimateTo(Property(mNameText, Actor::Property::POSITION_Y), mContactCardLayoutInfo.textUnfoldedPosition.y, ALPHA_FUNCTION_UNFOLD, TIME_PERIOD_UNFOLD_Y);
+    animation.AnimateTo(Property(mNameText, Actor::Property::COLOR_ALPHA), 0.0f, ALPHA_FUNCTION_UNFOLD, TIME_PERIOD_UNFOLD_NAME_OPACITY);
+    animation.AnimateTo(Property(mNameText, Actor::Property::POSITION_X), mContactCardLayoutInfo.textUnfoldedPosition.x, ALPHA_FUNCTION_UNFOLD, TIME_PERIOD_UNFOLD_X);
+    animation.AnimateTo(Property(mNameText, Actor::Property::POSITION_Y), mContactCardLayoutInfo.textUnfoldedPosition.y, ALPHA_FUNCTION_UNFOLD, TIME_PERIOD_UNFOLD_Y);
 
     // Fade in the opacity of the detail, and animate into the unfolded position
-    mAnimation.AnimateTo(Property(mDetailText, Actor::Property::COLOR_ALPHA), 1.0f, ALPHA_FUNCTION_UNFOLD, TIME_PERIOD_UNFOLD_DETAIL_OPACITY);
-    mAnimation.AnimateTo(Property(mDetailText, Actor::Property::POSITION_X), mContactCardLayoutInfo.textUnfoldedPosition.x, ALPHA_FUNCTION_UNFOLD, TIME_PERIOD_UNFOLD_X);
-    mAnimation.AnimateTo(Property(mDetailText, Actor::Property::POSITION_Y), mContactCardLayoutInfo.textUnfoldedPosition.y, ALPHA_FUNCTION_UNFOLD, TIME_PERIOD_UNFOLD_Y);
-
-    // Fade out all the siblings
-    Actor parent = mContactCard.GetParent();
-    for(size_t i = 0; i < parent.GetChildCount(); ++i)
-    {
-      Actor sibling = parent.GetChildAt(i);
-      if(sibling != mContactCard)
-      {
-        mAnimation.AnimateTo(Property(sibling, Actor::Property::COLOR_ALPHA), 0.0f, ALPHA_FUNCTION_UNFOLD, TIME_PERIOD_UNFOLD_SIBLING_OPACITY);
-        sibling.SetProperty(Actor::Property::SENSITIVE, false);
-      }
-    }
-
-    mAnimation.FinishedSignal().Connect(mSlotDelegate, &ContactCard::OnAnimationFinished);
-    mAnimation.Play();
+    animation.AnimateTo(Property(mDetailText, Actor::Property::COLOR_ALPHA), 1.0f, ALPHA_FUNCTION_UNFOLD, TIME_PERIOD_UNFOLD_DETAIL_OPACITY);
+    animation.AnimateTo(Property(mDetailText, Actor::Property::POSITION_X), mContactCardLayoutInfo.textUnfoldedPosition.x, ALPHA_FUNCTION_UNFOLD, TIME_PERIOD_UNFOLD_X);
+    animation.AnimateTo(Property(mDetailText, Actor::Property::POSITION_Y), mContactCardLayoutInfo.textUnfoldedPosition.y, ALPHA_FUNCTION_UNFOLD, TIME_PERIOD_UNFOLD_Y);
   }
   else
   {
@@ -259,84 +261,50 @@ void ContactCard::Animate()
     mContactCard.Add(mNameText);
 
     // Animate the size of the control (and clipping area)
-    mAnimation.AnimateTo(Property(mContactCard, Actor::Property::POSITION_X), foldedPosition.x, ALPHA_FUNCTION_FOLD, TIME_PERIOD_FOLD_X);
-    mAnimation.AnimateTo(Property(mContactCard, Actor::Property::POSITION_Y), foldedPosition.y, ALPHA_FUNCTION_FOLD, TIME_PERIOD_FOLD_Y);
-    mAnimation.AnimateTo(Property(mContactCard, Actor::Property::SIZE_WIDTH), mContactCardLayoutInfo.foldedSize.width, ALPHA_FUNCTION_FOLD, TIME_PERIOD_FOLD_WIDTH);
-    mAnimation.AnimateTo(Property(mContactCard, Actor::Property::SIZE_HEIGHT), mContactCardLayoutInfo.foldedSize.height, ALPHA_FUNCTION_FOLD, TIME_PERIOD_FOLD_HEIGHT);
+    animation.AnimateTo(Property(mContactCard, Actor::Property::POSITION_X), foldedPosition.x, ALPHA_FUNCTION_FOLD, TIME_PERIOD_FOLD_X);
+    animation.AnimateTo(Property(mContactCard, Actor::Property::POSITION_Y), foldedPosition.y, ALPHA_FUNCTION_FOLD, TIME_PERIOD_FOLD_Y);
+    animation.AnimateTo(Property(mContactCard, Actor::Property::SIZE_WIDTH), mContactCardLayoutInfo.foldedSize.width, ALPHA_FUNCTION_FOLD, TIME_PERIOD_FOLD_WIDTH);
+    animation.AnimateTo(Property(mContactCard, Actor::Property::SIZE_HEIGHT), mContactCardLayoutInfo.foldedSize.height, ALPHA_FUNCTION_FOLD, TIME_PERIOD_FOLD_HEIGHT);
 
     // Animate the header area out of position
-    mAnimation.AnimateTo(Property(mHeader, Actor::Property::POSITION_X), mContactCardLayoutInfo.headerFoldedPosition.x, ALPHA_FUNCTION_FOLD, TIME_PERIOD_FOLD_X);
-    mAnimation.AnimateTo(Property(mHeader, Actor::Property::POSITION_Y), mContactCardLayoutInfo.headerFoldedPosition.y, ALPHA_FUNCTION_FOLD, TIME_PERIOD_FOLD_Y);
+    animation.AnimateTo(Property(mHeader, Actor::Property::POSITION_X), mContactCardLayoutInfo.headerFoldedPosition.x, ALPHA_FUNCTION_FOLD, TIME_PERIOD_FOLD_X);
+    animation.AnimateTo(Property(mHeader, Actor::Property::POSITION_Y), mContactCardLayoutInfo.headerFoldedPosition.y, ALPHA_FUNCTION_FOLD, TIME_PERIOD_FOLD_Y);
 
     // Animate the clipped image into the folded position and into a circle
-    mAnimation.AnimateTo(Property(mClippedImage, Actor::Property::POSITION_X), mContactCardLayoutInfo.imageFoldedPosition.x, ALPHA_FUNCTION_FOLD, TIME_PERIOD_FOLD_X);
-    mAnimation.AnimateTo(Property(mClippedImage, Actor::Property::POSITION_Y), mContactCardLayoutInfo.imageFoldedPosition.y, ALPHA_FUNCTION_FOLD, TIME_PERIOD_FOLD_Y);
-    mAnimation.AnimateTo(Property(mClippedImage, mClippedImagePropertyIndex), ClippedImage::CIRCLE_GEOMETRY, ALPHA_FUNCTION_FOLD, TIME_PERIOD_FOLD_MESH_MORPH);
+    animation.AnimateTo(Property(mClippedImage, Actor::Property::POSITION_X), mContactCardLayoutInfo.imageFoldedPosition.x, ALPHA_FUNCTION_FOLD, TIME_PERIOD_FOLD_X);
+    animation.AnimateTo(Property(mClippedImage, Actor::Property::POSITION_Y), mContactCardLayoutInfo.imageFoldedPosition.y, ALPHA_FUNCTION_FOLD, TIME_PERIOD_FOLD_Y);
+    animation.AnimateTo(Property(mClippedImage, mClippedImagePropertyIndex), ClippedImage::CIRCLE_GEOMETRY, ALPHA_FUNCTION_FOLD, TIME_PERIOD_FOLD_MESH_MORPH);
 
     // Fade in the opacity of the name, and animate into the folded position
-    mAnimation.AnimateTo(Property(mNameText, Actor::Property::COLOR_ALPHA), 1.0f, ALPHA_FUNCTION_FOLD, TIME_PERIOD_FOLD_NAME_OPACITY);
-    mAnimation.AnimateTo(Property(mNameText, Actor::Property::POSITION_X), mContactCardLayoutInfo.textFoldedPosition.x, ALPHA_FUNCTION_FOLD, TIME_PERIOD_FOLD_X);
-    mAnimation.AnimateTo(Property(mNameText, Actor::Property::POSITION_Y), mContactCardLayoutInfo.textFoldedPosition.y, ALPHA_FUNCTION_FOLD, TIME_PERIOD_FOLD_Y);
+    animation.AnimateTo(Property(mNameText, Actor::Property::COLOR_ALPHA), 1.0f, ALPHA_FUNCTION_FOLD, TIME_PERIOD_FOLD_NAME_OPACITY);
+    animation.AnimateTo(Property(mNameText, Actor::Property::POSITION_X), mContactCardLayoutInfo.textFoldedPosition.x, ALPHA_FUNCTION_FOLD, TIME_PERIOD_FOLD_X);
+    animation.AnimateTo(Property(mNameText, Actor::Property::POSITION_Y), mContactCardLayoutInfo.textFoldedPosition.y, ALPHA_FUNCTION_FOLD, TIME_PERIOD_FOLD_Y);
 
     // Fade out the opacity of the detail, and animate into the folded position
-    mAnimation.AnimateTo(Property(mDetailText, Actor::Property::COLOR_ALPHA), 0.0f, ALPHA_FUNCTION_FOLD, TIME_PERIOD_FOLD_DETAIL_OPACITY);
-    mAnimation.AnimateTo(Property(mDetailText, Actor::Property::POSITION_X), mContactCardLayoutInfo.textFoldedPosition.x, ALPHA_FUNCTION_FOLD, TIME_PERIOD_FOLD_X);
-    mAnimation.AnimateTo(Property(mDetailText, Actor::Property::POSITION_Y), mContactCardLayoutInfo.textFoldedPosition.y, ALPHA_FUNCTION_FOLD, TIME_PERIOD_FOLD_Y);
-
-    // Slowly fade in all the siblings
-    Actor parent = mContactCard.GetParent();
-    for(size_t i = 0; i < parent.GetChildCount(); ++i)
-    {
-      Actor sibling = parent.GetChildAt(i);
-      if(sibling != mContactCard)
-      {
-        mAnimation.AnimateTo(Property(sibling, Actor::Property::COLOR_ALPHA), 1.0f, ALPHA_FUNCTION_FOLD, TIME_PERIOD_FOLD_SIBLING_OPACITY);
-        sibling.SetProperty(Actor::Property::SENSITIVE, true);
-      }
-    }
-
-    mAnimation.FinishedSignal().Connect(mSlotDelegate, &ContactCard::OnAnimationFinished);
-    mAnimation.Play();
+    animation.AnimateTo(Property(mDetailText, Actor::Property::COLOR_ALPHA), 0.0f, ALPHA_FUNCTION_FOLD, TIME_PERIOD_FOLD_DETAIL_OPACITY);
+    animation.AnimateTo(Property(mDetailText, Actor::Property::POSITION_X), mContactCardLayoutInfo.textFoldedPosition.x, ALPHA_FUNCTION_FOLD, TIME_PERIOD_FOLD_X);
+    animation.AnimateTo(Property(mDetailText, Actor::Property::POSITION_Y), mContactCardLayoutInfo.textFoldedPosition.y, ALPHA_FUNCTION_FOLD, TIME_PERIOD_FOLD_Y);
   }
 
   mFolded = !mFolded;
 }
 
-void ContactCard::OnAnimationFinished(Animation& animation)
+void ContactCard::OnAnimationFinished()
 {
-  // Ensure the finishing animation is the latest as we do not want to change state if a previous animation has finished
-  if(mAnimation == animation)
+  if(mFolded)
   {
-    if(mFolded)
-    {
-      mHeader.Unparent();
-      mDetailText.Unparent();
+    // Back with the other cards now that they have faded in again
+    mContainer.Add(mContactCard);
 
-      // Hide the clipped-image as we have finished animating the geometry and show the masked-image again
-      mClippedImage.SetProperty(Actor::Property::VISIBLE, false);
-      mMaskedImage.SetProperty(Actor::Property::VISIBLE, true);
-    }
-    else
-    {
-      mNameText.Unparent();
-    }
-    mAnimation.Reset();
-  }
-}
+    mHeader.Unparent();
+    mDetailText.Unparent();
 
-void ContactCard::OnKeyEvent(const KeyEvent& event)
-{
-  if((!mFolded) && // If we're folded then there's no need to do any more checking
-     (event.GetState() == KeyEvent::DOWN))
+    // Hide the clipped-image as we have finished animating the geometry and show the masked-image again
+    mClippedImage.SetProperty(Actor::Property::VISIBLE, false);
+    mMaskedImage.SetProperty(Actor::Property::VISIBLE, true);
+  }
+  else
   {
-    if(IsKey(event, Dali::DALI_KEY_ESCAPE) || IsKey(event, Dali::DALI_KEY_BACK))
-    {
-      KeyInputFocusManager keyInputFocusManager = KeyInputFocusManager::Get();
-      if(keyInputFocusManager.GetCurrentFocusControl() == mContactCard)
-      {
-        // Our contact-card is set to receive focus and we're unfolded so animate back to the folded state
-        Animate();
-      }
-    }
+    mNameText.Unparent();
   }
 }
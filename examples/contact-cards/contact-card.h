@@ -21,9 +21,7 @@
 // EXTERNAL INCLUDES
 #include <dali-toolkit/public-api/controls/control.h>
 #include <dali/public-api/actors/actor.h>
-#include <dali/public-api/adaptor-framework/window.h>
 #include <dali/public-api/animation/animation.h>
-#include <dali/public-api/events/tap-gesture-detector.h>
 #include <dali/public-api/object/ref-object.h>
 #include <string>
 
@@ -40,6 +38,9 @@ struct ContactCardLayoutInfo;
  * In this scenario, the control is small and there should be several of these contact cards visible on the screen.
  *
  * The contact card creates several controls that it requires to appropriately display itself in both of these states.
+ * Only the controls shown when folded are created upfront, the others are created the first time the card is unfolded.
+ *
+ * Tap detection and the fold/unfold animation are shared by all the contact cards, @see ContactCardLayouter.
  */
 class ContactCard : public Dali::RefObject
 {
@@ -47,62 +48,77 @@ public:
   /**
    * @brief Constructor.
    *
-   * This will create all the controls and add them to the window so should only be called after the init-signal from the Application has been received.
+   * This will create the folded controls and add them to the container so should only be called after the init-signal from the Application has been received.
    *
-   * @param[in]  window                 The window to add the contact card to.
+   * @param[in]  container              The actor to add the contact card to when folded.
    * @param[in]  contactCardLayoutInfo  Reference to the common data used by all contact cards.
    * @param[in]  contactName            The name of the contact to display.
    * @param[in]  contactAddress         The address of the contact to display.
    * @param[in]  imagePath              The path to the image to display.
    * @param[in]  position               The unique folded position of this particular contact-card.
    */
-  ContactCard(Dali::Window window, const ContactCardLayoutInfo& contactCardLayoutInfo, const std::string& contactName, const std::string& contactAddress, const std::string& imagePath, const Dali::Vector2& position);
+  ContactCard(Dali::Actor container, const ContactCardLayoutInfo& contactCardLayoutInfo, const std::string& contactName, const std::string& contactAddress, const std::string& imagePath, const Dali::Vector2& position);
 
-private:
   /**
-   * @brief Private Destructor. Will only be deleted when ref-count goes to 0.
+   * @brief Adds the fold/unfold animators of this card to the given animation and toggles the folded state.
    *
-   * Unparent the created contact card (i.e. remove from window).
+   * When unfolding, the card is moved to the overlay so that its siblings can be faded out together, @see AddSiblingAnimators.
+   *
+   * @param[in]  animation  The animation shared by all the cards folding or unfolding at the same time.
+   * @param[in]  overlay    The actor to add the card to while unfolded, on top of the container.
    */
-  ~ContactCard();
+  void AddAnimators(Dali::Animation& animation, Dali::Actor overlay);
 
   /**
-   * @brief Called when this contact card is tapped.
-   * @param[in]  actor    The tapped actor.
-   * @param[in]  gesture  The tap gesture.
+   * @brief Called when the animation the card was added to has finished.
    */
-  void OnTap(Dali::Actor actor, const Dali::TapGesture& gesture);
+  void OnAnimationFinished();
 
   /**
-   * @brief Animates the fold/unfold animation as required.
+   * @brief Adds the animators fading the folded cards out when a card unfolds, or in when it folds.
+   * @param[in]  animation  The animation shared by all the cards folding or unfolding at the same time.
+   * @param[in]  siblings   The container of the folded cards.
+   * @param[in]  unfold     Whether the cards are unfolding.
    */
-  void Animate();
+  static void AddSiblingAnimators(Dali::Animation& animation, Dali::Actor siblings, bool unfold);
 
   /**
-   * @brief Called when the animation finishes.
-   * @param[in]  animation  The animation which has just finished.
+   * @brief Whether the contact card is folded, or folding.
    */
-  void OnAnimationFinished(Dali::Animation& animation);
+  bool IsFolded() const
+  {
+    return mFolded;
+  }
 
   /**
-   * @brief Called when any key event is received
+   * @brief Whether the given point, in the coordinates of the container, is within the card.
+   */
+  bool Contains(const Dali::Vector2& point) const;
+
+private:
+  /**
+   * @brief Private Destructor. Will only be deleted when ref-count goes to 0.
    *
-   * Will use this to fold a contact card if it is unfolded.
-   * @param[in]  event  The key event information
+   * Unparent the created contact card (i.e. remove from window).
    */
-  void OnKeyEvent(const Dali::KeyEvent& event);
+  ~ContactCard();
 
-  Dali::TapGestureDetector mTapDetector;  ///< Used for tap detection.
-  Dali::Toolkit::Control   mContactCard;  ///< Used for the background and to clip the contents.
-  Dali::Toolkit::Control   mHeader;       ///< Header shown when unfolded.
-  Dali::Toolkit::Control   mClippedImage; ///< The image representing the contact (whose clipping can be animated).
-  Dali::Toolkit::Control   mMaskedImage;  ///< The image with a mask (better quality around the edges than the clipped image when folded).
-  Dali::Toolkit::Control   mNameText;     ///< The text shown when folded.
-  Dali::Toolkit::Control   mDetailText;   ///< The text shown when unfolded.
+  /**
+   * @brief Creates the controls only shown when unfolded, the first time the card unfolds.
+   */
+  void CreateUnfoldedControls();
 
-  Dali::Animation mAnimation; ///< The fold/unfold animation.
+  Dali::Actor            mContainer;    ///< The parent of the card when folded.
+  Dali::Toolkit::Control mContactCard;  ///< Used for the background and to clip the contents.
+  Dali::Toolkit::Control mHeader;       ///< Header shown when unfolded.
+  Dali::Toolkit::Control mClippedImage; ///< The image representing the contact (whose clipping can be animated).
+  Dali::Toolkit::Control mMaskedImage;  ///< The image with a mask (better quality around the edges than the clipped image when folded).
+  Dali::Toolkit::Control mNameText;     ///< The text shown when folded.
+  Dali::Toolkit::Control mDetailText;   ///< The text shown when unfolded.
 
-  Dali::SlotDelegate<ContactCard> mSlotDelegate; ///< Used to automatically disconnect our member functions from signals that this class connects to upon destruction. Can be used instead of inheriting from ConnectionTracker.
+  const std::string mContactName;    ///< Kept to create the detail text when first unfolded.
+  const std::string mContactAddress; ///< Kept to create the detail text when first unfolded.
+  const std::string mImagePath;      ///< Kept to create the clipped image when first unfolded.
 
   const ContactCardLayoutInfo& mContactCardLayoutInfo;     ///< Reference to the common data used by all contact cards.
   const Dali::Vector2          foldedPosition;             ///< The unique position of this card when it is folded.
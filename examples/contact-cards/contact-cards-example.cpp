@@ -20,10 +20,16 @@
 #include <dali/public-api/adaptor-framework/application.h>
 #include <dali/public-api/adaptor-framework/key.h>
 #include <dali/public-api/events/key-event.h>
+#include <algorithm>
+#include <cstdlib>
+#include <iostream>
+#include <memory>
+#include <string>
 #include <vector>
 
 // INTERNAL INCLUDES
 #include "contact-card-layouter.h"
+#include "contact-card-stress.h"
 #include "contact-data.h"
 
 using namespace Dali;
@@ -33,6 +39,10 @@ namespace
 {
 const Vector4     WINDOW_COLOR(211.0f / 255.0f, 211.0f / 255.0f, 211.0f / 255.0f, 1.0f); ///< The color of the window
 const char* const THEME_PATH(DEMO_STYLE_DIR "contact-cards-example-theme.json");         ///< The theme used for this example
+const size_t      FIRST_STRESS_CARD_COUNT(250u);                                          ///< The number of contacts the stress mode starts with, doubled up to the maximum
+
+bool   gStress(false);             ///< Whether to lay out an increasing number of generated contacts, set with the --stress option
+size_t gStressMaxCardCount(4000u); ///< The maximum number of generated contacts, set with the -n option
 } // unnamed namespace
 
 /**
@@ -43,11 +53,14 @@ const char* const THEME_PATH(DEMO_STYLE_DIR "contact-cards-example-theme.json");
  *
  * ContactCardLayouter: This class is used to lay out the different contact cards on the screen.
  *                      This takes window size into account but does not support relayouting.
+ *                      It detects the taps on all the cards and runs the fold/unfold animation shared by the cards.
  * ContactCard: This class represents each contact card on the screen.
- *              Two animations are set up in this class which animate several properties with multiple start and stop times.
+ *              Two sets of animators are set up in this class which animate several properties with multiple start and stop times.
  *              An overview of the two animations can be found in contact-card.cpp.
  * ContactCardLayoutInfo: This is a structure to store common layout information and is created by the ContactCardLayouter and used by each ContactCard.
  * ContactData: This namespace contains a table which has the contact information we use to populate the contact cards.
+ *              It can also generate any number of contacts from the table, which the stress mode uses.
+ * ContactCardStress: This class lays out an increasing number of generated contacts and reports the layout and fold frame times.
  * ClippedImage: This namespace provides a helper function which creates an ImageView which is added to a control that has clipping.
  *               This clipping comes in the form of a Circle or Quad.
  *               The Vertex shader mixes in the Circle and Quad geometry depending on the value of a uniform float.
@@ -81,6 +94,20 @@ private:
     window.SetBackgroundColor(WINDOW_COLOR);
     window.KeyEventSignal().Connect(this, &ContactCardController::OnKeyEvent);
 
+    if(gStress)
+    {
+      std::vector<size_t> cardCounts;
+      for(size_t count = FIRST_STRESS_CARD_COUNT; count < gStressMaxCardCount; count *= 2u)
+      {
+        cardCounts.push_back(count);
+      }
+      cardCounts.push_back(gStressMaxCardCount);
+
+      mStress = std::make_unique<ContactCardStress>(window, mContactCardLayouter, cardCounts);
+      mStress->Start();
+      return;
+    }
+
     // Add all the contacts to the layouter
     for(size_t i = 0; i < ContactData::TABLE_SIZE; ++i)
     {
@@ -109,12 +136,35 @@ private:
     }
   }
 
-  Application&        mApplication;         ///< Reference to the application class.
-  ContactCardLayouter mContactCardLayouter; ///< The contact card layouter.
+  Application&                       mApplication;         ///< Reference to the application class.
+  ContactCardLayouter                mContactCardLayouter; ///< The contact card layouter.
+  std::unique_ptr<ContactCardStress> mStress;              ///< Only created in the stress mode.
 };
 
 int DALI_EXPORT_API main(int argc, char** argv)
 {
+  for(int i(1); i < argc; ++i)
+  {
+    std::string arg(argv[i]);
+    if(arg.compare("--stress") == 0)
+    {
+      gStress = true;
+    }
+    else if(arg.compare(0, 2, "-n") == 0)
+    {
+      gStressMaxCardCount = std::max(1, atoi(arg.substr(2, arg.size()).c_str()));
+    }
+    else if((arg.compare("--help") == 0) || (arg.compare("-h") == 0))
+    {
+      std::cout << "contact-cards.example [OPTIONS]" << std::endl;
+      std::cout << "  Options:" << std::endl;
+      std::cout << "    --stress    Lays out an increasing number of generated contacts, folding and unfolding them, and shows a table of the frame times" << std::endl;
+      std::cout << "    -n[count]   Maximum number of contacts laid out by the stress mode, 4000 by default" << std::endl;
+      std::cout << "    -h|--help   Help" << std::endl;
+      return 0;
+    }
+  }
+
   Application           application = Application::New(&argc, &argv, THEME_PATH);
   ContactCardController contactCardController(application);
   application.MainLoop();
@@ -18,6 +18,10 @@
 // HEADER
 #include "contact-data.h"
 
+// EXTERNAL INCLUDES
+#include <algorithm>
+#include <utility>
+
 namespace ContactData
 {
 const Item TABLE[] =
@@ -40,4 +44,30 @@ const Item TABLE[] =
 };
 const size_t TABLE_SIZE = sizeof(TABLE) / sizeof(TABLE[0]);
 
+std::vector<GeneratedItem> Generate(size_t count)
+{
+  std::vector<GeneratedItem> contacts;
+  contacts.reserve(count);
+
+  for(size_t i = 0; i < count; ++i)
+  {
+    // Pair the first name of one contact with the surname of another so the names are unique for TABLE_SIZE squared contacts
+    const std::string firstName(TABLE[i % TABLE_SIZE].name);
+    const std::string surname(TABLE[(i / TABLE_SIZE + i) % TABLE_SIZE].name);
+
+    GeneratedItem contact;
+    contact.name = firstName.substr(0, firstName.find(' ')) + surname.substr(std::min(surname.rfind(' '), surname.size()));
+    if(i >= TABLE_SIZE * TABLE_SIZE)
+    {
+      contact.name += ' ';
+      contact.name += std::to_string(i / (TABLE_SIZE * TABLE_SIZE) + 1);
+    }
+
+    contact.address   = std::to_string(i + 1) + ' ' + TABLE[(i * 7) % TABLE_SIZE].address;
+    contact.imagePath = TABLE[(i * 11) % TABLE_SIZE].imagePath;
+    contacts.push_back(std::move(contact));
+  }
+  return contacts;
+}
+
 } // namespace ContactData
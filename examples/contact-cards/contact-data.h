@@ -20,6 +20,8 @@
 
 // EXTERNAL INCLUDES
 #include <cstddef>
+#include <string>
+#include <vector>
 
 namespace ContactData
 {
@@ -36,6 +38,22 @@ struct Item
 extern const Item   TABLE[];    ///< The table that has the information for all the contacts.
 extern const size_t TABLE_SIZE; ///< The size of TABLE. Can use this to iterate through TABLE.
 
+struct GeneratedItem
+{
+  std::string name;      ///< The name of the contact.
+  std::string address;   ///< The address of the contact.
+  std::string imagePath; ///< The path to the image that represents the contact.
+};
+
+/**
+ * @brief Generates synthetic contacts by mixing the names, addresses and images of the contacts in TABLE.
+ *
+ * The same contacts are generated for a given count.
+ * @param[in]  count  The number of contacts to generate.
+ * @return The generated contacts.
+ */
+std::vector<GeneratedItem> Generate(size_t count);
+
 } // namespace ContactData
 
 #endif // CONTACT_DATA_H
@@ -20,6 +20,7 @@
 
 // EXTERNAL INCLUDES
 #include <dali-toolkit/dali-toolkit.h>
+#include <dali-toolkit/devel-api/visuals/image-visual-properties-devel.h>
 
 namespace MaskedImage
 {
@@ -33,12 +34,15 @@ const char* const IMAGE_MASK(DEMO_IMAGE_DIR "contact-cards-mask.png");
 
 Dali::Toolkit::Control Create(const std::string& imagePath)
 {
+  // Mask when rendering so that all the images share the mask texture and the shader, and the texture of each
+  // image is shared with the clipped image using it rather than a masked copy being made for every contact
   Control maskedImage = ImageView::New();
   maskedImage.SetProperty(
     Toolkit::ImageView::Property::IMAGE,
     Property::Map{{Visual::Property::TYPE, Toolkit::Visual::Type::IMAGE},
                   {ImageVisual::Property::URL, imagePath},
-                  {ImageVisual::Property::ALPHA_MASK_URL, IMAGE_MASK}});
+                  {ImageVisual::Property::ALPHA_MASK_URL, IMAGE_MASK},
+                  {DevelImageVisual::Property::MASKING_TYPE, DevelImageVisual::MaskingType::MASKING_ON_RENDERING}});
   return maskedImage;
 }
 
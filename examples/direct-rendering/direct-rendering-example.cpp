@@ -16,10 +16,14 @@
  */
 
 #include <dali-toolkit/dali-toolkit.h>
+#include "matrix-benchmark.h"
 #include "native-renderer.h"
 #include <dali/integration-api/debug.h>
 
 #include <dali/public-api/render-tasks/render-task-list.h>
+
+#include <algorithm>
+#include <cstdio>
 using namespace Dali;
 using namespace Dali::Toolkit;
 namespace
@@ -41,6 +45,40 @@ int GetEnvInt(const char* name, int def)
  */
 const uint32_t DR_THREAD_ENABLED = GetEnvInt("DR_THREAD_ENABLED", 0);
 
+/**
+ * Environment variable: INSTANCED_ENABLED (default: 0)
+ *
+ * When set to 1 cubes are rendered from GPU buffers with a single instanced draw call
+ * instead of a draw call per cube. Can be toggled at runtime with the 'i' key.
+ */
+const uint32_t INSTANCED_ENABLED = GetEnvInt("INSTANCED_ENABLED", 0);
+
+/**
+ * Environment variable: PRODUCER_ENABLED (default: 0)
+ *
+ * When set to 1 cubes are rendered instanced, with the instance data of the next frame prepared
+ * by a worker thread into a ring of three buffers paced with GL fences. Takes precedence over
+ * INSTANCED_ENABLED.
+ */
+const uint32_t PRODUCER_ENABLED = GetEnvInt("PRODUCER_ENABLED", 0);
+
+/**
+ * Environment variable: MATRIX_BENCHMARK (default: 0)
+ *
+ * When set to number of instances, runs the matrix micro-benchmark and quits.
+ */
+const uint32_t MATRIX_BENCHMARK = GetEnvInt("MATRIX_BENCHMARK", 0);
+
+/**
+ * Number of iterations of the matrix micro-benchmark
+ */
+const uint32_t MATRIX_BENCHMARK_ITERATIONS = 200;
+
+/**
+ * Interval of updating the statistics label, in milliseconds
+ */
+const uint32_t STATS_UPDATE_INTERVAL = 1000;
+
 /**
  * Environment variable: EGL_ENABLED
  *
@@ -53,6 +91,38 @@ const uint32_t DR_THREAD_ENABLED = GetEnvInt("DR_THREAD_ENABLED", 0);
  * Enables/disables rendering within GL window context rather than creating isolated context
  */
 
+/**
+ * Returns name of the render mode shown by the statistics label
+ */
+const char* GetRenderModeName(NativeRenderer::RenderMode mode)
+{
+  switch(mode)
+  {
+    case NativeRenderer::RenderMode::INSTANCED:
+      return "instanced";
+    case NativeRenderer::RenderMode::PRODUCER:
+      return "producer thread";
+    default:
+      return "per object";
+  }
+}
+
+/**
+ * Returns the render mode following the given one, cycling through all of them
+ */
+NativeRenderer::RenderMode GetNextRenderMode(NativeRenderer::RenderMode mode)
+{
+  switch(mode)
+  {
+    case NativeRenderer::RenderMode::PER_OBJECT:
+      return NativeRenderer::RenderMode::INSTANCED;
+    case NativeRenderer::RenderMode::INSTANCED:
+      return NativeRenderer::RenderMode::PRODUCER;
+    default:
+      return NativeRenderer::RenderMode::PER_OBJECT;
+  }
+}
+
 } // namespace
 
 /**
@@ -97,6 +167,14 @@ struct RenderView
     }
 
     mRenderer            = std::make_unique<NativeRenderer>(info);
+    if(PRODUCER_ENABLED)
+    {
+      mRenderer->SetRenderMode(NativeRenderer::RenderMode::PRODUCER);
+    }
+    else if(INSTANCED_ENABLED)
+    {
+      mRenderer->SetRenderMode(NativeRenderer::RenderMode::INSTANCED);
+    }
     mGlInitCallback      = MakeCallback(mRenderer.get(), &NativeRenderer::GlViewInitCallback);
     mGlRenderCallback    = MakeCallback(mRenderer.get(), &NativeRenderer::GlViewRenderCallback);
     mGlTerminateCallback = MakeCallback(mRenderer.get(), &NativeRenderer::GlViewTerminateCallback);
@@ -137,6 +215,14 @@ struct RenderView
     textLabel.SetProperty(Dali::Actor::Property::POSITION, Vector2(0, 0));
     glView.Add(textLabel);
 
+    mStatsLabel = TextLabel::New();
+    mStatsLabel.SetProperty(TextLabel::Property::TEXT_COLOR, Color::WHITE);
+    mStatsLabel.SetProperty(TextLabel::Property::MULTI_LINE, true);
+    mStatsLabel.SetProperty(Actor::Property::ANCHOR_POINT, AnchorPoint::TOP_CENTER);
+    mStatsLabel.SetProperty(Actor::Property::PARENT_ORIGIN, ParentOrigin::BOTTOM_CENTER);
+    mStatsLabel.SetProperty(Dali::Actor::Property::NAME, "stats");
+    textLabel.Add(mStatsLabel);
+
     mWindow.Add(glView);
 
     mGlView = glView;
@@ -144,8 +230,31 @@ struct RenderView
     return 0;
   }
 
+  /**
+   * Shows statistics of the frames rendered since the previous call
+   */
+  void UpdateStats()
+  {
+    auto stats = mRenderer->ResetFrameStats();
+    auto mode  = mRenderer->GetRenderMode();
+
+    char text[256];
+    int  length = snprintf(text, sizeof(text), "%s, cubes: %u, draws: %.0f, render: %.2f ms, fps: %u",
+                          GetRenderModeName(mode),
+                          mRenderer->GetCubeCount(),
+                          stats.drawCalls,
+                          stats.renderTimeMs,
+                          stats.frames * 1000 / STATS_UPDATE_INTERVAL);
+    if(mode == NativeRenderer::RenderMode::PRODUCER && length > 0 && size_t(length) < sizeof(text))
+    {
+      snprintf(text + length, sizeof(text) - length, "\nproduce: %.2f ms, overlap: %.0f%%, latency: %.2f ms, stalls: %u", stats.produceTimeMs, stats.overlapPercent, stats.latencyMs, stats.stalls);
+    }
+    mStatsLabel.SetProperty(TextLabel::Property::TEXT, text);
+  }
+
   Dali::Window                    mWindow;
   Toolkit::GlView                 mGlView;
+  TextLabel                       mStatsLabel;
   std::unique_ptr<NativeRenderer> mRenderer{};
 
   CallbackBase* mGlInitCallback{};
@@ -193,6 +302,16 @@ public:
     }
 
     mDRView->Create(Vector2::ZERO, mode);
+
+    mStatsTimer = Timer::New(STATS_UPDATE_INTERVAL);
+    mStatsTimer.TickSignal().Connect(this, &DirectRenderingExampleController::OnStatsTimer);
+    mStatsTimer.Start();
+  }
+
+  bool OnStatsTimer()
+  {
+    mDRView->UpdateStats();
+    return true;
   }
 
   bool OnTouch(Actor actor, const TouchEvent& touch)
@@ -206,20 +325,40 @@ public:
   {
     if(event.GetState() == KeyEvent::DOWN)
     {
+      auto& renderer = mDRView->mRenderer;
       if(IsKey(event, Dali::DALI_KEY_ESCAPE) || IsKey(event, Dali::DALI_KEY_BACK))
       {
         mApplication.Quit();
       }
+      else if(event.GetKeyName() == "i")
+      {
+        renderer->SetRenderMode(GetNextRenderMode(renderer->GetRenderMode()));
+      }
+      else if(event.GetKeyString() == "+")
+      {
+        renderer->SetCubeCount(std::max(renderer->GetCubeCount() * 2u, 1u));
+      }
+      else if(event.GetKeyString() == "-")
+      {
+        renderer->SetCubeCount(renderer->GetCubeCount() / 2u);
+      }
     }
   }
 
 private:
   Application&                mApplication;
   std::unique_ptr<RenderView> mDRView;
+  Timer                       mStatsTimer;
 };
 
 int DALI_EXPORT_API main(int argc, char** argv)
 {
+  if(MATRIX_BENCHMARK)
+  {
+    RunMatrixBenchmark(MATRIX_BENCHMARK, MATRIX_BENCHMARK_ITERATIONS);
+    return 0;
+  }
+
   Application                      application = Application::New(&argc, &argv);
   DirectRenderingExampleController test(application);
   application.MainLoop();
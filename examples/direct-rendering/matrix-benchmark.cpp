@@ -0,0 +1,182 @@
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include "matrix-benchmark.h"
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+
+#include "shared/simd-matrix.h"
+
+using DemoHelper::Matrix4;
+
+namespace
+{
+/**
+ * Input and output of a single benchmark case
+ */
+struct BenchmarkData
+{
+  std::vector<float>   positions; ///< x, y, z of each instance
+  std::vector<Matrix4> locals;    ///< Local matrices of the instances
+  std::vector<Matrix4> results;
+  float                angle{0.0f};
+};
+
+/**
+ * Pre-multiplies by a full matrix, the way the hand-rolled helpers used to work
+ */
+template<typename Ops>
+void BuildWithFullProducts(BenchmarkData& data)
+{
+  Matrix4 temp;
+  for(size_t i = 0; i < data.results.size(); ++i)
+  {
+    Matrix4&     m        = data.results[i];
+    const float* position = &data.positions[i * 3];
+    Ops::Identity(m);
+    Ops::Identity(temp);
+    Ops::Scale(temp, 0.2f, 0.2f, 0.2f);
+    Ops::Multiply(m, temp, m);
+    Ops::Identity(temp);
+    Ops::RotateX(temp, data.angle);
+    Ops::Multiply(m, temp, m);
+    Ops::Identity(temp);
+    Ops::RotateY(temp, data.angle);
+    Ops::Multiply(m, temp, m);
+    Ops::Identity(temp);
+    Ops::Translate(temp, position[0], position[1], position[2]);
+    Ops::Multiply(m, temp, m);
+  }
+}
+
+/**
+ * Applies every transformation in place
+ */
+template<typename Ops>
+void BuildWithFastPaths(BenchmarkData& data)
+{
+  for(size_t i = 0; i < data.results.size(); ++i)
+  {
+    Matrix4&     m        = data.results[i];
+    const float* position = &data.positions[i * 3];
+    Ops::Identity(m);
+    Ops::Scale(m, 0.2f, 0.2f, 0.2f);
+    Ops::RotateX(m, data.angle);
+    Ops::RotateY(m, data.angle);
+    Ops::Translate(m, position[0], position[1], position[2]);
+  }
+}
+
+/**
+ * Builds the shared part once, then translates all the instances at once
+ */
+template<typename Ops>
+void BuildWithBatchedTranslate(BenchmarkData& data)
+{
+  Matrix4 base;
+  Ops::Identity(base);
+  Ops::Scale(base, 0.2f, 0.2f, 0.2f);
+  Ops::RotateX(base, data.angle);
+  Ops::RotateY(base, data.angle);
+  Ops::TranslateBatch(data.results.data(), base, data.positions.data(), data.results.size());
+}
+
+/**
+ * Transforms local matrices of all the instances by a shared parent
+ */
+template<typename Ops>
+void BuildWithBatchedMultiply(BenchmarkData& data)
+{
+  Matrix4 parent;
+  Ops::Identity(parent);
+  Ops::RotateY(parent, data.angle);
+  Ops::Translate(parent, 0.0f, 0.0f, -5.0f);
+  Ops::Multiply(data.results.data(), parent, data.locals.data(), data.results.size());
+}
+
+/**
+ * Returns average time of a single call of function, in microseconds
+ */
+double Measure(void (*function)(BenchmarkData&), BenchmarkData& data, uint32_t iterations, float& checksum)
+{
+  const auto start = std::chrono::steady_clock::now();
+  for(uint32_t i = 0; i < iterations; ++i)
+  {
+    data.angle = float(i % 360);
+    function(data);
+    checksum += data.results[i % data.results.size()].m[i % 16];
+  }
+  const auto end = std::chrono::steady_clock::now();
+  return std::chrono::duration<double, std::micro>(end - start).count() / iterations;
+}
+
+} // namespace
+
+void RunMatrixBenchmark(uint32_t instanceCount, uint32_t iterations)
+{
+  using ScalarOps = DemoHelper::Matrix4ScalarOps;
+  using SimdOps   = DemoHelper::Matrix4Ops;
+
+  struct Case
+  {
+    const char* name;
+    void (*scalar)(BenchmarkData&);
+    void (*simd)(BenchmarkData&);
+  };
+
+  const Case cases[] = {
+    {"full products", &BuildWithFullProducts<ScalarOps>, &BuildWithFullProducts<SimdOps>},
+    {"affine fast paths", &BuildWithFastPaths<ScalarOps>, &BuildWithFastPaths<SimdOps>},
+    {"batched translate", &BuildWithBatchedTranslate<ScalarOps>, &BuildWithBatchedTranslate<SimdOps>},
+    {"batched multiply", &BuildWithBatchedMultiply<ScalarOps>, &BuildWithBatchedMultiply<SimdOps>},
+  };
+
+  instanceCount = instanceCount ? instanceCount : 1u;
+  iterations    = iterations ? iterations : 1u;
+
+  BenchmarkData data;
+  data.results.resize(instanceCount);
+  data.locals.resize(instanceCount);
+  srand(10);
+  for(uint32_t i = 0; i < instanceCount; ++i)
+  {
+    const float position[3] = {float((rand() % 7000) - 3500) / 1000.0f, float((rand() % 7000) - 3500) / 1000.0f, -5.0f};
+    data.positions.insert(data.positions.end(), position, position + 3);
+
+    ScalarOps::Identity(data.locals[i]);
+    ScalarOps::Scale(data.locals[i], 0.2f, 0.2f, 0.2f);
+    ScalarOps::Translate(data.locals[i], position[0], position[1], 0.0f);
+  }
+
+  printf("Matrix benchmark: %u instances, %u iterations, SIMD: %s\n",
+         instanceCount,
+         iterations,
+         DemoHelper::IsMatrix4OpsVectorised() ? "yes" : "no (scalar fallback)");
+  printf("%-20s %12s %12s %10s\n", "case", "scalar us", "simd us", "speed-up");
+
+  float checksum = 0.0f;
+  for(const auto& benchmarkCase : cases)
+  {
+    const double scalarTime = Measure(benchmarkCase.scalar, data, iterations, checksum);
+    const double simdTime   = Measure(benchmarkCase.simd, data, iterations, checksum);
+    printf("%-20s %12.2f %12.2f %9.2fx\n", benchmarkCase.name, scalarTime, simdTime, simdTime > 0.0 ? scalarTime / simdTime : 0.0);
+  }
+  printf("(checksum %f)\n", checksum);
+}
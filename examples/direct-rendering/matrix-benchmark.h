@@ -0,0 +1,30 @@
+#ifndef DALI_DIRECT_RENDERING_MATRIX_BENCHMARK_H
+#define DALI_DIRECT_RENDERING_MATRIX_BENCHMARK_H
+
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <cstdint>
+
+/**
+ * Measures building model-view matrices of instanceCount cubes the way NativeRenderer does,
+ * with full matrix products, affine fast paths and batched operations, each using the scalar
+ * and the SIMD implementation of DemoHelper::Matrix4Ops. Results are printed to stdout.
+ */
+void RunMatrixBenchmark(uint32_t instanceCount, uint32_t iterations);
+
+#endif // DALI_DIRECT_RENDERING_MATRIX_BENCHMARK_H
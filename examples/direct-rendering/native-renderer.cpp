@@ -16,11 +16,14 @@
  */
 
 #include "native-renderer.h"
+#include <algorithm>
+#include <chrono>
+#include <cstring>
 #include <iostream>
 
-/**
- * Set of math helper functions
- */
+using DemoHelper::Matrix4;
+using DemoHelper::Matrix4Ops;
+
 namespace
 {
 [[maybe_unused]] std::vector<std::string> split(const std::string& s, char seperator)
@@ -51,6 +54,14 @@ int GetEnvInt(const char* name, int def)
 
 const uint32_t MAX_CUBES = GetEnvInt("MAX_CUBES", 200);
 
+// Longest wait of the render callback for the worker thread or the GPU in PRODUCER mode
+constexpr auto PRODUCER_WAIT_TIMEOUT = std::chrono::milliseconds(100);
+
+uint64_t GetTimeMicroseconds()
+{
+  return std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
 #define GL(x)                                                   \
   {                                                             \
     glGetError();                                               \
@@ -97,138 +108,18 @@ constexpr float QUAD_UV[] = {
   1.0f // top left
 };
 
-float matrixDegreesToRadians(float degrees)
-{
-  return M_PI * degrees / 180.0f;
-}
-
-[[maybe_unused]] void matrixIdentityFunction(float* matrix)
-{
-  if(matrix == NULL)
-  {
-    return;
-  }
-  matrix[0]  = 1.0f;
-  matrix[1]  = 0.0f;
-  matrix[2]  = 0.0f;
-  matrix[3]  = 0.0f;
-  matrix[4]  = 0.0f;
-  matrix[5]  = 1.0f;
-  matrix[6]  = 0.0f;
-  matrix[7]  = 0.0f;
-  matrix[8]  = 0.0f;
-  matrix[9]  = 0.0f;
-  matrix[10] = 1.0f;
-  matrix[11] = 0.0f;
-  matrix[12] = 0.0f;
-  matrix[13] = 0.0f;
-  matrix[14] = 0.0f;
-  matrix[15] = 1.0f;
-}
-
-[[maybe_unused]] void matrixMultiply(float* destination, float* operand1, float* operand2)
-{
-  float theResult[16];
-  int   i, j = 0;
-  for(i = 0; i < 4; i++)
-  {
-    for(j = 0; j < 4; j++)
-    {
-      theResult[4 * i + j] = operand1[j] * operand2[4 * i] + operand1[4 + j] * operand2[4 * i + 1] +
-                             operand1[8 + j] * operand2[4 * i + 2] + operand1[12 + j] * operand2[4 * i + 3];
-    }
-  }
-  for(i = 0; i < 16; i++)
-  {
-    destination[i] = theResult[i];
-  }
-}
-
-[[maybe_unused]] void matrixTranslate(float* matrix, float x, float y, float z)
-{
-  float temporaryMatrix[16];
-  matrixIdentityFunction(temporaryMatrix);
-  temporaryMatrix[12] = x;
-  temporaryMatrix[13] = y;
-  temporaryMatrix[14] = z;
-  matrixMultiply(matrix, temporaryMatrix, matrix);
-}
-
-[[maybe_unused]] void matrixScale(float* matrix, float x, float y, float z)
-{
-  float tempMatrix[16];
-  matrixIdentityFunction(tempMatrix);
-  tempMatrix[0]  = x;
-  tempMatrix[5]  = y;
-  tempMatrix[10] = z;
-  matrixMultiply(matrix, tempMatrix, matrix);
-}
-
-[[maybe_unused]] void matrixRotateX(float* matrix, float angle)
-{
-  float tempMatrix[16];
-  matrixIdentityFunction(tempMatrix);
-  tempMatrix[5]  = cos(matrixDegreesToRadians(angle));
-  tempMatrix[9]  = -sin(matrixDegreesToRadians(angle));
-  tempMatrix[6]  = sin(matrixDegreesToRadians(angle));
-  tempMatrix[10] = cos(matrixDegreesToRadians(angle));
-  matrixMultiply(matrix, tempMatrix, matrix);
-}
-[[maybe_unused]] void matrixRotateY(float* matrix, float angle)
-{
-  float tempMatrix[16];
-  matrixIdentityFunction(tempMatrix);
-  tempMatrix[0]  = cos(matrixDegreesToRadians(angle));
-  tempMatrix[8]  = sin(matrixDegreesToRadians(angle));
-  tempMatrix[2]  = -sin(matrixDegreesToRadians(angle));
-  tempMatrix[10] = cos(matrixDegreesToRadians(angle));
-  matrixMultiply(matrix, tempMatrix, matrix);
-}
-[[maybe_unused]] void matrixRotateZ(float* matrix, float angle)
-{
-  float tempMatrix[16];
-  matrixIdentityFunction(tempMatrix);
-  tempMatrix[0] = cos(matrixDegreesToRadians(angle));
-  tempMatrix[4] = -sin(matrixDegreesToRadians(angle));
-  tempMatrix[1] = sin(matrixDegreesToRadians(angle));
-  tempMatrix[5] = cos(matrixDegreesToRadians(angle));
-  matrixMultiply(matrix, tempMatrix, matrix);
-}
-
-void matrixFrustum(float* matrix, float left, float right, float bottom, float top, float zNear, float zFar)
-{
-  float temp, xDistance, yDistance, zDistance;
-  temp      = 2.0 * zNear;
-  xDistance = right - left;
-  yDistance = top - bottom;
-  zDistance = zFar - zNear;
-  matrixIdentityFunction(matrix);
-  matrix[0]  = temp / xDistance;
-  matrix[5]  = temp / yDistance;
-  matrix[8]  = (right + left) / xDistance;
-  matrix[9]  = (top + bottom) / yDistance;
-  matrix[10] = (-zFar - zNear) / zDistance;
-  matrix[11] = -1.0f;
-  matrix[14] = (-temp * zFar) / zDistance;
-  matrix[15] = 0.0f;
-}
+} // namespace
 
-[[maybe_unused]] void matrixPerspective(float* matrix, float fieldOfView, float aspectRatio, float zNear, float zFar)
+NativeRenderer::~NativeRenderer()
 {
-  float ymax, xmax;
-  ymax = zNear * tanf(fieldOfView * M_PI / 360.0);
-  xmax = ymax * aspectRatio;
-  matrixFrustum(matrix, -xmax, xmax, -ymax, ymax, zNear, zFar);
+  StopProducer();
 }
 
-} // namespace
-
-NativeRenderer::~NativeRenderer() = default;
-
 NativeRenderer::NativeRenderer(const CreateInfo& info)
 : mWidth(info.width),
   mHeight(info.height),
-  mCreateInfo(info)
+  mCreateInfo(info),
+  mCubeCount(MAX_CUBES)
 {
 }
 
@@ -267,6 +158,87 @@ void NativeRenderer::Setup(int width, int height)
   mModelViewLocation    = glGetUniformLocation(mProgramId, "modelView");
 
   GL(glEnable(GL_DEPTH_TEST));
+
+  SetupInstancing();
+}
+
+void NativeRenderer::SetupInstancing()
+{
+  static const char glVertexShader[] =
+    "#version 300 es\n"
+    "in vec4 vertexPosition;\n"
+    "in vec3 vertexColour;\n"
+    "in mat4 instanceModelView;\n"
+    "out vec3 fragColour;\n"
+    "uniform mat4 projection;\n"
+    "void main()\n"
+    "{\n"
+    "    gl_Position = projection * instanceModelView * vertexPosition;\n"
+    "    fragColour = vertexColour;\n"
+    "}\n";
+
+  static const char glFragmentShader[] =
+    "#version 300 es\n"
+    "precision mediump float;\n"
+    "in vec3 fragColour;\n"
+    "out vec4 outColour;\n"
+    "void main()\n"
+    "{\n"
+    "    outColour = vec4(fragColour, 1.0);\n"
+    "}\n";
+
+  mInstancedProgramId = CreateProgram(glVertexShader, glFragmentShader);
+
+  mInstancedVertexLocation       = glGetAttribLocation(mInstancedProgramId, "vertexPosition");
+  mInstancedVertexColourLocation = glGetAttribLocation(mInstancedProgramId, "vertexColour");
+  mInstancedModelViewLocation    = glGetAttribLocation(mInstancedProgramId, "instanceModelView");
+  mInstancedProjectionLocation   = glGetUniformLocation(mInstancedProgramId, "projection");
+
+  GL(glGenVertexArrays(1, &mVertexArray));
+  GL(glGenBuffers(1, &mVertexBuffer));
+  GL(glGenBuffers(1, &mColourBuffer));
+  GL(glGenBuffers(1, &mIndexBuffer));
+  GL(glGenBuffers(1, &mInstanceBuffer));
+
+  GL(glBindVertexArray(mVertexArray));
+
+  GL(glBindBuffer(GL_ARRAY_BUFFER, mVertexBuffer));
+  GL(glBufferData(GL_ARRAY_BUFFER, sizeof(CUBE_VERTICES), CUBE_VERTICES, GL_STATIC_DRAW));
+  GL(glVertexAttribPointer(mInstancedVertexLocation, 3, GL_FLOAT, GL_FALSE, 0, nullptr));
+  GL(glEnableVertexAttribArray(mInstancedVertexLocation));
+
+  GL(glBindBuffer(GL_ARRAY_BUFFER, mColourBuffer));
+  GL(glBufferData(GL_ARRAY_BUFFER, sizeof(CUBE_COLOURS), CUBE_COLOURS, GL_STATIC_DRAW));
+  GL(glVertexAttribPointer(mInstancedVertexColourLocation, 3, GL_FLOAT, GL_FALSE, 0, nullptr));
+  GL(glEnableVertexAttribArray(mInstancedVertexColourLocation));
+
+  BindInstanceBuffer(mInstanceBuffer);
+
+  GL(glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, mIndexBuffer));
+  GL(glBufferData(GL_ELEMENT_ARRAY_BUFFER, sizeof(CUBE_INDICES), CUBE_INDICES, GL_STATIC_DRAW));
+
+  for(auto& slot : mFrameRing)
+  {
+    GL(glGenBuffers(1, &slot.buffer));
+  }
+
+  // unbind VAO first so it keeps the element buffer binding
+  GL(glBindVertexArray(0));
+  GL(glBindBuffer(GL_ARRAY_BUFFER, 0));
+  GL(glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0));
+}
+
+void NativeRenderer::BindInstanceBuffer(GLuint buffer)
+{
+  // mat4 attribute takes 4 consecutive locations, one per column, advancing once per instance
+  GL(glBindBuffer(GL_ARRAY_BUFFER, buffer));
+  for(GLint i = 0; i < 4; ++i)
+  {
+    const GLuint location = mInstancedModelViewLocation + i;
+    GL(glVertexAttribPointer(location, 4, GL_FLOAT, GL_FALSE, sizeof(Matrix4), reinterpret_cast<const void*>(sizeof(float) * 4 * i)));
+    GL(glEnableVertexAttribArray(location));
+    GL(glVertexAttribDivisor(location, 1));
+  }
 }
 
 GLuint NativeRenderer::CreateProgram(const char* vertexSource, const char* fragmentSource)
@@ -354,7 +326,7 @@ void NativeRenderer::RenderCube(const Dali::RenderCallbackInput& input)
   auto                  w = mCreateInfo.width;
   auto                  h = mCreateInfo.height;
 
-  matrixPerspective(mProjectionMatrix, 45, (float)w / (float)h, 0.1f, 100);
+  Matrix4Ops::Perspective(mProjectionMatrix, 45, (float)w / (float)h, 0.1f, 100);
 
   GL(glViewport(x, y, w, h));
   GL(glEnable(GL_DEPTH_TEST));
@@ -374,50 +346,375 @@ void NativeRenderer::RenderCube(const Dali::RenderCallbackInput& input)
   {
     GL(glClear(GL_DEPTH_BUFFER_BIT|GL_COLOR_BUFFER_BIT));
   }
+  const auto cubeCount  = mCubeCount.load();
+  const auto renderMode = mRenderMode.load();
+
+  if(renderMode == RenderMode::PRODUCER && mVertexArray)
+  {
+    // cube positions are generated by the worker thread
+    drawCount = RenderCubesProducer();
+  }
+  else
+  {
+    UpdateCubePositions(mPositions, mRandom, cubeCount);
+    if(renderMode == RenderMode::INSTANCED && mVertexArray)
+    {
+      drawCount = RenderCubesInstanced(cubeCount);
+    }
+    else
+    {
+      drawCount = RenderCubesPerObject(cubeCount);
+    }
+  }
+
+  angle += 1;
+  if(angle > 360)
+  {
+    angle -= 360;
+  }
+
+  mStatsDrawCalls += drawCount;
+}
+
+void NativeRenderer::UpdateCubePositions(std::vector<float>& positions, std::minstd_rand& random, uint32_t cubeCount)
+{
+  auto max = 7000;
+  while(positions.size() < cubeCount * 3u)
+  {
+    auto xPos = float(int(random() % max) - (max / 2)) / 1000.0f;
+    auto yPos = float(int(random() % max) - (max / 2)) / 1000.0f;
+    positions.emplace_back(xPos);
+    positions.emplace_back(yPos);
+    positions.emplace_back(-5.0f);
+  }
+}
+
+uint32_t NativeRenderer::RenderCubesPerObject(uint32_t cubeCount)
+{
+  uint32_t drawCount = 0;
+  float    angle     = mAngle;
+
   GL(glUseProgram(mProgramId));
   // unbind VAO
   GL(glBindVertexArray(0));
-  srand(10);
 
-  const auto maxCubes = int(MAX_CUBES);
   GL(glBindBuffer(GL_ARRAY_BUFFER, 0));
   GL(glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0));
   GL(glBindBuffer(GL_COPY_READ_BUFFER, 0));
   GL(glBindBuffer(GL_COPY_WRITE_BUFFER, 0));
 
-
-
   GL(glVertexAttribPointer(mVertexLocation, 3, GL_FLOAT, GL_FALSE, 0, CUBE_VERTICES));
   GL(glEnableVertexAttribArray(mVertexLocation));
   GL(glVertexAttribPointer(mVertexColourLocation, 3, GL_FLOAT, GL_FALSE, 0, CUBE_COLOURS));
   GL(glEnableVertexAttribArray(mVertexColourLocation));
-  for(int i = 0; i < int(maxCubes); ++i)
+  for(int i = 0; i < int(cubeCount); ++i)
   {
-    GL(matrixIdentityFunction(mModelViewMatrix));
-    matrixScale(mModelViewMatrix, 0.2f, 0.2f, 0.2f);
-    matrixRotateX(mModelViewMatrix, angle);
-    matrixRotateY(mModelViewMatrix, angle);
-    auto max = 7000;
-    if(mPosX.size() == uint32_t(i))
-    {
-      auto xPos = float((rand() % max) - (max / 2)) / 1000.0f;
-      auto yPos = float((rand() % max) - (max / 2)) / 1000.0f;
-      mPosX.emplace_back(xPos);
-      mPosY.emplace_back(yPos);
-    }
-    matrixTranslate(mModelViewMatrix, mPosX[i], mPosY[i], -5.0f);
-    GL(glUniformMatrix4fv(mProjectionLocation, 1, GL_FALSE, mProjectionMatrix));
-    GL(glUniformMatrix4fv(mModelViewLocation, 1, GL_FALSE, mModelViewMatrix));
+    const float* position = &mPositions[i * 3];
+    Matrix4Ops::Identity(mModelViewMatrix);
+    Matrix4Ops::Scale(mModelViewMatrix, 0.2f, 0.2f, 0.2f);
+    Matrix4Ops::RotateX(mModelViewMatrix, angle);
+    Matrix4Ops::RotateY(mModelViewMatrix, angle);
+    Matrix4Ops::Translate(mModelViewMatrix, position[0], position[1], position[2]);
+    GL(glUniformMatrix4fv(mProjectionLocation, 1, GL_FALSE, mProjectionMatrix.m));
+    GL(glUniformMatrix4fv(mModelViewLocation, 1, GL_FALSE, mModelViewMatrix.m));
     GL(glDrawElements(GL_TRIANGLES, 36, GL_UNSIGNED_SHORT, CUBE_INDICES));
     drawCount++;
   }
-  angle += 1;
-  if(angle > 360)
+  return drawCount;
+}
+
+uint32_t NativeRenderer::RenderCubesInstanced(uint32_t cubeCount)
+{
+  if(!cubeCount)
   {
-    angle -= 360;
+    return 0u;
+  }
+
+  // Scale and rotation are shared by all the cubes, only the translation differs
+  Matrix4Ops::Identity(mModelViewMatrix);
+  Matrix4Ops::Scale(mModelViewMatrix, 0.2f, 0.2f, 0.2f);
+  Matrix4Ops::RotateX(mModelViewMatrix, mAngle);
+  Matrix4Ops::RotateY(mModelViewMatrix, mAngle);
+
+  mInstanceData.resize(cubeCount);
+  Matrix4Ops::TranslateBatch(mInstanceData.data(), mModelViewMatrix, mPositions.data(), cubeCount);
+
+  GL(glUseProgram(mInstancedProgramId));
+  GL(glUniformMatrix4fv(mInstancedProjectionLocation, 1, GL_FALSE, mProjectionMatrix.m));
+
+  // Orphan the previous storage so the upload doesn't wait for the last frame to finish
+  const GLsizeiptr dataSize = GLsizeiptr(mInstanceData.size() * sizeof(Matrix4));
+  GL(glBindBuffer(GL_ARRAY_BUFFER, mInstanceBuffer));
+  if(cubeCount > mInstanceCapacity)
+  {
+    mInstanceCapacity = cubeCount;
+  }
+  GL(glBufferData(GL_ARRAY_BUFFER, GLsizeiptr(mInstanceCapacity * sizeof(Matrix4)), nullptr, GL_STREAM_DRAW));
+  GL(glBufferSubData(GL_ARRAY_BUFFER, 0, dataSize, mInstanceData.data()));
+
+  GL(glBindVertexArray(mVertexArray));
+  BindInstanceBuffer(mInstanceBuffer);
+  GL(glDrawElementsInstanced(GL_TRIANGLES, 36, GL_UNSIGNED_SHORT, nullptr, cubeCount));
+
+  // leave the buffer state clean for the rest of DALi rendering
+  GL(glBindVertexArray(0));
+  GL(glBindBuffer(GL_ARRAY_BUFFER, 0));
+  return 1u;
+}
+
+uint32_t NativeRenderer::RenderCubesProducer()
+{
+  StartProducer();
+
+  FrameSlot* slot = nullptr;
+  {
+    std::unique_lock<std::mutex> lock(mFrameRingMutex);
+
+    auto findOldestReady = [this]() {
+      FrameSlot* oldest = nullptr;
+      for(auto& candidate : mFrameRing)
+      {
+        if(candidate.state == FrameSlot::State::READY && (!oldest || candidate.sequence < oldest->sequence))
+        {
+          oldest = &candidate;
+        }
+      }
+      return oldest;
+    };
+
+    RetireFrames();
+    slot = findOldestReady();
+    if(!slot)
+    {
+      ++mStatsStalls;
+
+      // The worker can't run ahead while every slot is in flight, so wait for the GPU first
+      FrameSlot* oldestInFlight = nullptr;
+      for(auto& candidate : mFrameRing)
+      {
+        if(candidate.state != FrameSlot::State::IN_FLIGHT)
+        {
+          oldestInFlight = nullptr;
+          break;
+        }
+        if(!oldestInFlight || candidate.sequence < oldestInFlight->sequence)
+        {
+          oldestInFlight = &candidate;
+        }
+      }
+      if(oldestInFlight && oldestInFlight->fence)
+      {
+        glClientWaitSync(oldestInFlight->fence, GL_SYNC_FLUSH_COMMANDS_BIT, std::chrono::nanoseconds(PRODUCER_WAIT_TIMEOUT).count());
+        RetireFrames();
+      }
+
+      mFrameRingCondition.wait_for(lock, PRODUCER_WAIT_TIMEOUT, [&]() { return (slot = findOldestReady()) != nullptr; });
+    }
+
+    if(!slot)
+    {
+      return 0u;
+    }
+    slot->state = FrameSlot::State::IN_FLIGHT;
+  }
+
+  // The slot is owned by the render thread until its fence signals
+  const uint32_t   cubeCount = slot->instances.size();
+  const GLsizeiptr dataSize  = GLsizeiptr(cubeCount * sizeof(Matrix4));
+  if(cubeCount)
+  {
+    GL(glBindBuffer(GL_ARRAY_BUFFER, slot->buffer));
+    if(cubeCount > slot->bufferCapacity)
+    {
+      slot->bufferCapacity = cubeCount;
+      GL(glBufferData(GL_ARRAY_BUFFER, dataSize, slot->instances.data(), GL_STREAM_DRAW));
+    }
+    else
+    {
+      // The fence of the slot has signalled, so the GPU is done with the buffer and the
+      // driver doesn't have to synchronise
+      void* data = nullptr;
+      GL(data = glMapBufferRange(GL_ARRAY_BUFFER, 0, dataSize, GL_MAP_WRITE_BIT | GL_MAP_INVALIDATE_RANGE_BIT | GL_MAP_UNSYNCHRONIZED_BIT));
+      if(data)
+      {
+        memcpy(data, slot->instances.data(), dataSize);
+        GL(glUnmapBuffer(GL_ARRAY_BUFFER));
+      }
+    }
+
+    GL(glUseProgram(mInstancedProgramId));
+    GL(glUniformMatrix4fv(mInstancedProjectionLocation, 1, GL_FALSE, mProjectionMatrix.m));
+
+    GL(glBindVertexArray(mVertexArray));
+    BindInstanceBuffer(slot->buffer);
+    GL(glDrawElementsInstanced(GL_TRIANGLES, 36, GL_UNSIGNED_SHORT, nullptr, cubeCount));
+
+    // leave the buffer state clean for the rest of DALi rendering
+    GL(glBindVertexArray(0));
+    GL(glBindBuffer(GL_ARRAY_BUFFER, 0));
+  }
+
+  GLsync fence = nullptr;
+  GL(fence = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0));
+  {
+    std::lock_guard<std::mutex> lock(mFrameRingMutex);
+    slot->fence = fence;
+  }
+  return cubeCount ? 1u : 0u;
+}
+
+void NativeRenderer::RetireFrames()
+{
+  const uint64_t now     = GetTimeMicroseconds();
+  bool           retired = false;
+  for(auto& slot : mFrameRing)
+  {
+    if(slot.state == FrameSlot::State::IN_FLIGHT && slot.fence)
+    {
+      const GLenum result = glClientWaitSync(slot.fence, 0, 0);
+      if(result == GL_ALREADY_SIGNALED || result == GL_CONDITION_SATISFIED)
+      {
+        glDeleteSync(slot.fence);
+        slot.fence = nullptr;
+        slot.state = FrameSlot::State::FREE;
+        retired    = true;
+
+        mStatsLatencyUs += now - slot.produceStartUs;
+        ++mStatsRetiredFrames;
+      }
+    }
+  }
+
+  if(retired)
+  {
+    mFrameRingCondition.notify_all();
   }
 }
 
+void NativeRenderer::StartProducer()
+{
+  std::lock_guard<std::mutex> lock(mFrameRingMutex);
+  if(!mProducerRunning)
+  {
+    mProducerRunning = true;
+    mProducerThread  = std::thread(&NativeRenderer::ProducerMain, this);
+  }
+}
+
+void NativeRenderer::StopProducer()
+{
+  {
+    std::lock_guard<std::mutex> lock(mFrameRingMutex);
+    mProducerRunning = false;
+  }
+  mFrameRingCondition.notify_all();
+  if(mProducerThread.joinable())
+  {
+    mProducerThread.join();
+  }
+}
+
+void NativeRenderer::ProducerMain()
+{
+  auto isInFlight = [this]() {
+    return std::any_of(mFrameRing.begin(), mFrameRing.end(), [](const FrameSlot& candidate) { return candidate.state == FrameSlot::State::IN_FLIGHT; });
+  };
+
+  std::unique_lock<std::mutex> lock(mFrameRingMutex);
+  while(mProducerRunning)
+  {
+    auto slot = std::find_if(mFrameRing.begin(), mFrameRing.end(), [](const FrameSlot& candidate) { return candidate.state == FrameSlot::State::FREE; });
+    if(slot == mFrameRing.end())
+    {
+      mFrameRingCondition.wait(lock);
+      continue;
+    }
+    slot->state                = FrameSlot::State::WRITING;
+    const bool inFlightAtStart = isInFlight();
+    lock.unlock();
+
+    // Same animation as the other modes, the cubes rotate by a degree per frame
+    const uint64_t start     = GetTimeMicroseconds();
+    const uint32_t cubeCount = mCubeCount;
+    const float    angle     = float(mProducerSequence % 360);
+    UpdateCubePositions(mProducerPositions, mProducerRandom, cubeCount);
+
+    Matrix4 base;
+    Matrix4Ops::Identity(base);
+    Matrix4Ops::Scale(base, 0.2f, 0.2f, 0.2f);
+    Matrix4Ops::RotateX(base, angle);
+    Matrix4Ops::RotateY(base, angle);
+
+    slot->instances.resize(cubeCount);
+    Matrix4Ops::TranslateBatch(slot->instances.data(), base, mProducerPositions.data(), cubeCount);
+    const uint64_t end = GetTimeMicroseconds();
+
+    lock.lock();
+    slot->sequence       = mProducerSequence++;
+    slot->produceStartUs = start;
+    slot->state          = FrameSlot::State::READY;
+
+    // Work counts as overlapped if the GPU had a frame in flight at both of its ends
+    mStatsProduceTimeUs += end - start;
+    mStatsOverlapTimeUs += (inFlightAtStart && isInFlight()) ? end - start : 0u;
+    ++mStatsProducedFrames;
+    mFrameRingCondition.notify_all();
+  }
+}
+
+void NativeRenderer::SetRenderMode(RenderMode mode)
+{
+  mRenderMode = mode;
+}
+
+NativeRenderer::RenderMode NativeRenderer::GetRenderMode() const
+{
+  return mRenderMode;
+}
+
+void NativeRenderer::SetCubeCount(uint32_t count)
+{
+  mCubeCount = count;
+}
+
+uint32_t NativeRenderer::GetCubeCount() const
+{
+  return mCubeCount;
+}
+
+NativeRenderer::FrameStats NativeRenderer::ResetFrameStats()
+{
+  FrameStats stats;
+  stats.frames           = mStatsFrames.exchange(0u);
+  const auto drawCalls   = mStatsDrawCalls.exchange(0u);
+  const auto renderTime  = mStatsRenderTimeUs.exchange(0u);
+  if(stats.frames)
+  {
+    stats.drawCalls    = float(drawCalls) / stats.frames;
+    stats.renderTimeMs = float(renderTime) / stats.frames / 1000.0f;
+  }
+
+  const auto producedFrames = mStatsProducedFrames.exchange(0u);
+  const auto produceTime    = mStatsProduceTimeUs.exchange(0u);
+  const auto overlapTime    = mStatsOverlapTimeUs.exchange(0u);
+  const auto retiredFrames  = mStatsRetiredFrames.exchange(0u);
+  const auto latency        = mStatsLatencyUs.exchange(0u);
+  stats.stalls              = mStatsStalls.exchange(0u);
+  if(producedFrames)
+  {
+    stats.produceTimeMs = float(produceTime) / producedFrames / 1000.0f;
+  }
+  if(produceTime)
+  {
+    stats.overlapPercent = float(overlapTime) * 100.0f / produceTime;
+  }
+  if(retiredFrames)
+  {
+    stats.latencyMs = float(latency) / retiredFrames / 1000.0f;
+  }
+  return stats;
+}
+
 void NativeRenderer::GlViewInitCallback(const Dali::RenderCallbackInput& input)
 {
   Setup(mWidth, mHeight);
@@ -426,11 +723,34 @@ void NativeRenderer::GlViewInitCallback(const Dali::RenderCallbackInput& input)
 
 int NativeRenderer::GlViewRenderCallback(const Dali::RenderCallbackInput& input)
 {
+  const auto start = std::chrono::steady_clock::now();
   RenderCube(input);
+  const auto end = std::chrono::steady_clock::now();
+
+  mStatsRenderTimeUs += std::chrono::duration_cast<std::chrono::microseconds>(end - start).count();
+  ++mStatsFrames;
   return true;
 }
 
 void NativeRenderer::GlViewTerminateCallback(const Dali::RenderCallbackInput& input)
 {
-  // Nothing to do here
+  StopProducer();
+  for(auto& slot : mFrameRing)
+  {
+    if(slot.fence)
+    {
+      GL(glDeleteSync(slot.fence));
+    }
+    GL(glDeleteBuffers(1, &slot.buffer));
+    slot = FrameSlot();
+  }
+
+  GLuint buffers[] = {mVertexBuffer, mColourBuffer, mIndexBuffer, mInstanceBuffer};
+  GL(glDeleteBuffers(4, buffers));
+  GL(glDeleteVertexArrays(1, &mVertexArray));
+  GL(glDeleteProgram(mInstancedProgramId));
+  GL(glDeleteProgram(mProgramId));
+  mVertexArray = mVertexBuffer = mColourBuffer = mIndexBuffer = mInstanceBuffer = 0u;
+  mInstancedProgramId = mProgramId = 0u;
+  mInstanceCapacity = 0u;
 }
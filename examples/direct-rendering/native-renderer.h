@@ -20,6 +20,8 @@
 
 #include <dali/public-api/signals/render-callback.h>
 
+#include "shared/simd-matrix.h"
+
 #include <cmath>
 #include <GLES3/gl3.h>
 #include <EGL/egl.h>
@@ -27,6 +29,8 @@
 #include <thread>
 #include <atomic>
 #include <mutex>
+#include <condition_variable>
+#include <random>
 #include <deque>
 #include <map>
 #include <array>
@@ -54,6 +58,32 @@ public:
     bool threaded{false};
   };
 
+  /**
+   * Method of submitting cubes
+   */
+  enum class RenderMode
+  {
+    PER_OBJECT, ///< Client side vertex arrays, uniforms and a draw call per cube
+    INSTANCED,  ///< Geometry in buffers behind a VAO, single instanced draw call
+    PRODUCER    ///< As INSTANCED, instance data of the next frame is prepared by a worker thread
+  };
+
+  /**
+   * Rendering statistics averaged since the last call to ResetFrameStats()
+   */
+  struct FrameStats
+  {
+    uint32_t frames{0u};
+    float drawCalls{0.f};    ///< Draw calls per frame
+    float renderTimeMs{0.f}; ///< CPU time spent in the render callback per frame
+
+    // PRODUCER mode only
+    float produceTimeMs{0.f};  ///< Time spent by the worker thread preparing a frame
+    float latencyMs{0.f};      ///< Time from starting to prepare a frame until its fence was seen signalled
+    float overlapPercent{0.f}; ///< Share of the worker time spent while the GPU had frames in flight
+    uint32_t stalls{0u};       ///< Render callbacks which had to wait for the worker thread
+  };
+
   /**
    * Constructor
    */
@@ -79,6 +109,31 @@ public:
    */
   void RenderCube( const Dali::RenderCallbackInput& input );
 
+  /**
+   * Sets method of submitting cubes, may be called from any thread
+   */
+  void SetRenderMode(RenderMode mode);
+
+  /**
+   * Returns method of submitting cubes
+   */
+  RenderMode GetRenderMode() const;
+
+  /**
+   * Sets number of rendered cubes, may be called from any thread
+   */
+  void SetCubeCount(uint32_t count);
+
+  /**
+   * Returns number of rendered cubes
+   */
+  uint32_t GetCubeCount() const;
+
+  /**
+   * Returns statistics collected since the previous call and resets them
+   */
+  FrameStats ResetFrameStats();
+
   /**
    * Creates GL program from shader sources
    */
@@ -102,6 +157,56 @@ public:
 
 private:
 
+  /**
+   * Draws cubes one by one using client side vertex arrays
+   */
+  uint32_t RenderCubesPerObject(uint32_t cubeCount);
+
+  /**
+   * Draws all cubes with a single instanced draw call
+   */
+  uint32_t RenderCubesInstanced(uint32_t cubeCount);
+
+  /**
+   * Creates program, buffers and VAO of the instanced mode
+   */
+  void SetupInstancing();
+
+  /**
+   * Draws the oldest frame prepared by the worker thread with a single instanced draw call
+   */
+  uint32_t RenderCubesProducer();
+
+  /**
+   * Points the instance attributes of the VAO at the buffer, the VAO must be bound
+   */
+  void BindInstanceBuffer(GLuint buffer);
+
+  /**
+   * Generates positions of the cubes which have not been rendered yet
+   */
+  void UpdateCubePositions(std::vector<float>& positions, std::minstd_rand& random, uint32_t cubeCount);
+
+  /**
+   * Starts the worker thread of the PRODUCER mode if it is not running yet
+   */
+  void StartProducer();
+
+  /**
+   * Stops the worker thread and waits for it to finish
+   */
+  void StopProducer();
+
+  /**
+   * Main loop of the worker thread filling free slots of the frame ring
+   */
+  void ProducerMain();
+
+  /**
+   * Frees the in-flight slots whose fences are signalled, must be called with mFrameRingMutex locked
+   */
+  void RetireFrames();
+
   State mState {State::INIT};
 
   GLuint mProgramId{0u};
@@ -111,8 +216,24 @@ private:
   GLint mProjectionLocation{};
   GLint mModelViewLocation{};
 
-  float mModelViewMatrix[16];
-  float mProjectionMatrix[16];
+  DemoHelper::Matrix4 mModelViewMatrix;
+  DemoHelper::Matrix4 mProjectionMatrix;
+
+  GLuint mInstancedProgramId{0u};
+
+  GLint mInstancedVertexLocation{};
+  GLint mInstancedVertexColourLocation{};
+  GLint mInstancedModelViewLocation{};
+  GLint mInstancedProjectionLocation{};
+
+  GLuint mVertexArray{0u};
+  GLuint mVertexBuffer{0u};
+  GLuint mColourBuffer{0u};
+  GLuint mIndexBuffer{0u};
+  GLuint mInstanceBuffer{0u};
+  uint32_t mInstanceCapacity{0u};
+
+  std::vector<DemoHelper::Matrix4> mInstanceData;
 
   uint32_t mWidth;
   uint32_t mHeight;
@@ -121,8 +242,57 @@ private:
 
   float mAngle{0.f};
 
-  std::vector<float> mPosX;
-  std::vector<float> mPosY;
+  std::vector<float> mPositions; ///< x, y, z of each cube
+  std::minstd_rand mRandom{10u};
+
+  /**
+   * Slot of the frame ring shared by the worker thread and the render callback
+   */
+  struct FrameSlot
+  {
+    enum class State
+    {
+      FREE,      ///< Available to the worker thread
+      WRITING,   ///< Being prepared by the worker thread
+      READY,     ///< Waiting for the render callback
+      IN_FLIGHT  ///< Uploaded and drawn, GPU may still read the buffer until the fence signals
+    };
+
+    State state{State::FREE};
+    std::vector<DemoHelper::Matrix4> instances;
+    uint64_t sequence{0u};
+    uint64_t produceStartUs{0u};
+    GLuint buffer{0u};
+    uint32_t bufferCapacity{0u};
+    GLsync fence{nullptr};
+  };
+
+  static constexpr uint32_t FRAME_RING_SIZE{3u};
+
+  std::array<FrameSlot, FRAME_RING_SIZE> mFrameRing;
+  std::mutex mFrameRingMutex;
+  std::condition_variable mFrameRingCondition;
+  std::thread mProducerThread;
+  bool mProducerRunning{false}; ///< Guarded by mFrameRingMutex
+
+  // Owned by the worker thread
+  std::vector<float> mProducerPositions;
+  std::minstd_rand mProducerRandom{10u}; ///< Same seed as mRandom so both modes show the same cubes
+  uint64_t mProducerSequence{0u};
+
+  std::atomic<RenderMode> mRenderMode{RenderMode::PER_OBJECT};
+  std::atomic<uint32_t> mCubeCount{0u};
+
+  std::atomic<uint32_t> mStatsFrames{0u};
+  std::atomic<uint64_t> mStatsDrawCalls{0u};
+  std::atomic<uint64_t> mStatsRenderTimeUs{0u};
+
+  std::atomic<uint32_t> mStatsProducedFrames{0u};
+  std::atomic<uint64_t> mStatsProduceTimeUs{0u};
+  std::atomic<uint64_t> mStatsOverlapTimeUs{0u};
+  std::atomic<uint32_t> mStatsRetiredFrames{0u};
+  std::atomic<uint64_t> mStatsLatencyUs{0u};
+  std::atomic<uint32_t> mStatsStalls{0u};
 };
 
 #endif // DALI_DIRECT_RENDERING_NATIVE_RENDERER_H
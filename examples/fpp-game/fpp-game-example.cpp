@@ -19,10 +19,18 @@
 #include "game-renderer.h"
 #include "game-scene.h"
 #include "game-texture.h"
+#include "json-benchmark.h"
 
 #include "fpp-game-tutorial-controller.h"
 
 #include <dali-toolkit/dali-toolkit.h>
+#include <dali/devel-api/common/stage-devel.h>
+
+#include <algorithm>
+#include <cstdlib>
+#include <sstream>
+
+#include "shared/frame-stats.h"
 
 using namespace Dali;
 
@@ -32,7 +40,13 @@ const char* SCENE_URL =
   {
     DEMO_GAME_DIR "/scene.json"};
 
-}
+// When set to a number of iterations, runs the JSON parsing benchmark and quits
+const char* JSON_BENCHMARK_ENV("JSON_BENCHMARK");
+
+// Interval of the visible entities counter update in milliseconds
+const unsigned int STATS_UPDATE_INTERVAL(250u);
+
+} // namespace
 /* This example creates 3D environment with first person camera control
    It contains following modules:
 
@@ -53,6 +67,14 @@ const char* SCENE_URL =
                 implements first-person-perspective camera behavior.
                 GameCamera uses Dali::Timer to provide per-frame ( or rather every 16ms ) update tick.
 
+   GameSpatialIndex - uniform grid of entity bounds. Queried by the GameCamera on every tick to
+                      hide entities outside the view frustum or beyond the draw distance.
+                      Press 'c' to toggle culling.
+
+   GameBatch - merges static entities sharing the same vertex layout into a single renderer when
+               the scene is loaded, packing their lightmaps into an atlas. Press 'b' to toggle
+               batching and compare frame times.
+
 
                                .-----------.
                .---------------| GameScene |---------------.
@@ -104,6 +126,9 @@ public:
     // Display tutorial
     mTutorialController.DisplayTutorial(mWindow);
 
+    // Display scene statistics
+    CreateStatsLabel();
+
     // Connect OnKeyEvent signal
     mWindow.KeyEventSignal().Connect(this, &GameController::OnKeyEvent);
   }
@@ -117,18 +142,80 @@ public:
       {
         mApplication.Quit();
       }
+      else if(event.GetKeyName() == "c")
+      {
+        GameSpatialIndex& spatialIndex(mScene.GetSpatialIndex());
+        spatialIndex.SetEnabled(!spatialIndex.IsEnabled());
+        OnStatsTick();
+      }
+      else if(event.GetKeyName() == "b")
+      {
+        mScene.SetStaticBatchingEnabled(!mScene.IsStaticBatchingEnabled());
+        OnStatsTick();
+      }
     }
   }
 
+  // Creates label displaying scene statistics, rendered with its own camera
+  // so it's not affected by the game camera orientation
+  void CreateStatsLabel()
+  {
+    mStatsLabel = Toolkit::TextLabel::New();
+    mStatsLabel.SetProperty(Actor::Property::PARENT_ORIGIN, ParentOrigin::TOP_LEFT);
+    mStatsLabel.SetProperty(Actor::Property::ANCHOR_POINT, AnchorPoint::TOP_LEFT);
+    mStatsLabel.SetProperty(Toolkit::TextLabel::Property::TEXT_COLOR, Color::WHITE);
+    mStatsLabel.SetProperty(Toolkit::TextLabel::Property::MULTI_LINE, true);
+    mWindow.Add(mStatsLabel);
+
+    CameraActor statsCamera = CameraActor::New();
+    mWindow.Add(statsCamera);
+
+    RenderTask statsTask = mWindow.GetRenderTaskList().CreateTask();
+    statsTask.SetCameraActor(statsCamera);
+    statsTask.SetClearEnabled(false);
+    statsTask.SetSourceActor(mStatsLabel);
+    statsTask.SetExclusive(true);
+
+    DevelStage::AddFrameCallback(Stage::GetCurrent(), mFrameStats, mWindow.GetRootLayer());
+
+    mStatsTimer = Timer::New(STATS_UPDATE_INTERVAL);
+    mStatsTimer.TickSignal().Connect(this, &GameController::OnStatsTick);
+    mStatsTimer.Start();
+    OnStatsTick();
+  }
+
+  bool OnStatsTick()
+  {
+    const GameSpatialIndex& spatialIndex(mScene.GetSpatialIndex());
+
+    std::ostringstream stream;
+    stream << "Visible: " << spatialIndex.GetVisibleCount() << " / " << spatialIndex.GetTotalCount()
+           << (spatialIndex.IsEnabled() ? "" : " (culling off)") << "\n"
+           << "Draws: " << mScene.GetDrawCallCount()
+           << (mScene.IsStaticBatchingEnabled() ? " (batching on)" : " (batching off)") << "\n"
+           << "Frame: " << mFrameStats.Reset().GetAverageFrameMs() << " ms";
+    mStatsLabel.SetProperty(Toolkit::TextLabel::Property::TEXT, stream.str());
+    return true;
+  }
+
 private:
   Application&              mApplication;
   GameScene                 mScene;
   Window                    mWindow;
   FppGameTutorialController mTutorialController;
+  Toolkit::TextLabel        mStatsLabel;
+  Timer                     mStatsTimer;
+  DemoHelper::FrameStats    mFrameStats{false};
 };
 
 int DALI_EXPORT_API main(int argc, char** argv)
 {
+  if(const char* iterations = std::getenv(JSON_BENCHMARK_ENV))
+  {
+    RunJsonBenchmark(uint32_t(std::max(1, atoi(iterations))));
+    return 0;
+  }
+
   Application    application = Application::New(&argc, &argv);
   GameController test(application);
   application.MainLoop();
@@ -0,0 +1,299 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include "game-batch.h"
+#include "game-entity.h"
+#include "game-texture.h"
+
+#include "generated/game-renderer-frag.h"
+#include "generated/game-renderer-vert.h"
+
+#include <dali/dali.h>
+#include <dali/devel-api/adaptor-framework/image-loading.h>
+
+#include <algorithm>
+#include <cmath>
+#include <string.h>
+
+namespace
+{
+// Number of components of position and normal attributes
+const uint32_t VECTOR3_COMPONENTS(3u);
+
+// Number of components of the texture coordinate attribute
+const uint32_t VECTOR2_COMPONENTS(2u);
+
+// Index of the texture coordinates, attributes are stored in the order of GameModel ATTRIBUTE_NAMES
+const uint32_t TEXCOORD_ATTRIBUTE(2u);
+
+// Largest side of the atlas, if the GPU supports it
+const uint32_t MAX_ATLAS_SIZE(4096u);
+
+// Lightmaps are scaled down to tiles of at most this size in the atlas
+const uint32_t MAX_TILE_SIZE(512u);
+
+/**
+ * Checks whether attribute is a vector of given number of components
+ */
+bool IsVectorAttribute(const ModelHeader& header, uint32_t index, uint32_t components)
+{
+  return header.attributeCount > index && (header.attributeFormat[index] & 0xffff) == components;
+}
+
+/**
+ * Returns the side of the largest atlas
+ */
+uint32_t GetAtlasSize()
+{
+  return std::min(MAX_ATLAS_SIZE, Dali::GetMaxTextureSize());
+}
+} // namespace
+
+GameBatch::GameBatch()
+: mEntityCount(0u),
+  mPixelFormat(Dali::Pixel::INVALID),
+  mTileWidth(0u),
+  mTileHeight(0u),
+  mColumns(0u),
+  mMaxTiles(0u)
+{
+  memset(&mHeader, 0, sizeof(mHeader));
+}
+
+GameBatch::~GameBatch()
+{
+}
+
+bool GameBatch::IsCompatible(GameModel* model, GameTexture* texture) const
+{
+  const ModelHeader& header(model->GetHeader());
+
+  // position is always the first attribute, texture coordinates are needed to address the atlas
+  if(!texture || !IsVectorAttribute(header, 0u, VECTOR3_COMPONENTS) || !IsVectorAttribute(header, TEXCOORD_ATTRIBUTE, VECTOR2_COMPONENTS))
+  {
+    return false;
+  }
+
+  uint32_t width, height;
+  texture->GetSize(width, height);
+  if(!mEntityCount)
+  {
+    return width && height;
+  }
+
+  const bool hasTile(std::find(mTextures.begin(), mTextures.end(), texture) != mTextures.end());
+
+  return header.vertexStride == mHeader.vertexStride &&
+         header.attributeCount == mHeader.attributeCount &&
+         !memcmp(header.attributeFormat, mHeader.attributeFormat, sizeof(header.attributeFormat)) &&
+         !memcmp(header.attributeOffset, mHeader.attributeOffset, sizeof(header.attributeOffset)) &&
+         texture->GetPixelFormat() == mPixelFormat &&
+         std::min(width, MAX_TILE_SIZE) == mTileWidth && std::min(height, MAX_TILE_SIZE) == mTileHeight &&
+         (hasTile || mTextures.size() < mMaxTiles);
+}
+
+bool GameBatch::Add(GameEntity* entity, const GameUtils::ByteArray& modelVertices)
+{
+  GameModel*   model(entity->GetGameRenderer().GetModel());
+  GameTexture* texture(entity->GetGameRenderer().GetMainTexture());
+  if(mRenderer || !model || !IsCompatible(model, texture) || modelVertices.empty())
+  {
+    return false;
+  }
+
+  GameUtils::ByteArray vertices(modelVertices);
+
+  if(!mEntityCount)
+  {
+    mHeader = model->GetHeader();
+    mFormat = model->GetVertexFormat();
+
+    uint32_t width, height;
+    texture->GetSize(width, height);
+    mPixelFormat = texture->GetPixelFormat();
+    mTileWidth   = std::min(width, MAX_TILE_SIZE);
+    mTileHeight  = std::min(height, MAX_TILE_SIZE);
+    mColumns     = std::max(GetAtlasSize() / mTileWidth, 1u);
+    mMaxTiles    = mColumns * std::max(GetAtlasSize() / mTileHeight, 1u);
+  }
+
+  Range range;
+  range.tile = std::find(mTextures.begin(), mTextures.end(), texture) - mTextures.begin();
+  if(range.tile == mTextures.size())
+  {
+    mTextures.push_back(texture);
+  }
+
+  const Dali::Matrix localMatrix(entity->GetLocalMatrix());
+
+  // normals are transformed by the inverse-transpose to support non-uniform scale
+  Dali::Matrix3 normalMatrix(localMatrix);
+  normalMatrix.Invert();
+  normalMatrix.Transpose();
+  const float* n(normalMatrix.AsFloat());
+
+  const bool     hasNormal(IsVectorAttribute(mHeader, 1u, VECTOR3_COMPONENTS));
+  const uint32_t stride(mHeader.vertexStride);
+  const uint32_t vertexCount(vertices.size() / stride);
+  for(uint32_t i = 0u; i < vertexCount; ++i)
+  {
+    char* vertex(vertices.data() + size_t(i) * stride);
+
+    float position[3];
+    memcpy(position, vertex + mHeader.attributeOffset[0], sizeof(position));
+    Dali::Vector4 transformed(localMatrix * Dali::Vector4(position[0], position[1], position[2], 1.0f));
+    position[0] = transformed.x;
+    position[1] = transformed.y;
+    position[2] = transformed.z;
+    memcpy(vertex + mHeader.attributeOffset[0], position, sizeof(position));
+
+    if(hasNormal)
+    {
+      float normal[3];
+      memcpy(normal, vertex + mHeader.attributeOffset[1], sizeof(normal));
+      Dali::Vector3 result(n[0] * normal[0] + n[3] * normal[1] + n[6] * normal[2],
+                           n[1] * normal[0] + n[4] * normal[1] + n[7] * normal[2],
+                           n[2] * normal[0] + n[5] * normal[1] + n[8] * normal[2]);
+      result.Normalize();
+      normal[0] = result.x;
+      normal[1] = result.y;
+      normal[2] = result.z;
+      memcpy(vertex + mHeader.attributeOffset[1], normal, sizeof(normal));
+    }
+  }
+
+  mVertices.insert(mVertices.end(), vertices.begin(), vertices.end());
+  range.vertexEnd = mVertices.size() / stride;
+  mRanges.push_back(range);
+  mEntities.push_back(entity);
+  ++mEntityCount;
+  return true;
+}
+
+bool GameBatch::Finalise()
+{
+  if(mRenderer || !mEntityCount)
+  {
+    return false;
+  }
+
+  // the atlas is only as large as the tiles it holds
+  const uint32_t tileCount(mTextures.size());
+  const uint32_t columns(std::min(mColumns, tileCount));
+  const uint32_t rows((tileCount + mColumns - 1u) / mColumns);
+  const uint32_t atlasWidth(columns * mTileWidth);
+  const uint32_t atlasHeight(rows * mTileHeight);
+
+  Dali::Texture atlas = Dali::Texture::New(Dali::TextureType::TEXTURE_2D, mPixelFormat, atlasWidth, atlasHeight);
+  for(uint32_t i = 0u; i < tileCount; ++i)
+  {
+    if(!mTextures[i]->UploadTo(atlas, (i % mColumns) * mTileWidth, (i / mColumns) * mTileHeight, mTileWidth, mTileHeight))
+    {
+      return false;
+    }
+  }
+  atlas.GenerateMipmaps();
+
+  Dali::Sampler sampler = Dali::Sampler::New();
+  sampler.SetWrapMode(Dali::WrapMode::CLAMP_TO_EDGE, Dali::WrapMode::CLAMP_TO_EDGE, Dali::WrapMode::CLAMP_TO_EDGE);
+  sampler.SetFilterMode(Dali::FilterMode::LINEAR_MIPMAP_LINEAR, Dali::FilterMode::LINEAR);
+  Dali::TextureSet textureSet = Dali::TextureSet::New();
+  textureSet.SetTexture(0, atlas);
+  textureSet.SetSampler(0, sampler);
+
+  const uint32_t stride(mHeader.vertexStride);
+  const uint32_t vertexCount(mVertices.size() / stride);
+
+  // remaps texture coordinates into the tiles, half a texel in from the edges so that the
+  // neighbouring tiles aren't filtered in; the shader flips v, which is undone around the remap
+  uint32_t vertexBegin(0u);
+  for(size_t r = 0; r < mRanges.size(); ++r)
+  {
+    const float left((mRanges[r].tile % mColumns) * mTileWidth + 0.5f);
+    const float top((mRanges[r].tile / mColumns) * mTileHeight + 0.5f);
+    for(uint32_t i = vertexBegin; i < mRanges[r].vertexEnd; ++i)
+    {
+      float texCoord[2];
+      char* attribute(mVertices.data() + size_t(i) * stride + mHeader.attributeOffset[TEXCOORD_ATTRIBUTE]);
+      memcpy(texCoord, attribute, sizeof(texCoord));
+      const float u(Dali::Clamp(texCoord[0], 0.0f, 1.0f));
+      const float v(1.0f - Dali::Clamp(texCoord[1], 0.0f, 1.0f));
+      texCoord[0] = (left + u * (mTileWidth - 1u)) / atlasWidth;
+      texCoord[1] = 1.0f - (top + v * (mTileHeight - 1u)) / atlasHeight;
+      memcpy(attribute, texCoord, sizeof(texCoord));
+    }
+    vertexBegin = mRanges[r].vertexEnd;
+  }
+
+  // radius of the bounding sphere around the actor origin, used by the DALi culling
+  float radius(0.0f);
+  for(uint32_t i = 0u; i < vertexCount; ++i)
+  {
+    float position[3];
+    memcpy(position, mVertices.data() + size_t(i) * stride + mHeader.attributeOffset[0], sizeof(position));
+    radius = std::max(radius, Dali::Vector3(position[0], position[1], position[2]).Length());
+  }
+
+  Dali::VertexBuffer vertexBuffer = Dali::VertexBuffer::New(mFormat);
+  vertexBuffer.SetData(mVertices.data(), vertexCount);
+
+  Dali::Geometry geometry = Dali::Geometry::New();
+  geometry.AddVertexBuffer(vertexBuffer);
+  geometry.SetType(Dali::Geometry::TRIANGLES);
+
+  Dali::Shader shader = Dali::Shader::New(SHADER_GAME_RENDERER_VERT, SHADER_GAME_RENDERER_FRAG);
+  mRenderer           = Dali::Renderer::New(geometry, shader);
+  mRenderer.SetTextures(textureSet);
+  mRenderer.SetProperty(Dali::Renderer::Property::DEPTH_WRITE_MODE, Dali::DepthWriteMode::ON);
+  mRenderer.SetProperty(Dali::Renderer::Property::DEPTH_FUNCTION, Dali::DepthFunction::LESS_EQUAL);
+  mRenderer.SetProperty(Dali::Renderer::Property::DEPTH_TEST_MODE, Dali::DepthTestMode::ON);
+
+  // size doesn't affect the game shader but makes the culling sphere cover all vertices
+  mActor = Dali::Actor::New();
+  mActor.SetProperty(Dali::Actor::Property::NAME, "GameBatch");
+  mActor.SetProperty(Dali::Actor::Property::ANCHOR_POINT, Dali::AnchorPoint::CENTER);
+  mActor.SetProperty(Dali::Actor::Property::PARENT_ORIGIN, Dali::ParentOrigin::CENTER);
+  mActor.SetProperty(Dali::Actor::Property::SIZE, Dali::Vector3::ONE * (2.0f * radius / std::sqrt(3.0f)));
+  mActor.AddRenderer(mRenderer);
+
+  // vertex buffer keeps its own copy
+  GameUtils::ByteArray().swap(mVertices);
+
+  return true;
+}
+
+void GameBatch::SetEnabled(bool enabled)
+{
+  if(mActor)
+  {
+    mActor.SetProperty(Dali::Actor::Property::VISIBLE, enabled);
+  }
+  for(size_t i = 0; i < mEntities.size(); ++i)
+  {
+    mEntities[i]->SetBatched(enabled);
+  }
+}
+
+uint32_t GameBatch::GetEntityCount() const
+{
+  return mEntityCount;
+}
+
+Dali::Actor& GameBatch::GetActor()
+{
+  return mActor;
+}
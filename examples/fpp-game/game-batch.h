@@ -0,0 +1,128 @@
+#ifndef GAME_BATCH_H
+#define GAME_BATCH_H
+
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <dali/public-api/actors/actor.h>
+#include <dali/public-api/rendering/geometry.h>
+#include <dali/public-api/rendering/renderer.h>
+
+#include <vector>
+
+#include "game-model.h"
+#include "game-utils.h"
+
+class GameEntity;
+class GameTexture;
+
+/**
+ * @brief The GameBatch class
+ * GameBatch merges geometry of static entities sharing the same vertex layout into a single
+ * vertex buffer. Vertices are pre-transformed into the space of the parent actor of the
+ * entities so the whole batch is drawn with one Renderer attached to a single Actor.
+ *
+ * Every entity of the game has its own lightmap, so the textures of the merged entities are
+ * packed into an atlas, scaled down to tiles of at most MAX_TILE_SIZE, and the texture
+ * coordinates of each entity are remapped into the tile of its texture.
+ */
+class GameBatch
+{
+public:
+  /**
+   * Creates an instance of GameBatch
+   */
+  GameBatch();
+
+  /**
+   * Destroys an instance of GameBatch
+   */
+  ~GameBatch();
+
+  /**
+   * Checks whether model and texture can be merged with the ones already stored in the batch
+   * @param[in] model Model to check
+   * @param[in] texture Texture of the entity using the model
+   * @return true if vertex layout is compatible and the texture fits in the atlas
+   */
+  bool IsCompatible(GameModel* model, GameTexture* texture) const;
+
+  /**
+   * Appends transformed model vertices of the entity to the batch. The batch actor is
+   * expected to share the parent with the entity actor
+   * @param[in] entity Entity to add
+   * @param[in] modelVertices Untransformed vertices of the entity model, as returned by
+   *                          GameModel::LoadVertexData(), shared by entities using the same model
+   * @return true if success
+   */
+  bool Add(GameEntity* entity, const GameUtils::ByteArray& modelVertices);
+
+  /**
+   * Builds the texture atlas and creates vertex buffer, geometry, renderer and actor from
+   * merged vertices
+   * @return true if success
+   */
+  bool Finalise();
+
+  /**
+   * Returns number of entities merged into the batch
+   * @return Number of entities
+   */
+  uint32_t GetEntityCount() const;
+
+  /**
+   * Shows the batch and hides merged entities or the other way round
+   * @param[in] enabled true to draw entities with the batch
+   */
+  void SetEnabled(bool enabled);
+
+  /**
+   * Returns the actor drawing the batch
+   * @return Actor with the batch renderer
+   */
+  Dali::Actor& GetActor();
+
+private:
+  /**
+   * Vertices of a merged entity and the atlas tile of its texture
+   */
+  struct Range
+  {
+    uint32_t vertexEnd; /// One past the last vertex of the entity
+    uint32_t tile;      /// Index of the texture in mTextures
+  };
+
+  ModelHeader          mHeader;      /// Header of the first model defining vertex layout
+  Dali::Property::Map  mFormat;      /// Vertex format
+  GameUtils::ByteArray mVertices;    /// Merged vertex data, released after Finalise()
+  uint32_t             mEntityCount; /// Number of merged entities
+
+  std::vector<GameEntity*>  mEntities; /// Merged entities, not owned
+  std::vector<Range>        mRanges;   /// Vertex range of each merged entity
+  std::vector<GameTexture*> mTextures; /// Textures packed into the atlas, one tile each, not owned
+
+  Dali::Pixel::Format mPixelFormat; /// Pixel format of the textures and the atlas
+  uint32_t            mTileWidth;
+  uint32_t            mTileHeight;
+  uint32_t            mColumns;  /// Tiles in a row of the atlas
+  uint32_t            mMaxTiles; /// Tiles fitting in the largest atlas
+
+  Dali::Actor    mActor;
+  Dali::Renderer mRenderer;
+};
+
+#endif
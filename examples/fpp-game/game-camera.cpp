@@ -16,6 +16,7 @@
  */
 
 #include "game-camera.h"
+#include "game-spatial-index.h"
 
 #include <dali/public-api/events/touch-event.h>
 #include <dali/public-api/render-tasks/render-task-list.h>
@@ -52,7 +53,8 @@ const Vector3 CAMERA_UP(Vector3::YAXIS);
 } // namespace
 
 GameCamera::GameCamera()
-: mFovY(CAMERA_DEFAULT_FOV),
+: mSpatialIndex(NULL),
+  mFovY(CAMERA_DEFAULT_FOV),
   mNear(CAMERA_DEFAULT_NEAR),
   mFar(CAMERA_DEFAULT_FAR),
   mWalkingTouchId(-1),
@@ -171,9 +173,21 @@ bool GameCamera::OnTick()
 
   mCameraPosition = position;
 
+  // ---------------------------------------------------------------------
+  // update visibility of entities
+  if(mSpatialIndex)
+  {
+    mSpatialIndex->Cull(position, rotation, mFovY, mSceneSize.x / mSceneSize.y, mNear, mFar);
+  }
+
   return true;
 }
 
+void GameCamera::SetSpatialIndex(GameSpatialIndex* spatialIndex)
+{
+  mSpatialIndex = spatialIndex;
+}
+
 void GameCamera::InitialiseDefaultCamera()
 {
   mCameraActor.SetProperty(Dali::Actor::Property::NAME, "GameCamera");
@@ -22,6 +22,8 @@
 #include <dali/public-api/adaptor-framework/timer.h>
 #include <dali/public-api/math/vector2.h>
 
+class GameSpatialIndex;
+
 /**
  * @brief The GameCamera class
  * First-person camera implementation with handling user input
@@ -61,6 +63,12 @@ public:
    */
   void Initialise(Dali::CameraActor defaultCamera, float fov, float near, float far, const Dali::Vector2& sceneSize);
 
+  /**
+   * Sets spatial index queried on every camera tick to cull entities outside the view
+   * @param[in] spatialIndex Pointer to the spatial index or NULL to disable culling
+   */
+  void SetSpatialIndex(GameSpatialIndex* spatialIndex);
+
 private:
   /**
    * Sets up a perspective camera using Dali default camera
@@ -93,6 +101,8 @@ private:
 
   Dali::Timer mTimer; /// Per-frame timer
 
+  GameSpatialIndex* mSpatialIndex; /// Spatial index used for culling, not owned
+
   Dali::Vector2 mScreenLookDelta;      /// Look delta vector in screen space
   Dali::Vector2 mScreenWalkDelta;      /// Walk delta vector in screen space
   Dali::Vector2 mOldTouchLookPosition; /// Previous look vector in screen space
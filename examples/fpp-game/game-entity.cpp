@@ -16,9 +16,15 @@
  */
 
 #include "game-entity.h"
+#include "game-model.h"
 #include "game-renderer.h"
 
+#include <dali/public-api/math/vector4.h>
+
 GameEntity::GameEntity(const char* name)
+: mIsStatic(true),
+  mIsVisible(true),
+  mIsBatched(false)
 {
   mActor = Dali::Actor::New();
   mActor.SetProperty(Dali::Actor::Property::NAME, name);
@@ -74,3 +80,75 @@ void GameEntity::SetSize(const Dali::Vector3& size)
 {
   mActor.SetProperty(Dali::Actor::Property::SIZE, size);
 }
+
+void GameEntity::SetVisible(bool visible)
+{
+  mIsVisible = visible;
+  mActor.SetProperty(Dali::Actor::Property::VISIBLE, mIsVisible && !mIsBatched);
+}
+
+void GameEntity::SetBatched(bool batched)
+{
+  mIsBatched = batched;
+  mActor.SetProperty(Dali::Actor::Property::VISIBLE, mIsVisible && !mIsBatched);
+}
+
+bool GameEntity::IsBatched() const
+{
+  return mIsBatched;
+}
+
+void GameEntity::SetStatic(bool isStatic)
+{
+  mIsStatic = isStatic;
+}
+
+bool GameEntity::IsStatic() const
+{
+  return mIsStatic;
+}
+
+Dali::Matrix GameEntity::GetLocalMatrix() const
+{
+  // size is not a part of the model matrix so only scale, rotation and position apply
+  Dali::Matrix localMatrix;
+  localMatrix.SetTransformComponents(mActor.GetProperty<Dali::Vector3>(Dali::Actor::Property::SCALE),
+                                     mActor.GetProperty<Dali::Quaternion>(Dali::Actor::Property::ORIENTATION),
+                                     mActor.GetProperty<Dali::Vector3>(Dali::Actor::Property::POSITION));
+  return localMatrix;
+}
+
+bool GameEntity::GetWorldBoundingBox(const Dali::Matrix& parentMatrix, Dali::Vector3& boundsMin, Dali::Vector3& boundsMax)
+{
+  GameModel* model(mGameRenderer.GetModel());
+  if(!model)
+  {
+    return false;
+  }
+
+  Dali::Vector3 localMin, localMax;
+  model->GetBoundingBox(localMin, localMax);
+
+  Dali::Matrix worldMatrix;
+  Dali::Matrix::Multiply(worldMatrix, GetLocalMatrix(), parentMatrix);
+
+  for(int i = 0; i < 8; ++i)
+  {
+    Dali::Vector4 corner(i & 1 ? localMax.x : localMin.x,
+                         i & 2 ? localMax.y : localMin.y,
+                         i & 4 ? localMax.z : localMin.z,
+                         1.0f);
+    Dali::Vector4 transformed(worldMatrix * corner);
+    Dali::Vector3 point(transformed.x, transformed.y, transformed.z);
+    if(i == 0)
+    {
+      boundsMin = boundsMax = point;
+    }
+    else
+    {
+      boundsMin = Dali::Min(boundsMin, point);
+      boundsMax = Dali::Max(boundsMax, point);
+    }
+  }
+  return true;
+}
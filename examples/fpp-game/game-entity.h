@@ -21,6 +21,7 @@
 #include "game-renderer.h"
 
 #include <dali/public-api/actors/actor.h>
+#include <dali/public-api/math/matrix.h>
 
 /**
  * @brief The GameEntity class
@@ -77,6 +78,52 @@ public:
    */
   void SetSize(const Dali::Vector3& size);
 
+  /**
+   * Shows or hides the entity
+   * @param[in] visible Visibility of entity
+   */
+  void SetVisible(bool visible);
+
+  /**
+   * Returns transformation of the entity relative to its parent
+   * @return Local model matrix
+   */
+  Dali::Matrix GetLocalMatrix() const;
+
+  /**
+   * Sets whether entity may be merged into a static batch
+   * @param[in] isStatic true if entity never moves
+   */
+  void SetStatic(bool isStatic);
+
+  /**
+   * Checks whether entity may be merged into a static batch
+   * @return true if entity is static
+   */
+  bool IsStatic() const;
+
+  /**
+   * Marks entity as merged into a static batch, batched entity stays hidden
+   * regardless of its visibility as it's drawn by the batch
+   * @param[in] batched true if entity is drawn by a batch
+   */
+  void SetBatched(bool batched);
+
+  /**
+   * Checks whether entity is drawn by a static batch
+   * @return true if entity is batched
+   */
+  bool IsBatched() const;
+
+  /**
+   * Computes world space axis-aligned bounding box of the entity
+   * @param[in] parentMatrix World matrix of the parent actor
+   * @param[out] boundsMin Minimum corner of the bounding box
+   * @param[out] boundsMax Maximum corner of the bounding box
+   * @return false if entity has no model
+   */
+  bool GetWorldBoundingBox(const Dali::Matrix& parentMatrix, Dali::Vector3& boundsMin, Dali::Vector3& boundsMax);
+
   /**
    * Updates Dali::Renderer in case if anything changed ( geometry, texture, etc. )
    */
@@ -85,6 +132,9 @@ public:
 private:
   Dali::Actor  mActor;
   GameRenderer mGameRenderer;
+  bool         mIsStatic;
+  bool         mIsVisible;
+  bool         mIsBatched;
 };
 
 #endif
@@ -18,41 +18,147 @@
 #include "game-model.h"
 #include "game-utils.h"
 
+#include <dali/integration-api/debug.h>
+
+#include <stdio.h>
+#include <string.h>
+
 using namespace GameUtils;
 
 namespace
 {
 // 'MODV' tag stored in the big-endian (network) order
 const uint32_t MODV_TAG(0x4D4F4456);
+
+// Primitive type of attribute components as stored in attributeFormat[]
+const uint32_t ATTRIBUTE_TYPE_FLOAT('f');
+
+// Maximum number of attributes header can describe
+const uint32_t MAX_ATTRIBUTE_COUNT(16u);
+
+// Attribute names used by the game-renderer shader, in order of appearance in file
+const char* ATTRIBUTE_NAMES[] = {"aPosition", "aNormal", "aTexCoord"};
+
+const uint32_t ATTRIBUTE_NAMES_COUNT(sizeof(ATTRIBUTE_NAMES) / sizeof(ATTRIBUTE_NAMES[0]));
+
+/**
+ * Reads header from possibly unaligned memory
+ */
+template<typename T>
+bool ReadHeader(const char* data, size_t size, size_t offset, T& out)
+{
+  if(offset + sizeof(T) > size)
+  {
+    return false;
+  }
+  memcpy(&out, data + offset, sizeof(T));
+  return true;
+}
+
+/**
+ * Finds the half of the file matching native byte order and reads its header
+ * @param[in] data Pointer to the file data
+ * @param[in] fileSize Size of the whole file
+ * @param[out] header Native-endian header
+ * @param[out] base Absolute offset of the native-endian half
+ * @param[out] size Size of the native-endian half
+ * @return true if valid header has been found
+ */
+bool SelectNativeVariant(const char* data, size_t fileSize, ModelHeader& header, size_t& base, size_t& size)
+{
+  // File contains big-endian variant followed by little-endian one, both of the same size.
+  // Only the half matching native byte order is touched so the other one is never paged in.
+  base = 0u;
+  size = fileSize / 2;
+
+  if(!ReadHeader(data, size, 0u, header))
+  {
+    return false;
+  }
+
+  // expect big-endian
+  if(MODV_TAG != header.tag)
+  {
+    // jump to little-endian variant
+    base = size;
+    if(!ReadHeader(data + base, size, 0u, header) || MODV_TAG != header.tag)
+    {
+      return false;
+    }
+  }
+
+  // data offsets are absolute within the file; summed in 64 bits so that a corrupt size can't wrap
+  return header.vertexStride != 0u && header.dataBeginOffset >= base &&
+         uint64_t(header.dataBeginOffset) + header.vertexBufferSize <= uint64_t(base) + size;
+}
+
+/**
+ * Locates optional index data
+ * @param[in] data Pointer to the beginning of the native-endian part of the file
+ * @param[in] size Size of the native-endian part in bytes
+ * @param[in] base Absolute offset of the native-endian part within the file
+ * @param[in] header Native-endian header
+ * @param[out] indexHeader Index data header
+ * @return Pointer to the index data, NULL if model has no valid index data
+ */
+const char* GetIndexData(const char* data, size_t size, size_t base, const ModelHeader& header, IndexHeader& indexHeader)
+{
+  if(!header.reserved || header.reserved < base || !ReadHeader(data, size, header.reserved - base, indexHeader))
+  {
+    return NULL;
+  }
+
+  const size_t dataSize(size_t(indexHeader.indexCount) * indexHeader.indexSize);
+  if(indexHeader.dataBeginOffset < base || indexHeader.dataBeginOffset - base + dataSize > size ||
+     (indexHeader.indexSize != sizeof(uint16_t) && indexHeader.indexSize != sizeof(uint32_t)))
+  {
+    return NULL;
+  }
+
+  return data + (indexHeader.dataBeginOffset - base);
+}
 } // namespace
 
 GameModel::GameModel(const char* filename)
 : mUniqueId(false),
   mIsReady(false)
 {
-  ByteArray bytes;
-  if(!LoadFile(filename, bytes))
+  MappedFile file;
+  if(!file.Open(filename))
   {
     return;
   }
 
-  mHeader = *(reinterpret_cast<ModelHeader*>(bytes.data()));
+  const char* data(file.GetData());
+  size_t      base, size;
+  if(!SelectNativeVariant(data, file.GetSize(), mHeader, base, size))
+  {
+    DALI_LOG_ERROR("Invalid model file: %s\n", filename);
+    return;
+  }
 
-  // expect big-endian
-  if(MODV_TAG != mHeader.tag)
+  if(!CreateVertexFormat(mVertexFormat))
   {
-    // jump to little-endian variant
-    mHeader = *(reinterpret_cast<ModelHeader*>(bytes.data() + bytes.size() / 2));
+    DALI_LOG_ERROR("Unsupported vertex format in model file: %s\n", filename);
+    return;
   }
 
-  mVertexBuffer = Dali::VertexBuffer::New(Dali::Property::Map().Add("aPosition", Dali::Property::VECTOR3).Add("aNormal", Dali::Property::VECTOR3).Add("aTexCoord", Dali::Property::VECTOR2));
+  ComputeBoundingBox(data + mHeader.dataBeginOffset);
 
-  mVertexBuffer.SetData(bytes.data() + mHeader.dataBeginOffset, mHeader.vertexBufferSize / mHeader.vertexStride);
+  mVertexBuffer = Dali::VertexBuffer::New(mVertexFormat);
+  mVertexBuffer.SetData(data + mHeader.dataBeginOffset, mHeader.vertexBufferSize / mHeader.vertexStride);
 
   mGeometry = Dali::Geometry::New();
   mGeometry.AddVertexBuffer(mVertexBuffer);
   mGeometry.SetType(Dali::Geometry::TRIANGLES);
 
+  if(!SetupIndexBuffer(data + base, size, base))
+  {
+    DALI_LOG_ERROR("Corrupted index data in model file: %s\n", filename);
+    return;
+  }
+
+  mFilename = filename;
   mUniqueId = HashString(filename);
 
   mIsReady = true;
@@ -62,6 +168,189 @@ GameModel::~GameModel()
 {
 }
 
+bool GameModel::CreateVertexFormat(Dali::Property::Map& format) const
+{
+  if(mHeader.attributeCount == 0u || mHeader.attributeCount > MAX_ATTRIBUTE_COUNT)
+  {
+    return false;
+  }
+
+  // VertexBuffer expects tightly packed attributes in order
+  uint32_t offset(0u);
+  for(uint32_t i = 0u; i < mHeader.attributeCount; ++i)
+  {
+    const uint32_t type(mHeader.attributeFormat[i] >> 16);
+    const uint32_t count(mHeader.attributeFormat[i] & 0xffff);
+
+    if(type != ATTRIBUTE_TYPE_FLOAT || mHeader.attributeOffset[i] != offset ||
+       mHeader.attributeSize[i] != count * sizeof(float))
+    {
+      return false;
+    }
+
+    Dali::Property::Type propertyType;
+    switch(count)
+    {
+      case 1:
+        propertyType = Dali::Property::FLOAT;
+        break;
+      case 2:
+        propertyType = Dali::Property::VECTOR2;
+        break;
+      case 3:
+        propertyType = Dali::Property::VECTOR3;
+        break;
+      case 4:
+        propertyType = Dali::Property::VECTOR4;
+        break;
+      default:
+        return false;
+    }
+
+    if(i < ATTRIBUTE_NAMES_COUNT)
+    {
+      format.Add(ATTRIBUTE_NAMES[i], propertyType);
+    }
+    else
+    {
+      char name[32];
+      snprintf(name, sizeof(name), "aAttribute%u", i);
+      format.Add(name, propertyType);
+    }
+
+    offset += mHeader.attributeSize[i];
+  }
+
+  return offset == mHeader.vertexStride;
+}
+
+bool GameModel::SetupIndexBuffer(const char* data, size_t size, size_t base)
+{
+  if(!mHeader.reserved)
+  {
+    return true;
+  }
+
+  IndexHeader indexHeader;
+  const char* indexData(GetIndexData(data, size, base, mHeader, indexHeader));
+  if(!indexData)
+  {
+    return false;
+  }
+
+  // copy out to guarantee alignment, mapped data doesn't have to be aligned
+  const size_t dataSize(size_t(indexHeader.indexCount) * indexHeader.indexSize);
+  if(indexHeader.indexSize == sizeof(uint16_t))
+  {
+    Dali::Vector<uint16_t> indices;
+    indices.Resize(indexHeader.indexCount);
+    memcpy(indices.Begin(), indexData, dataSize);
+    mGeometry.SetIndexBuffer(indices.Begin(), indices.Count());
+  }
+  else
+  {
+    Dali::Vector<uint32_t> indices;
+    indices.Resize(indexHeader.indexCount);
+    memcpy(indices.Begin(), indexData, dataSize);
+    mGeometry.SetIndexBuffer(indices.Begin(), indices.Count());
+  }
+
+  return true;
+}
+
+bool GameModel::LoadVertexData(ByteArray& vertices) const
+{
+  MappedFile  file;
+  ModelHeader header;
+  size_t      base, size;
+  if(!mIsReady || !file.Open(mFilename.c_str()) || !SelectNativeVariant(file.GetData(), file.GetSize(), header, base, size))
+  {
+    return false;
+  }
+
+  const char* vertexData(file.GetData() + header.dataBeginOffset);
+  if(!header.reserved)
+  {
+    vertices.assign(vertexData, vertexData + header.vertexBufferSize);
+    return true;
+  }
+
+  // expand indexed geometry into the triangle list
+  IndexHeader indexHeader;
+  const char* indexData(GetIndexData(file.GetData() + base, size, base, header, indexHeader));
+  if(!indexData)
+  {
+    return false;
+  }
+
+  const uint32_t vertexCount(header.vertexBufferSize / header.vertexStride);
+  vertices.resize(size_t(indexHeader.indexCount) * header.vertexStride);
+  for(uint32_t i = 0u; i < indexHeader.indexCount; ++i)
+  {
+    uint32_t index(0u);
+    if(indexHeader.indexSize == sizeof(uint16_t))
+    {
+      uint16_t shortIndex;
+      memcpy(&shortIndex, indexData + i * sizeof(uint16_t), sizeof(uint16_t));
+      index = shortIndex;
+    }
+    else
+    {
+      memcpy(&index, indexData + i * sizeof(uint32_t), sizeof(uint32_t));
+    }
+
+    if(index >= vertexCount)
+    {
+      return false;
+    }
+    memcpy(vertices.data() + size_t(i) * header.vertexStride, vertexData + size_t(index) * header.vertexStride, header.vertexStride);
+  }
+  return true;
+}
+
+const Dali::Property::Map& GameModel::GetVertexFormat() const
+{
+  return mVertexFormat;
+}
+
+const ModelHeader& GameModel::GetHeader() const
+{
+  return mHeader;
+}
+
+void GameModel::ComputeBoundingBox(const char* vertexData)
+{
+  // position is always the first attribute
+  if((mHeader.attributeFormat[0] & 0xffff) != 3u)
+  {
+    return;
+  }
+
+  const uint32_t vertexCount(mHeader.vertexBufferSize / mHeader.vertexStride);
+  for(uint32_t i = 0u; i < vertexCount; ++i)
+  {
+    float position[3];
+    memcpy(position, vertexData + i * mHeader.vertexStride + mHeader.attributeOffset[0], sizeof(position));
+
+    Dali::Vector3 vertex(position[0], position[1], position[2]);
+    if(i == 0u)
+    {
+      mBoundsMin = mBoundsMax = vertex;
+    }
+    else
+    {
+      mBoundsMin = Dali::Min(mBoundsMin, vertex);
+      mBoundsMax = Dali::Max(mBoundsMax, vertex);
+    }
+  }
+}
+
+void GameModel::GetBoundingBox(Dali::Vector3& boundsMin, Dali::Vector3& boundsMax) const
+{
+  boundsMin = mBoundsMin;
+  boundsMax = mBoundsMax;
+}
+
 Dali::Geometry& GameModel::GetGeometry()
 {
   return mGeometry;
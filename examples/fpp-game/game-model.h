@@ -18,10 +18,15 @@
  *
  */
 
+#include <dali/public-api/math/vector3.h>
+#include <dali/public-api/object/property-map.h>
 #include <dali/public-api/rendering/geometry.h>
 #include <dali/public-api/rendering/vertex-buffer.h>
 
 #include <inttypes.h>
+#include <string>
+
+#include "game-utils.h"
 
 /**
  * @brief The ModelHeader struct
@@ -37,17 +42,31 @@ struct ModelHeader
   uint32_t attributeOffset[16]; /// attribute offsets
   uint32_t attributeSize[16];   /// attribute size in bytes
   uint32_t vertexStride;        /// vertex stride
-  uint32_t reserved;            /// reserved, may point at additional structure
+  uint32_t reserved;            /// reserved, may point at additional structure ( IndexHeader offset if non-zero )
   uint32_t dataBeginOffset;     /// start of actual vertex data
 };
 
+/**
+ * @brief The IndexHeader struct
+ * Optional index data header, pointed by ModelHeader::reserved. Offsets are
+ * absolute within the file, same as ModelHeader::dataBeginOffset.
+ */
+struct IndexHeader
+{
+  uint32_t indexCount;      /// number of indices
+  uint32_t indexSize;       /// size of single index in bytes ( 2 or 4 )
+  uint32_t dataBeginOffset; /// start of actual index data
+};
+
 /**
  * @brief The GameModel class
  * GameModel represents model geometry. It loads model data from external model file ( .mod file ).
  * Such data is ready to be used as GL buffer so it can be copied directly into the VertexBuffer
  * object.
  *
- * Model file is multi-architecture so can be loaded on little and big endian architectures
+ * Model file is multi-architecture so can be loaded on little and big endian architectures.
+ * The file is memory-mapped and only the half matching the native byte order is accessed.
+ * Vertex format is built from the attribute table stored in the header.
  */
 class GameModel
 {
@@ -81,12 +100,69 @@ public:
    */
   uint32_t GetUniqueId();
 
+  /**
+   * Returns local space axis-aligned bounding box of the model
+   * @param[out] boundsMin Minimum corner of the bounding box
+   * @param[out] boundsMax Maximum corner of the bounding box
+   */
+  void GetBoundingBox(Dali::Vector3& boundsMin, Dali::Vector3& boundsMax) const;
+
+  /**
+   * Returns native-endian model header
+   * @return Reference to the header
+   */
+  const ModelHeader& GetHeader() const;
+
+  /**
+   * Returns vertex format built from the header attribute table
+   * @return Property map describing vertex format
+   */
+  const Dali::Property::Map& GetVertexFormat() const;
+
+  /**
+   * Reads vertex data back from the file, indexed geometry is expanded into triangle list.
+   * Used when vertices have to be processed on CPU, ie. by static batching
+   * @param[out] vertices Vertex data in the format described by the header
+   * @return true if success
+   */
+  bool LoadVertexData(GameUtils::ByteArray& vertices) const;
+
+private:
+  /**
+   * Builds vertex format from the header attribute table
+   * @param[out] format Property map describing vertex format
+   * @return true if format is valid
+   */
+  bool CreateVertexFormat(Dali::Property::Map& format) const;
+
+  /**
+   * Sets index buffer on geometry if the model stores indices
+   * @param[in] data Pointer to the beginning of the native-endian part of the file
+   * @param[in] size Size of the native-endian part in bytes
+   * @param[in] base Absolute offset of the native-endian part within the file
+   * @return true if success or model has no indices
+   */
+  bool SetupIndexBuffer(const char* data, size_t size, size_t base);
+
+  /**
+   * Computes bounding box from the position attribute
+   * @param[in] vertexData Pointer to the vertex data
+   */
+  void ComputeBoundingBox(const char* vertexData);
+
 private:
   Dali::Geometry     mGeometry;
   Dali::VertexBuffer mVertexBuffer;
 
+  Dali::Property::Map mVertexFormat; /// Vertex format built from the header
+
   ModelHeader mHeader;
 
+  Dali::Vector3 mBoundsMin; /// Bounding box minimum corner
+  Dali::Vector3 mBoundsMax; /// Bounding box maximum corner
+
+  std::string mFilename; /// Path to the model file
+
   uint32_t mUniqueId;
   bool     mIsReady;
 };
@@ -81,3 +81,13 @@ Dali::Renderer& GameRenderer::GetRenderer()
 {
   return mRenderer;
 }
+
+GameModel* GameRenderer::GetModel() const
+{
+  return mModel;
+}
+
+GameTexture* GameRenderer::GetMainTexture() const
+{
+  return mTexture;
+}
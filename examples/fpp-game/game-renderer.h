@@ -60,6 +60,18 @@ public:
    */
   Dali::Renderer& GetRenderer();
 
+  /**
+   * Returns current model
+   * @return Pointer to the GameModel or NULL if not set
+   */
+  GameModel* GetModel() const;
+
+  /**
+   * Returns current main texture
+   * @return Pointer to the GameTexture or NULL if not set
+   */
+  GameTexture* GetMainTexture() const;
+
 private:
   /**
    * Initialises rendering data
@@ -18,6 +18,7 @@
 #include <stdio.h>
 #include <string.h>
 
+#include "game-batch.h"
 #include "game-camera.h"
 #include "game-entity.h"
 #include "game-model.h"
@@ -25,18 +26,66 @@
 #include "game-scene.h"
 #include "game-texture.h"
 
-#include "third-party/pico-json.h"
+#include "shared/json-reader.h"
 
 #include <dali/dali.h>
+#include <map>
 
 using namespace Dali;
-using namespace picojson;
+using DemoHelper::JsonReader;
 
 using std::vector;
 
 using namespace GameUtils;
 
+namespace
+{
+// Size of the spatial index cell in world units
+const float SPATIAL_INDEX_CELL_SIZE(4.0f);
+
+// Transformation of the scene root actor
+const Vector3    ROOT_SCALE(-1.0f, 1.0f, 1.0f);
+const Quaternion ROOT_ORIENTATION(Degree(90), Vector3(1.0f, 0.0f, 0.0f));
+
+/**
+ * Reads an array of count numbers, ignoring any extra ones
+ */
+bool ReadNumbers(JsonReader& reader, float* values, size_t count)
+{
+  if(!reader.BeginArray())
+  {
+    return false;
+  }
+  size_t index(0u);
+  while(reader.NextElement())
+  {
+    if(index < count ? !reader.ReadNumber(values[index++]) : !reader.Skip())
+    {
+      return false;
+    }
+  }
+  return !reader.HasError() && index >= count;
+}
+
+/**
+ * Reads a member which may be null, in which case found is false
+ */
+bool ReadOptionalNumbers(JsonReader& reader, float* values, size_t count, bool& found)
+{
+  found = reader.Peek() != JsonReader::Type::NULL_VALUE;
+  return found ? ReadNumbers(reader, values, count) : reader.ReadNull();
+}
+
+bool ReadOptionalString(JsonReader& reader, std::string& value, bool& found)
+{
+  found = reader.Peek() != JsonReader::Type::NULL_VALUE;
+  return found ? reader.ReadString(value) : reader.ReadNull();
+}
+} // namespace
+
 GameScene::GameScene()
+: mStaticBatchingEnabled(true),
+  mStaticBatchesBuilt(false)
 {
 }
 
@@ -52,95 +101,97 @@ bool GameScene::Load(Window window, const char* filename)
     return false;
   }
 
-  // add EOL
-  bytes.push_back('\0');
+  // Entities are created as their properties are read, straight from the file buffer
+  JsonReader  reader(bytes.data(), bytes.size());
+  std::string resourceName;
+  bool        failed(!reader.BeginObject());
 
-  picojson::value root;
-  picojson::parse(root, bytes.data());
-
-  bool failed(false);
-
-  if(root.is<object>())
+  std::string_view key;
+  while(!failed && reader.NextMember(key))
   {
-    object rootObject = root.get<object>();
-    for(object::iterator it = rootObject.begin(); it != rootObject.end(); ++it)
-    {
-      std::string entityName((*it).first);
+    GameEntity* entity = new GameEntity(std::string(key).c_str());
+    mEntities.PushBack(entity);
 
-      GameEntity* entity = new GameEntity(entityName.c_str());
-      mEntities.PushBack(entity);
+    GameModel*   model(NULL);
+    GameTexture* texture(NULL);
 
-      value& val((*it).second);
-      value& vLocation = val.get("location");
-      value& vRotation = val.get("rotation");
-      value& vScale    = val.get("scale");
-      value& vSize     = val.get("size");
-      value& vModel    = val.get("model");
-      value& vTexture  = val.get("texture");
-
-      if(!vLocation.is<null>())
+    failed = !reader.BeginObject();
+    while(!failed && reader.NextMember(key))
+    {
+      float values[4];
+      bool  found(false);
+      if(key == "location")
       {
-        array& location = vLocation.get<array>();
-        entity->SetLocation(Vector3(
-          location.at(0).get<double>(),
-          location.at(1).get<double>(),
-          location.at(2).get<double>()));
+        failed = !ReadOptionalNumbers(reader, values, 3u, found);
+        if(found && !failed)
+        {
+          entity->SetLocation(Vector3(values[0], values[1], values[2]));
+        }
       }
-
-      if(!vRotation.is<null>())
+      else if(key == "rotation")
       {
-        array& rotation = vRotation.get<array>();
-        entity->SetRotation(Quaternion(Vector4(
-          -rotation.at(0).get<double>(),
-          rotation.at(1).get<double>(),
-          -rotation.at(2).get<double>(),
-          rotation.at(3).get<double>())));
+        failed = !ReadOptionalNumbers(reader, values, 4u, found);
+        if(found && !failed)
+        {
+          entity->SetRotation(Quaternion(Vector4(-values[0], values[1], -values[2], values[3])));
+        }
       }
-
-      if(!vScale.is<null>())
+      else if(key == "scale")
       {
-        array& scale = vScale.get<array>();
-        entity->SetScale(Vector3(
-          scale.at(0).get<double>(),
-          scale.at(1).get<double>(),
-          scale.at(2).get<double>()));
+        failed = !ReadOptionalNumbers(reader, values, 3u, found);
+        if(found && !failed)
+        {
+          entity->SetScale(Vector3(values[0], values[1], values[2]));
+        }
       }
-
-      if(!vSize.is<null>())
+      else if(key == "size")
       {
-        array& size = vSize.get<array>();
-        entity->SetSize(Vector3(
-          size.at(0).get<double>(),
-          size.at(1).get<double>(),
-          size.at(2).get<double>()));
+        failed = !ReadOptionalNumbers(reader, values, 3u, found);
+        if(found && !failed)
+        {
+          entity->SetSize(Vector3(values[0], values[1], values[2]));
+        }
       }
-
-      GameModel*   model(NULL);
-      GameTexture* texture(NULL);
-
-      if(!vModel.is<null>())
+      else if(key == "model")
       {
-        std::string& strModel = vModel.get<std::string>();
-        model                 = GetResource(strModel.c_str(), mModelCache);
+        failed = !ReadOptionalString(reader, resourceName, found);
+        if(found && !failed)
+        {
+          model = GetResource(resourceName.c_str(), mModelCache);
+        }
       }
-
-      if(!vTexture.is<null>())
+      else if(key == "texture")
       {
-        std::string& strTexture = vTexture.get<std::string>();
-        texture                 = GetResource(strTexture.c_str(), mTextureCache);
+        failed = !ReadOptionalString(reader, resourceName, found);
+        if(found && !failed)
+        {
+          texture = GetResource(resourceName.c_str(), mTextureCache);
+        }
       }
-
-      if(!model || !texture)
+      else if(key == "static" && reader.Peek() == JsonReader::Type::BOOLEAN)
       {
-        failed = true;
-        break;
+        bool isStatic(false);
+        failed = !reader.ReadBool(isStatic);
+        entity->SetStatic(isStatic);
       }
+      else
+      {
+        failed = !reader.Skip();
+      }
+    }
 
-      entity->GetGameRenderer().SetModel(model);
-      entity->GetGameRenderer().SetMainTexture(texture);
+    if(failed || reader.HasError() || !model || !texture)
+    {
+      failed = true;
+      break;
     }
+
+    entity->GetGameRenderer().SetModel(model);
+    entity->GetGameRenderer().SetMainTexture(texture);
   }
 
+  failed = failed || !reader.Finish();
+
   if(failed)
   {
     return false;
@@ -151,9 +202,9 @@ bool GameScene::Load(Window window, const char* filename)
   mRootActor.SetProperty(Actor::Property::ANCHOR_POINT, AnchorPoint::CENTER);
   mRootActor.SetProperty(Actor::Property::PARENT_ORIGIN, ParentOrigin::CENTER);
   window.GetRootLayer().Add(mRootActor);
-  mRootActor.SetProperty(Actor::Property::SCALE, Vector3(-1.0, 1.0, 1.0));
+  mRootActor.SetProperty(Actor::Property::SCALE, ROOT_SCALE);
   mRootActor.SetProperty(Actor::Property::POSITION, Vector3(0.0, 0.0, 0.0));
-  mRootActor.SetProperty(Actor::Property::ORIENTATION, Quaternion(Degree(90), Vector3(1.0, 0.0, 0.0)));
+  mRootActor.SetProperty(Actor::Property::ORIENTATION, ROOT_ORIENTATION);
   for(size_t i = 0; i < mEntities.Size(); ++i)
   {
     Actor actor(mEntities[i]->GetActor());
@@ -163,13 +214,140 @@ bool GameScene::Load(Window window, const char* filename)
     mEntities[i]->UpdateRenderer();
   }
 
+  BuildSpatialIndex();
+
+  if(mStaticBatchingEnabled)
+  {
+    BuildStaticBatches();
+  }
+
   // update camera
   mCamera.Initialise(window.GetRenderTaskList().GetTask(0).GetCameraActor(), 60.0f, 0.1f, 100.0f, window.GetSize());
+  mCamera.SetSpatialIndex(&mSpatialIndex);
 
   return true;
 }
 
+void GameScene::BuildSpatialIndex()
+{
+  // root actor sits in the middle of the window which is the world origin
+  Matrix rootMatrix;
+  rootMatrix.SetTransformComponents(ROOT_SCALE, ROOT_ORIENTATION, Vector3::ZERO);
+
+  for(size_t i = 0; i < mEntities.Size(); ++i)
+  {
+    Vector3 boundsMin, boundsMax;
+    if(mEntities[i]->GetWorldBoundingBox(rootMatrix, boundsMin, boundsMax))
+    {
+      mSpatialIndex.AddEntity(mEntities[i], boundsMin, boundsMax);
+    }
+  }
+
+  mSpatialIndex.Build(SPATIAL_INDEX_CELL_SIZE);
+}
+
+GameSpatialIndex& GameScene::GetSpatialIndex()
+{
+  return mSpatialIndex;
+}
+
 Dali::Actor& GameScene::GetRootActor()
 {
   return mRootActor;
 }
+
+void GameScene::BuildStaticBatches()
+{
+  mStaticBatchesBuilt = true;
+
+  // vertices of every model are read from its file once and shared by all its entities
+  std::map<GameModel*, GameUtils::ByteArray> modelVertices;
+
+  // group static entities by vertex layout, their textures are packed into the atlas of the batch
+  for(size_t i = 0; i < mEntities.Size(); ++i)
+  {
+    GameEntity*   entity(mEntities[i]);
+    GameRenderer& renderer(entity->GetGameRenderer());
+    if(!entity->IsStatic() || !renderer.GetModel() || !renderer.GetMainTexture())
+    {
+      continue;
+    }
+
+    GameBatch* batch(NULL);
+    for(BatchArray::Iterator iter = mBatches.Begin(); iter != mBatches.End(); ++iter)
+    {
+      if((*iter)->IsCompatible(renderer.GetModel(), renderer.GetMainTexture()))
+      {
+        batch = *iter;
+        break;
+      }
+    }
+
+    if(!batch)
+    {
+      batch = new GameBatch();
+      mBatches.PushBack(batch);
+    }
+
+    std::map<GameModel*, GameUtils::ByteArray>::iterator vertices(modelVertices.find(renderer.GetModel()));
+    if(vertices == modelVertices.end())
+    {
+      vertices = modelVertices.insert(std::make_pair(renderer.GetModel(), GameUtils::ByteArray())).first;
+      renderer.GetModel()->LoadVertexData(vertices->second);
+    }
+
+    batch->Add(entity, vertices->second);
+  }
+
+  // merging a single entity gains nothing so such batches are dropped
+  BatchArray::Iterator iter = mBatches.Begin();
+  while(iter != mBatches.End())
+  {
+    if((*iter)->GetEntityCount() < 2u || !(*iter)->Finalise())
+    {
+      delete *iter;
+      iter = mBatches.Erase(iter);
+    }
+    else
+    {
+      // batch vertices are in the space of the scene root actor
+      mRootActor.Add((*iter)->GetActor());
+      (*iter)->SetEnabled(mStaticBatchingEnabled);
+      ++iter;
+    }
+  }
+}
+
+void GameScene::SetStaticBatchingEnabled(bool enabled)
+{
+  mStaticBatchingEnabled = enabled;
+
+  if(mStaticBatchingEnabled && !mStaticBatchesBuilt && mRootActor)
+  {
+    BuildStaticBatches();
+    return;
+  }
+
+  for(BatchArray::Iterator iter = mBatches.Begin(); iter != mBatches.End(); ++iter)
+  {
+    (*iter)->SetEnabled(mStaticBatchingEnabled);
+  }
+}
+
+bool GameScene::IsStaticBatchingEnabled() const
+{
+  return mStaticBatchingEnabled;
+}
+
+uint32_t GameScene::GetDrawCallCount() const
+{
+  uint32_t count(mStaticBatchingEnabled ? mBatches.Size() : 0u);
+  for(size_t i = 0; i < mEntities.Size(); ++i)
+  {
+    if(!mEntities[i]->IsBatched())
+    {
+      ++count;
+    }
+  }
+  return count;
+}
@@ -24,11 +24,13 @@
 
 #include "game-camera.h"
 #include "game-container.h"
+#include "game-spatial-index.h"
 #include "game-utils.h"
 
 #include <dali/public-api/actors/actor.h>
 #include <dali/public-api/adaptor-framework/window.h>
 
+class GameBatch;
 class GameCamera;
 class GameEntity;
 class GameTexture;
@@ -40,6 +42,7 @@ class GameModel;
 typedef GameContainer<GameEntity*>  EntityArray;
 typedef GameContainer<GameTexture*> TextureArray;
 typedef GameContainer<GameModel*>   ModelArray;
+typedef GameContainer<GameBatch*>   BatchArray;
 
 class GameScene
 {
@@ -78,14 +81,56 @@ public:
    */
   Dali::Actor& GetRootActor();
 
+  /**
+   * Returns spatial index used to cull scene entities
+   * @return Spatial index of the scene
+   */
+  GameSpatialIndex& GetSpatialIndex();
+
+  /**
+   * Enables or disables static batching. When enabled, static entities sharing the same
+   * vertex layout are drawn by a single merged renderer, with their textures packed into an
+   * atlas. Batches are built on first use, by default during Load()
+   * @param[in] enabled true to draw static entities with batches
+   */
+  void SetStaticBatchingEnabled(bool enabled);
+
+  /**
+   * Checks whether static batching is enabled
+   * @return true if static batching is enabled
+   */
+  bool IsStaticBatchingEnabled() const;
+
+  /**
+   * Returns number of renderers currently used to draw the scene, not taking culling into account
+   * @return Number of draw calls
+   */
+  uint32_t GetDrawCallCount() const;
+
+private:
+  /**
+   * Builds spatial index from world space bounds of entities
+   */
+  void BuildSpatialIndex();
+
+  /**
+   * Merges static entities sharing the same texture into batches
+   */
+  void BuildStaticBatches();
+
 private:
-  EntityArray mEntities;
-  GameCamera  mCamera;
+  EntityArray      mEntities;
+  GameCamera       mCamera;
+  GameSpatialIndex mSpatialIndex;
 
   // internal scene cache
   ModelArray   mModelCache;
   TextureArray mTextureCache;
 
+  BatchArray mBatches;               /// Static batches
+  bool       mStaticBatchingEnabled; /// Static batching state
+  bool       mStaticBatchesBuilt;    /// Flag set once batches have been built
+
   Dali::Actor mRootActor;
 };
 
@@ -0,0 +1,313 @@
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include "game-spatial-index.h"
+#include "game-entity.h"
+
+#include <dali/public-api/math/degree.h>
+#include <dali/public-api/math/math-utils.h>
+#include <dali/public-api/math/radian.h>
+
+#include <algorithm>
+#include <cmath>
+
+using namespace Dali;
+
+namespace
+{
+// Default draw distance, matches the default far plane of the GameCamera
+const float DEFAULT_DRAW_DISTANCE(100.0f);
+
+// Default size of the grid cell
+const float DEFAULT_CELL_SIZE(4.0f);
+
+// Limit of cells along each axis
+const uint32_t MAX_CELLS_PER_AXIS(256u);
+
+enum FrustumPlane
+{
+  PLANE_LEFT,
+  PLANE_RIGHT,
+  PLANE_TOP,
+  PLANE_BOTTOM,
+  PLANE_NEAR,
+  PLANE_FAR,
+  PLANE_COUNT
+};
+
+/**
+ * Creates plane equation from normal and point lying on the plane
+ */
+Vector4 MakePlane(const Vector3& normal, const Vector3& point)
+{
+  Vector3 n(normal);
+  n.Normalize();
+  return Vector4(n.x, n.y, n.z, -n.Dot(point));
+}
+} // namespace
+
+GameSpatialIndex::GameSpatialIndex()
+: mCellSize(DEFAULT_CELL_SIZE),
+  mCellsX(0u),
+  mCellsZ(0u),
+  mDrawDistance(DEFAULT_DRAW_DISTANCE),
+  mQueryStamp(0u),
+  mEnabled(true)
+{
+}
+
+GameSpatialIndex::~GameSpatialIndex()
+{
+}
+
+void GameSpatialIndex::AddEntity(GameEntity* entity, const Vector3& boundsMin, const Vector3& boundsMax)
+{
+  Item item = {entity, boundsMin, boundsMax, 0u, 0u};
+  mItems.push_back(item);
+}
+
+void GameSpatialIndex::Build(float cellSize)
+{
+  mCells.clear();
+  mVisible.clear();
+  mCellsX = mCellsZ = 0u;
+
+  if(mItems.empty())
+  {
+    return;
+  }
+
+  mBoundsMin = mItems[0].boundsMin;
+  mBoundsMax = mItems[0].boundsMax;
+  for(size_t i = 1; i < mItems.size(); ++i)
+  {
+    mBoundsMin = Min(mBoundsMin, mItems[i].boundsMin);
+    mBoundsMax = Max(mBoundsMax, mItems[i].boundsMax);
+  }
+
+  // grow cells if the level is too large for requested size
+  const float extent(std::max(mBoundsMax.x - mBoundsMin.x, mBoundsMax.z - mBoundsMin.z));
+  mCellSize = std::max(cellSize > 0.0f ? cellSize : DEFAULT_CELL_SIZE, extent / MAX_CELLS_PER_AXIS);
+
+  mCellsX = std::max(1u, uint32_t(std::ceil((mBoundsMax.x - mBoundsMin.x) / mCellSize)));
+  mCellsZ = std::max(1u, uint32_t(std::ceil((mBoundsMax.z - mBoundsMin.z) / mCellSize)));
+  mCells.resize(mCellsX * mCellsZ);
+
+  // store item in every cell it overlaps
+  for(uint32_t i = 0u; i < mItems.size(); ++i)
+  {
+    const Item&    item(mItems[i]);
+    const uint32_t x0(std::min(mCellsX - 1u, uint32_t((item.boundsMin.x - mBoundsMin.x) / mCellSize)));
+    const uint32_t x1(std::min(mCellsX - 1u, uint32_t((item.boundsMax.x - mBoundsMin.x) / mCellSize)));
+    const uint32_t z0(std::min(mCellsZ - 1u, uint32_t((item.boundsMin.z - mBoundsMin.z) / mCellSize)));
+    const uint32_t z1(std::min(mCellsZ - 1u, uint32_t((item.boundsMax.z - mBoundsMin.z) / mCellSize)));
+    for(uint32_t z = z0; z <= z1; ++z)
+    {
+      for(uint32_t x = x0; x <= x1; ++x)
+      {
+        mCells[z * mCellsX + x].push_back(i);
+      }
+    }
+  }
+
+  // everything is visible until the first query
+  for(uint32_t i = 0u; i < mItems.size(); ++i)
+  {
+    mItems[i].visibleStamp = mQueryStamp;
+    mVisible.push_back(i);
+  }
+}
+
+void GameSpatialIndex::SetDrawDistance(float distance)
+{
+  mDrawDistance = distance;
+}
+
+void GameSpatialIndex::SetEnabled(bool enabled)
+{
+  if(mEnabled != enabled)
+  {
+    mEnabled = enabled;
+    if(!mEnabled)
+    {
+      SetAllVisible(true);
+    }
+  }
+}
+
+bool GameSpatialIndex::IsEnabled() const
+{
+  return mEnabled;
+}
+
+void GameSpatialIndex::Cull(const Vector3& position, const Quaternion& rotation, float fovY, float aspect, float near, float far)
+{
+  if(!mEnabled || mCells.empty())
+  {
+    return;
+  }
+
+  // camera looks along its local +Z axis
+  const Vector3 forward(rotation.Rotate(Vector3::ZAXIS));
+  const Vector3 right(rotation.Rotate(Vector3::XAXIS));
+  const Vector3 up(rotation.Rotate(Vector3::YAXIS));
+
+  const float tanV(std::tan(Radian(Degree(fovY)).radian * 0.5f));
+  const float tanH(tanV * aspect);
+  const float farDistance(std::min(far, mDrawDistance));
+
+  mPlanes[PLANE_LEFT]   = MakePlane(forward * tanH + right, position);
+  mPlanes[PLANE_RIGHT]  = MakePlane(forward * tanH - right, position);
+  mPlanes[PLANE_TOP]    = MakePlane(forward * tanV - up, position);
+  mPlanes[PLANE_BOTTOM] = MakePlane(forward * tanV + up, position);
+  mPlanes[PLANE_NEAR]   = MakePlane(forward, position + forward * near);
+  mPlanes[PLANE_FAR]    = MakePlane(-forward, position + forward * farDistance);
+
+  // horizontal extent of the frustum selects cells to visit
+  Vector3 regionMin(position);
+  Vector3 regionMax(position);
+  for(int i = 0; i < 4; ++i)
+  {
+    const Vector3 corner(position + (forward + right * (i & 1 ? tanH : -tanH) + up * (i & 2 ? tanV : -tanV)) * farDistance);
+    regionMin = Min(regionMin, corner);
+    regionMax = Max(regionMax, corner);
+  }
+
+  ++mQueryStamp;
+  mNextVisible.clear();
+
+  if(regionMax.x >= mBoundsMin.x && regionMin.x <= mBoundsMax.x &&
+     regionMax.z >= mBoundsMin.z && regionMin.z <= mBoundsMax.z)
+  {
+    const uint32_t x0(uint32_t(std::max(0.0f, (regionMin.x - mBoundsMin.x) / mCellSize)));
+    const uint32_t z0(uint32_t(std::max(0.0f, (regionMin.z - mBoundsMin.z) / mCellSize)));
+    const uint32_t x1(std::min(mCellsX - 1u, uint32_t((regionMax.x - mBoundsMin.x) / mCellSize)));
+    const uint32_t z1(std::min(mCellsZ - 1u, uint32_t((regionMax.z - mBoundsMin.z) / mCellSize)));
+
+    const float drawDistanceSquared(mDrawDistance * mDrawDistance);
+
+    for(uint32_t z = z0; z <= z1; ++z)
+    {
+      for(uint32_t x = x0; x <= x1; ++x)
+      {
+        const std::vector<uint32_t>& cell(mCells[z * mCellsX + x]);
+        for(size_t i = 0; i < cell.size(); ++i)
+        {
+          Item& item(mItems[cell[i]]);
+          if(item.queryStamp == mQueryStamp)
+          {
+            continue;
+          }
+          item.queryStamp = mQueryStamp;
+
+          // distance to the closest point of the box
+          const Vector3 closest(Clamp(position.x, item.boundsMin.x, item.boundsMax.x),
+                                Clamp(position.y, item.boundsMin.y, item.boundsMax.y),
+                                Clamp(position.z, item.boundsMin.z, item.boundsMax.z));
+          if((closest - position).LengthSquared() > drawDistanceSquared || !IsInside(item))
+          {
+            continue;
+          }
+
+          if(item.visibleStamp != mQueryStamp - 1u)
+          {
+            item.entity->SetVisible(true);
+          }
+          item.visibleStamp = mQueryStamp;
+          mNextVisible.push_back(cell[i]);
+        }
+      }
+    }
+  }
+
+  // hide only the items which have just left the view
+  for(size_t i = 0; i < mVisible.size(); ++i)
+  {
+    Item& item(mItems[mVisible[i]]);
+    if(item.visibleStamp != mQueryStamp)
+    {
+      item.entity->SetVisible(false);
+    }
+  }
+
+  mVisible.swap(mNextVisible);
+}
+
+uint32_t GameSpatialIndex::GetVisibleCount() const
+{
+  if(!mEnabled)
+  {
+    return GetTotalCount();
+  }
+
+  uint32_t count(0u);
+  for(size_t i = 0; i < mVisible.size(); ++i)
+  {
+    if(!mItems[mVisible[i]].entity->IsBatched())
+    {
+      ++count;
+    }
+  }
+  return count;
+}
+
+uint32_t GameSpatialIndex::GetTotalCount() const
+{
+  uint32_t count(0u);
+  for(size_t i = 0; i < mItems.size(); ++i)
+  {
+    if(!mItems[i].entity->IsBatched())
+    {
+      ++count;
+    }
+  }
+  return count;
+}
+
+bool GameSpatialIndex::IsInside(const Item& item) const
+{
+  for(int i = 0; i < PLANE_COUNT; ++i)
+  {
+    const Vector4& plane(mPlanes[i]);
+
+    // test the box corner furthest along the plane normal
+    const Vector3 corner(plane.x >= 0.0f ? item.boundsMax.x : item.boundsMin.x,
+                         plane.y >= 0.0f ? item.boundsMax.y : item.boundsMin.y,
+                         plane.z >= 0.0f ? item.boundsMax.z : item.boundsMin.z);
+
+    if(plane.x * corner.x + plane.y * corner.y + plane.z * corner.z + plane.w < 0.0f)
+    {
+      return false;
+    }
+  }
+  return true;
+}
+
+void GameSpatialIndex::SetAllVisible(bool visible)
+{
+  mVisible.clear();
+  ++mQueryStamp;
+  for(uint32_t i = 0u; i < mItems.size(); ++i)
+  {
+    mItems[i].entity->SetVisible(visible);
+    mItems[i].visibleStamp = mQueryStamp;
+    if(visible)
+    {
+      mVisible.push_back(i);
+    }
+  }
+}
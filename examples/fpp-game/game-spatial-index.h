@@ -0,0 +1,153 @@
+#ifndef GAME_SPATIAL_INDEX_H
+#define GAME_SPATIAL_INDEX_H
+
+/*
+ * Copyright (c) 2020 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <dali/public-api/math/quaternion.h>
+#include <dali/public-api/math/vector3.h>
+#include <dali/public-api/math/vector4.h>
+
+#include <inttypes.h>
+#include <vector>
+
+class GameEntity;
+
+/**
+ * @brief The GameSpatialIndex class
+ * Uniform grid over the horizontal ( XZ ) plane of the world storing entity bounds.
+ *
+ * Every camera tick the grid is queried with the view frustum truncated at the draw
+ * distance. Only entities stored in cells overlapping the frustum are tested, entities
+ * which fail the test or are not reached at all are hidden. Visibility is toggled only
+ * for entities whose state changed since the previous query.
+ */
+class GameSpatialIndex
+{
+public:
+  /**
+   * Creates an instance of GameSpatialIndex
+   */
+  GameSpatialIndex();
+
+  /**
+   * Destroys an instance of GameSpatialIndex
+   */
+  ~GameSpatialIndex();
+
+  /**
+   * Adds entity with its world space bounding box. Must be called before Build()
+   * @param[in] entity Entity to add
+   * @param[in] boundsMin World space minimum corner of the bounding box
+   * @param[in] boundsMax World space maximum corner of the bounding box
+   */
+  void AddEntity(GameEntity* entity, const Dali::Vector3& boundsMin, const Dali::Vector3& boundsMax);
+
+  /**
+   * Distributes added entities into grid cells
+   * @param[in] cellSize Size of the single cell in world units
+   */
+  void Build(float cellSize);
+
+  /**
+   * Sets maximum distance at which entities are still visible
+   * @param[in] distance Draw distance in world units
+   */
+  void SetDrawDistance(float distance);
+
+  /**
+   * Enables or disables culling. When disabled all entities are visible
+   * @param[in] enabled true to enable culling
+   */
+  void SetEnabled(bool enabled);
+
+  /**
+   * Checks whether culling is enabled
+   * @return true if culling is enabled
+   */
+  bool IsEnabled() const;
+
+  /**
+   * Updates visibility of entities for the given camera
+   * @param[in] position Camera position
+   * @param[in] rotation Camera orientation
+   * @param[in] fovY Vertical field of view in degrees
+   * @param[in] aspect Aspect ratio of the view
+   * @param[in] near Near plane
+   * @param[in] far Far plane
+   */
+  void Cull(const Dali::Vector3& position, const Dali::Quaternion& rotation, float fovY, float aspect, float near, float far);
+
+  /**
+   * Returns number of entities visible after the last Cull(). Entities merged into a static
+   * batch are drawn by the batch whatever their visibility, so they are not counted
+   * @return Number of visible entities
+   */
+  uint32_t GetVisibleCount() const;
+
+  /**
+   * Returns number of entities stored in the index, not counting the batched ones
+   * @return Number of entities
+   */
+  uint32_t GetTotalCount() const;
+
+private:
+  /**
+   * Entity bounds and culling state
+   */
+  struct Item
+  {
+    GameEntity*   entity;
+    Dali::Vector3 boundsMin;
+    Dali::Vector3 boundsMax;
+    uint32_t      queryStamp;   /// Last query which tested the item
+    uint32_t      visibleStamp; /// Last query which found the item visible
+  };
+
+  /**
+   * Tests bounding box against the frustum planes
+   * @param[in] item Item to test
+   * @return true if box is at least partially inside
+   */
+  bool IsInside(const Item& item) const;
+
+  /**
+   * Shows or hides all the entities
+   * @param[in] visible Visibility to set
+   */
+  void SetAllVisible(bool visible);
+
+private:
+  std::vector<Item>                  mItems;       /// All items
+  std::vector<std::vector<uint32_t>> mCells;       /// Item indices per cell
+  std::vector<uint32_t>              mVisible;     /// Items visible after the last query
+  std::vector<uint32_t>              mNextVisible; /// Items visible after the current query
+
+  Dali::Vector4 mPlanes[6]; /// Frustum planes, normals pointing inwards
+
+  Dali::Vector3 mBoundsMin; /// Minimum corner of the whole grid
+  Dali::Vector3 mBoundsMax; /// Maximum corner of the whole grid
+
+  float    mCellSize;     /// Size of the single cell
+  uint32_t mCellsX;       /// Number of cells along X axis
+  uint32_t mCellsZ;       /// Number of cells along Z axis
+  float    mDrawDistance; /// Draw distance
+  uint32_t mQueryStamp;   /// Current query number
+  bool     mEnabled;      /// Culling state
+};
+
+#endif
@@ -23,7 +23,10 @@
 #include <dali-toolkit/public-api/image-loader/sync-image-loader.h>
 
 GameTexture::GameTexture()
-: mUniqueId(0),
+: mWidth(0u),
+  mHeight(0u),
+  mPixelFormat(Dali::Pixel::INVALID),
+  mUniqueId(0),
   mIsReady(false)
 {
 }
@@ -33,7 +36,10 @@ GameTexture::~GameTexture()
 }
 
 GameTexture::GameTexture(const char* filename)
-: mUniqueId(0),
+: mWidth(0u),
+  mHeight(0u),
+  mPixelFormat(Dali::Pixel::INVALID),
+  mUniqueId(0),
   mIsReady(false)
 {
   Load(filename);
@@ -65,6 +71,11 @@ bool GameTexture::Load(const char* filename)
   mSampler    = sampler;
   mTextureSet = textureSet;
 
+  mFilename    = filename;
+  mWidth       = pixelData.GetWidth();
+  mHeight      = pixelData.GetHeight();
+  mPixelFormat = pixelData.GetPixelFormat();
+
   mUniqueId = GameUtils::HashString(filename);
 
   mIsReady = true;
@@ -86,3 +97,31 @@ bool GameTexture::IsReady()
 {
   return mIsReady;
 }
+
+void GameTexture::GetSize(uint32_t& width, uint32_t& height) const
+{
+  width  = mWidth;
+  height = mHeight;
+}
+
+Dali::Pixel::Format GameTexture::GetPixelFormat() const
+{
+  return mPixelFormat;
+}
+
+bool GameTexture::UploadTo(Dali::Texture& texture, uint32_t xOffset, uint32_t yOffset, uint32_t width, uint32_t height) const
+{
+  if(!mIsReady)
+  {
+    return false;
+  }
+
+  // pixels aren't kept after Load() so the file is decoded again, only when an atlas is built
+  Dali::PixelData pixelData = Dali::Toolkit::SyncImageLoader::Load(mFilename, Dali::ImageDimensions(width, height), Dali::FittingMode::SCALE_TO_FILL, Dali::SamplingMode::BOX_THEN_LINEAR, true);
+  if(!pixelData || pixelData.GetWidth() != width || pixelData.GetHeight() != height || pixelData.GetPixelFormat() != mPixelFormat)
+  {
+    return false;
+  }
+
+  return texture.Upload(pixelData, 0u, 0u, xOffset, yOffset, width, height);
+}
@@ -23,6 +23,7 @@
 #include <dali/public-api/rendering/texture.h>
 
 #include <inttypes.h>
+#include <string>
 
 class GameTexture
 {
@@ -66,11 +67,41 @@ public:
    */
   uint32_t GetUniqueId();
 
+  /**
+   * Returns size of the loaded image
+   * @param[out] width Width in pixels
+   * @param[out] height Height in pixels
+   */
+  void GetSize(uint32_t& width, uint32_t& height) const;
+
+  /**
+   * Returns pixel format of the loaded image
+   * @return Pixel format
+   */
+  Dali::Pixel::Format GetPixelFormat() const;
+
+  /**
+   * Loads the image file again, scaled to the given size, and uploads it into a region of
+   * another texture of the same pixel format, ie. an atlas
+   * @param[in] texture Texture to upload to
+   * @param[in] xOffset Left of the region
+   * @param[in] yOffset Top of the region
+   * @param[in] width Width of the region
+   * @param[in] height Height of the region
+   * @return true if success
+   */
+  bool UploadTo(Dali::Texture& texture, uint32_t xOffset, uint32_t yOffset, uint32_t width, uint32_t height) const;
+
 private:
   Dali::Texture    mTexture;
   Dali::Sampler    mSampler;
   Dali::TextureSet mTextureSet;
 
+  std::string         mFilename;
+  uint32_t            mWidth;
+  uint32_t            mHeight;
+  Dali::Pixel::Format mPixelFormat;
+
   uint32_t mUniqueId;
 
   bool mIsReady;
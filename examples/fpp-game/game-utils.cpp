@@ -20,6 +20,13 @@
 #include <inttypes.h>
 #include <stdio.h>
 
+#if !defined(_WIN32)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
 #include "game-utils.h"
 
 namespace GameUtils
@@ -48,6 +55,88 @@ bool LoadFile(const char* filename, ByteArray& bytes)
   return false;
 }
 
+MappedFile::MappedFile()
+: mData(NULL),
+  mSize(0u),
+  mIsMapped(false)
+{
+}
+
+MappedFile::~MappedFile()
+{
+  Close();
+}
+
+bool MappedFile::Open(const char* filename)
+{
+  Close();
+
+#if !defined(_WIN32)
+  int fd = open(filename, O_RDONLY);
+  if(fd >= 0)
+  {
+    struct stat fileStat;
+    if(fstat(fd, &fileStat) == 0 && fileStat.st_size > 0)
+    {
+      void* address = mmap(NULL, fileStat.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+      if(address != MAP_FAILED)
+      {
+        mData     = static_cast<const char*>(address);
+        mSize     = fileStat.st_size;
+        mIsMapped = true;
+      }
+    }
+    // mapping stays valid after closing the descriptor
+    close(fd);
+
+    if(mIsMapped)
+    {
+      return true;
+    }
+  }
+#endif
+
+  // fall back to reading the file, ie. from the application package
+  if(!LoadFile(filename, mFallback))
+  {
+    mFallback.clear();
+    return false;
+  }
+
+  mData = mFallback.data();
+  mSize = mFallback.size();
+  return true;
+}
+
+void MappedFile::Close()
+{
+#if !defined(_WIN32)
+  if(mIsMapped)
+  {
+    munmap(const_cast<char*>(mData), mSize);
+  }
+#endif
+  ByteArray().swap(mFallback);
+  mData     = NULL;
+  mSize     = 0u;
+  mIsMapped = false;
+}
+
+const char* MappedFile::GetData() const
+{
+  return mData;
+}
+
+size_t MappedFile::GetSize() const
+{
+  return mSize;
+}
+
+bool MappedFile::IsMapped() const
+{
+  return mIsMapped;
+}
+
 size_t HashString(const char* str)
 {
   size_t hash = 5381;
@@ -31,6 +31,70 @@ typedef std::vector<char> ByteArray;
  */
 bool LoadFile(const char* filename, ByteArray& out);
 
+/**
+ * @brief The MappedFile class
+ * Read-only view of a whole file. Where possible the file is memory-mapped so
+ * only the pages which are actually accessed are read from the storage. If the
+ * file cannot be mapped ( ie. it lives inside an Android asset package ) the
+ * content is loaded with LoadFile() instead.
+ */
+class MappedFile
+{
+public:
+  /**
+   * Creates an empty MappedFile
+   */
+  MappedFile();
+
+  /**
+   * Unmaps the file
+   */
+  ~MappedFile();
+
+  /**
+   * Maps the file into memory, returns true on success
+   * @param[in] filename Path to the file
+   * @return true if success
+   */
+  bool Open(const char* filename);
+
+  /**
+   * Releases the mapping
+   */
+  void Close();
+
+  /**
+   * Returns pointer to the beginning of the file data
+   * @return Pointer to the data or NULL if file is not open
+   */
+  const char* GetData() const;
+
+  /**
+   * Returns size of the file in bytes
+   * @return Size of the file
+   */
+  size_t GetSize() const;
+
+  /**
+   * Checks whether the file has been mapped rather than loaded
+   * @return true if data points at the memory mapping
+   */
+  bool IsMapped() const;
+
+private:
+  // Undefined copy constructor.
+  MappedFile(const MappedFile&);
+
+  // Undefined assignment operator.
+  MappedFile& operator=(const MappedFile&);
+
+private:
+  ByteArray   mFallback; /// Storage used when mapping is not possible
+  const char* mData;     /// Pointer to the file data
+  size_t      mSize;     /// Size of the file in bytes
+  bool        mIsMapped; /// true if mData points at the memory mapping
+};
+
 /**
  * Computes hash value from string using djb2 algorithm
  * @return hash value
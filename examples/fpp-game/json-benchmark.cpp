@@ -0,0 +1,178 @@
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include "json-benchmark.h"
+
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include "shared/json-reader.h"
+#include "third-party/pico-json.h"
+
+namespace
+{
+const char* BENCHMARK_FILES[] = {
+  DEMO_GAME_DIR "/scene.json",
+  DEMO_GAME_DIR "/reflection.gltf",
+  DEMO_MODEL_DIR "BoxAnimated.gltf",
+  DEMO_MODEL_DIR "Duck.gltf",
+  DEMO_MODEL_DIR "DamagedHelmet.gltf",
+  DEMO_MODEL_DIR "BoomBox.gltf",
+  DEMO_MODEL_DIR "Lantern.gltf",
+};
+
+bool ReadFile(const char* filename, std::vector<char>& bytes)
+{
+  FILE* file = fopen(filename, "rb");
+  if(!file)
+  {
+    return false;
+  }
+  fseek(file, 0, SEEK_END);
+  const long size = ftell(file);
+  fseek(file, 0, SEEK_SET);
+  bytes.resize(size > 0 ? size_t(size) : 0u);
+  const bool success = fread(bytes.data(), 1, bytes.size(), file) == bytes.size();
+  fclose(file);
+  return success;
+}
+
+/**
+ * Builds the document from a copy of the text, as glTF::ParseJSON used to
+ */
+bool ParseDocument(const std::vector<char>& bytes, double& checksum)
+{
+  picojson::value root;
+  const std::string error = picojson::parse(root, std::string(bytes.data(), bytes.size()));
+  checksum += root.is<picojson::object>() ? double(root.get<picojson::object>().size()) : 0.0;
+  return error.empty();
+}
+
+/**
+ * Reads every number and string out of the text
+ */
+bool WalkValue(DemoHelper::JsonReader& reader, double& checksum)
+{
+  using Type = DemoHelper::JsonReader::Type;
+  switch(reader.Peek())
+  {
+    case Type::OBJECT:
+    {
+      std::string_view key;
+      reader.BeginObject();
+      while(reader.NextMember(key))
+      {
+        checksum += double(key.size());
+        WalkValue(reader, checksum);
+      }
+      break;
+    }
+    case Type::ARRAY:
+    {
+      reader.BeginArray();
+      while(reader.NextElement())
+      {
+        WalkValue(reader, checksum);
+      }
+      break;
+    }
+    case Type::NUMBER:
+    {
+      double value;
+      if(reader.ReadNumber(value))
+      {
+        checksum += value;
+      }
+      break;
+    }
+    case Type::STRING:
+    {
+      std::string_view value;
+      if(reader.ReadString(value))
+      {
+        checksum += double(value.size());
+      }
+      break;
+    }
+    default:
+    {
+      reader.Skip();
+      break;
+    }
+  }
+  return !reader.HasError();
+}
+
+bool StreamDocument(const std::vector<char>& bytes, double& checksum)
+{
+  DemoHelper::JsonReader reader(bytes.data(), bytes.size());
+  return WalkValue(reader, checksum) && reader.Finish();
+}
+
+/**
+ * Returns average time of a single parse, in microseconds, or a negative value if it fails
+ */
+double Measure(bool (*function)(const std::vector<char>&, double&), const std::vector<char>& bytes, uint32_t iterations, double& checksum)
+{
+  const auto start = std::chrono::steady_clock::now();
+  for(uint32_t i = 0; i < iterations; ++i)
+  {
+    if(!function(bytes, checksum))
+    {
+      return -1.0;
+    }
+  }
+  const auto end = std::chrono::steady_clock::now();
+  return std::chrono::duration<double, std::micro>(end - start).count() / iterations;
+}
+
+} // namespace
+
+void RunJsonBenchmark(uint32_t iterations)
+{
+  iterations = iterations ? iterations : 1u;
+
+  printf("JSON benchmark: %u iterations\n", iterations);
+  printf("%-22s %10s %14s %14s %10s\n", "file", "KB", "picojson us", "streaming us", "speed-up");
+
+  double checksum = 0.0;
+  for(const char* filename : BENCHMARK_FILES)
+  {
+    const char* name = strrchr(filename, '/');
+    name             = name ? name + 1 : filename;
+
+    std::vector<char> bytes;
+    if(!ReadFile(filename, bytes))
+    {
+      printf("%-22s can't be read\n", name);
+      continue;
+    }
+
+    const double documentTime  = Measure(&ParseDocument, bytes, iterations, checksum);
+    const double streamingTime = Measure(&StreamDocument, bytes, iterations, checksum);
+    if(documentTime < 0.0 || streamingTime < 0.0)
+    {
+      printf("%-22s failed to parse\n", name);
+      continue;
+    }
+    printf("%-22s %10.1f %14.2f %14.2f %9.2fx\n", name, bytes.size() / 1024.0, documentTime, streamingTime, streamingTime > 0.0 ? documentTime / streamingTime : 0.0);
+  }
+  printf("(checksum %f)\n", checksum);
+}
@@ -0,0 +1,29 @@
+#ifndef DALI_FPP_GAME_JSON_BENCHMARK_H
+#define DALI_FPP_GAME_JSON_BENCHMARK_H
+
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <cstdint>
+
+/**
+ * Measures parsing the game scene and the glTF files, the way the loaders used to with a picojson
+ * document and with DemoHelper::JsonReader walking every value. Results are printed to stdout.
+ */
+void RunJsonBenchmark(uint32_t iterations);
+
+#endif // DALI_FPP_GAME_JSON_BENCHMARK_H
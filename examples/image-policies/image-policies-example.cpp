@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2020 Samsung Electronics Co., Ltd.
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -21,7 +21,10 @@
 #include <dali-toolkit/devel-api/visual-factory/visual-factory.h>
 #include <dali-toolkit/devel-api/visuals/image-visual-properties-devel.h>
 #include <dali/dali.h>
+#include <iostream>
+#include <memory>
 #include <string>
+#include "image-policy-benchmark.h"
 #include "shared/view.h"
 
 using namespace Dali;
@@ -57,6 +60,8 @@ enum TableRowPlacement
   NUMBER_OF_ROWS
 };
 
+bool gRunBenchmark(false); ///< Measure each policy combination instead of showing the examples, set with the --benchmark option
+
 } // namespace
 
 /**
@@ -389,6 +394,14 @@ public:
     view.SetProperty(Toolkit::Control::Property::BACKGROUND, gradientBackground);
     window.Add(view);
 
+    if(gRunBenchmark)
+    {
+      window.KeyEventSignal().Connect(this, &ImagePolicies::OnKeyEvent);
+      mBenchmark = std::make_unique<ImagePolicyBenchmark>(window);
+      mBenchmark->Start();
+      return;
+    }
+
     // Create a table view to show a pair of buttons above each image.
     mTable = TableView::New(TableRowPlacement::NUMBER_OF_ROWS, 1);
     mTable.SetProperty(Actor::Property::ANCHOR_POINT, AnchorPoint::CENTER);
@@ -538,11 +551,30 @@ private:
   PushButton mNextButton;
   ImageView  mPersistantImageView;
 
+  std::unique_ptr<ImagePolicyBenchmark> mBenchmark;
+
   unsigned int mExampleIndex;
 };
 
 int DALI_EXPORT_API main(int argc, char** argv)
 {
+  for(int i(1); i < argc; ++i)
+  {
+    std::string arg(argv[i]);
+    if(arg.compare("--benchmark") == 0)
+    {
+      gRunBenchmark = true;
+    }
+    else if((arg.compare("--help") == 0) || (arg.compare("-h") == 0))
+    {
+      std::cout << "image-policies.example [OPTIONS]" << std::endl;
+      std::cout << "  Options:" << std::endl;
+      std::cout << "    --benchmark    Measures the load and release policies on images of several sizes and shows a table" << std::endl;
+      std::cout << "    -h|--help      Help" << std::endl;
+      return 0;
+    }
+  }
+
   Application   application = Application::New(&argc, &argv, DEMO_THEME_PATH);
   ImagePolicies test(application);
   application.MainLoop();
@@ -0,0 +1,317 @@
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include "image-policy-benchmark.h"
+
+#include <dali-toolkit/devel-api/controls/control-devel.h>
+#include <dali/devel-api/adaptor-framework/image-loading.h>
+#include <algorithm>
+#include <iomanip>
+#include <iostream>
+#include <numeric>
+#include <sstream>
+
+// INTERNAL INCLUDES
+#include "shared/utility.h"
+
+using namespace Dali;
+using namespace Dali::Toolkit;
+using DemoHelper::MillisecondsSince;
+
+namespace
+{
+const char* BENCHMARK_IMAGE_PATH[] = {
+  DEMO_IMAGE_DIR "gallery-small-23.jpg",
+  DEMO_IMAGE_DIR "gallery-large-20.jpg",
+  DEMO_IMAGE_DIR "keyboard-Landscape.jpg",
+};
+
+constexpr uint32_t PREPARE_DELAY_MS = 500u; ///< From creating the image view to attaching it, IMMEDIATE loads during this time
+constexpr uint32_t SHOW_MS          = 200u; ///< How long a ready image stays attached
+constexpr uint32_t SETTLE_MS        = 100u; ///< Lets the texture manager process a detach or a destruction
+constexpr uint32_t REATTACH_CYCLES  = 3u;
+
+using Clock = std::chrono::steady_clock;
+
+const char* GetLoadPolicyName(ImageVisual::LoadPolicy::Type loadPolicy)
+{
+  return loadPolicy == ImageVisual::LoadPolicy::IMMEDIATE ? "IMMEDIATE" : "ATTACHED";
+}
+
+const char* GetReleasePolicyName(ImageVisual::ReleasePolicy::Type releasePolicy)
+{
+  return releasePolicy == ImageVisual::ReleasePolicy::DETACHED ? "DETACHED" : "DESTROYED";
+}
+
+} // namespace
+
+ImagePolicyBenchmark::ImagePolicyBenchmark(Window window)
+: mWindow(window)
+{
+}
+
+ImagePolicyBenchmark::~ImagePolicyBenchmark()
+{
+  UnparentAndReset(mContainer);
+  UnparentAndReset(mStatus);
+}
+
+void ImagePolicyBenchmark::Start()
+{
+  mStatus = TextLabel::New("Decoding the images");
+  mStatus.SetProperty(TextLabel::Property::MULTI_LINE, true);
+  mStatus.SetProperty(TextLabel::Property::TEXT_COLOR, Color::WHITE);
+  mStatus.SetProperty(TextLabel::Property::POINT_SIZE, 7.0f);
+  mStatus.SetProperty(TextLabel::Property::FONT_FAMILY, "Monospace");
+  mStatus.SetResizePolicy(ResizePolicy::FILL_TO_PARENT, Dimension::WIDTH);
+  mStatus.SetResizePolicy(ResizePolicy::DIMENSION_DEPENDENCY, Dimension::HEIGHT);
+  mStatus.SetProperty(Actor::Property::PARENT_ORIGIN, ParentOrigin::TOP_CENTER);
+  mStatus.SetProperty(Actor::Property::ANCHOR_POINT, AnchorPoint::TOP_CENTER);
+  mWindow.Add(mStatus);
+
+  mContainer = Control::New();
+  mContainer.SetResizePolicy(ResizePolicy::SIZE_RELATIVE_TO_PARENT, Dimension::ALL_DIMENSIONS);
+  mContainer.SetProperty(Actor::Property::SIZE_MODE_FACTOR, Vector3(0.6f, 0.5f, 1.0f));
+  mContainer.SetProperty(Actor::Property::PARENT_ORIGIN, ParentOrigin::BOTTOM_CENTER);
+  mContainer.SetProperty(Actor::Property::ANCHOR_POINT, AnchorPoint::BOTTOM_CENTER);
+  mWindow.Add(mContainer);
+
+  mTimer = Timer::New(SETTLE_MS);
+  mTimer.TickSignal().Connect(this, &ImagePolicyBenchmark::OnTimer);
+
+  // Let the status be rendered before the synchronous decoding.
+  Schedule(Step::MEASURE_DECODING, SETTLE_MS);
+}
+
+void ImagePolicyBenchmark::MeasureDecoding()
+{
+  for(const char* path : BENCHMARK_IMAGE_PATH)
+  {
+    Image image;
+    image.path = path;
+
+    const auto               start  = Clock::now();
+    Dali::Devel::PixelBuffer buffer = Dali::LoadImageFromFile(path);
+    image.decodeMs                  = MillisecondsSince(start);
+
+    if(buffer)
+    {
+      image.textureBytes = static_cast<size_t>(buffer.GetWidth()) * buffer.GetHeight() * Pixel::GetBytesPerPixel(buffer.GetPixelFormat());
+      image.label        = std::to_string(buffer.GetWidth()) + "x" + std::to_string(buffer.GetHeight());
+    }
+    else
+    {
+      image.label = "missing";
+    }
+    mImages.push_back(image);
+  }
+
+  for(size_t i = 0u; i < mImages.size(); ++i)
+  {
+    for(auto loadPolicy : {ImageVisual::LoadPolicy::IMMEDIATE, ImageVisual::LoadPolicy::ATTACHED})
+    {
+      for(auto releasePolicy : {ImageVisual::ReleasePolicy::DETACHED, ImageVisual::ReleasePolicy::DESTROYED})
+      {
+        Case benchmarkCase;
+        benchmarkCase.loadPolicy    = loadPolicy;
+        benchmarkCase.releasePolicy = releasePolicy;
+        benchmarkCase.image         = i;
+        mCases.push_back(benchmarkCase);
+      }
+    }
+  }
+}
+
+void ImagePolicyBenchmark::StartCase()
+{
+  const Case& benchmarkCase = mCases[mCaseIndex];
+
+  std::ostringstream status;
+  status << "Case " << mCaseIndex + 1u << "/" << mCases.size() << ": " << GetLoadPolicyName(benchmarkCase.loadPolicy) << " / "
+         << GetReleasePolicyName(benchmarkCase.releasePolicy) << ", " << mImages[benchmarkCase.image].label;
+  mStatus.SetProperty(TextLabel::Property::TEXT, status.str());
+
+  mCycle     = 0u;
+  mImageView = CreateImageView(benchmarkCase);
+  Schedule(Step::ATTACH, PREPARE_DELAY_MS);
+}
+
+ImageView ImagePolicyBenchmark::CreateImageView(const Case& benchmarkCase)
+{
+  Property::Map imagePropertyMap;
+  imagePropertyMap.Insert(Visual::Property::TYPE, Visual::IMAGE);
+  imagePropertyMap.Insert(ImageVisual::Property::URL, mImages[benchmarkCase.image].path);
+  imagePropertyMap.Insert(ImageVisual::Property::LOAD_POLICY, benchmarkCase.loadPolicy);
+  imagePropertyMap.Insert(ImageVisual::Property::RELEASE_POLICY, benchmarkCase.releasePolicy);
+
+  ImageView imageView = ImageView::New();
+  imageView.SetProperty(ImageView::Property::IMAGE, imagePropertyMap);
+  imageView.SetProperty(Actor::Property::PARENT_ORIGIN, ParentOrigin::CENTER);
+  imageView.SetProperty(Actor::Property::ANCHOR_POINT, AnchorPoint::CENTER);
+  imageView.SetResizePolicy(ResizePolicy::FILL_TO_PARENT, Dimension::ALL_DIMENSIONS);
+  imageView.ResourceReadySignal().Connect(this, &ImagePolicyBenchmark::OnResourceReady);
+  return imageView;
+}
+
+void ImagePolicyBenchmark::Attach()
+{
+  mAttachTime      = Clock::now();
+  mWaitingForReady = true;
+  mContainer.Add(mImageView);
+
+  // A texture still held by the visual, or one already loaded with IMMEDIATE, is ready straight away.
+  if(mWaitingForReady && mImageView.IsResourceReady())
+  {
+    OnResourceReady(mImageView);
+  }
+}
+
+void ImagePolicyBenchmark::OnResourceReady(Control control)
+{
+  if(!mWaitingForReady || control != mImageView)
+  {
+    return; // e.g. an IMMEDIATE load completing before the attach
+  }
+  mWaitingForReady = false;
+
+  Case&       benchmarkCase = mCases[mCaseIndex];
+  const float readyMs       = MillisecondsSince(mAttachTime);
+  if(mRecreating)
+  {
+    benchmarkCase.recreateToReadyMs = readyMs;
+    Schedule(Step::NEXT_CASE, SHOW_MS);
+  }
+  else
+  {
+    benchmarkCase.attachToReadyMs.push_back(readyMs);
+    Schedule(Step::DETACH, SHOW_MS);
+  }
+}
+
+void ImagePolicyBenchmark::Schedule(Step step, uint32_t delayMs)
+{
+  mNextStep  = step;
+  mScheduled = true;
+  mTimer.SetInterval(std::max(delayMs, 1u));
+  if(!mTimer.IsRunning())
+  {
+    mTimer.Start();
+  }
+}
+
+bool ImagePolicyBenchmark::OnTimer()
+{
+  mScheduled = false;
+
+  switch(mNextStep)
+  {
+    case Step::MEASURE_DECODING:
+    {
+      MeasureDecoding();
+      StartCase();
+      break;
+    }
+    case Step::ATTACH:
+    {
+      Attach();
+      break;
+    }
+    case Step::DETACH:
+    {
+      mImageView.Unparent();
+      Schedule(Step::CHECK_HELD, SETTLE_MS);
+      break;
+    }
+    case Step::CHECK_HELD:
+    {
+      // DETACHED releases the texture of the visual when it goes off scene, DESTROYED keeps it until the visual is destroyed.
+      Case& benchmarkCase = mCases[mCaseIndex];
+      if(DevelControl::GetVisualResourceStatus(mImageView, ImageView::Property::IMAGE) == Visual::ResourceStatus::READY)
+      {
+        benchmarkCase.heldAfterDetachBytes = mImages[benchmarkCase.image].textureBytes;
+      }
+
+      if(mCycle++ < REATTACH_CYCLES)
+      {
+        Schedule(Step::ATTACH, SETTLE_MS);
+      }
+      else
+      {
+        mImageView.Reset();
+        Schedule(Step::RECREATE, SETTLE_MS);
+      }
+      break;
+    }
+    case Step::RECREATE:
+    {
+      // Whether the destroyed view's texture is gone shows in how long a new view of the same image takes.
+      mRecreating = true;
+      mImageView  = CreateImageView(mCases[mCaseIndex]);
+      Attach();
+      break;
+    }
+    case Step::NEXT_CASE:
+    {
+      UnparentAndReset(mImageView);
+      mRecreating = false;
+      if(++mCaseIndex < mCases.size())
+      {
+        Schedule(Step::START_CASE, SETTLE_MS);
+      }
+      else
+      {
+        ReportResults();
+      }
+      break;
+    }
+    case Step::START_CASE:
+    {
+      StartCase();
+      break;
+    }
+  }
+
+  return mScheduled;
+}
+
+void ImagePolicyBenchmark::ReportResults()
+{
+  std::ostringstream table;
+  table << std::fixed << std::setprecision(1);
+  table << std::left << std::setw(10) << "Load" << std::setw(10) << "Release" << std::setw(10) << "Image" << std::right
+        << std::setw(9) << "Decode" << std::setw(9) << "Attach" << std::setw(10) << "Reattach" << std::setw(10) << "Held KB"
+        << std::setw(10) << "Recreate" << "\n";
+
+  for(const auto& benchmarkCase : mCases)
+  {
+    const Image& image    = mImages[benchmarkCase.image];
+    const auto&  attaches = benchmarkCase.attachToReadyMs;
+    const float  firstMs  = attaches.empty() ? 0.0f : attaches.front();
+    const float  reattachMs =
+      attaches.size() > 1u ? std::accumulate(attaches.begin() + 1, attaches.end(), 0.0f) / (attaches.size() - 1u) : 0.0f;
+
+    table << std::left << std::setw(10) << GetLoadPolicyName(benchmarkCase.loadPolicy) << std::setw(10)
+          << GetReleasePolicyName(benchmarkCase.releasePolicy) << std::setw(10) << image.label << std::right << std::setw(9)
+          << image.decodeMs << std::setw(9) << firstMs << std::setw(10) << reattachMs << std::setw(10)
+          << benchmarkCase.heldAfterDetachBytes / 1024u << std::setw(10) << benchmarkCase.recreateToReadyMs << "\n";
+  }
+  table << "Times in ms. Attach: first attach to ResourceReady, " << PREPARE_DELAY_MS << "ms after creation. Reattach: mean of "
+        << REATTACH_CYCLES << " reattaches.\nHeld KB: texture kept by the detached view. Recreate: attach to ResourceReady of a new view once destroyed.";
+
+  std::cout << table.str() << std::endl;
+  mStatus.SetProperty(TextLabel::Property::TEXT, table.str());
+}
@@ -0,0 +1,127 @@
+#ifndef DALI_DEMO_IMAGE_POLICY_BENCHMARK_H
+#define DALI_DEMO_IMAGE_POLICY_BENCHMARK_H
+
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <dali-toolkit/dali-toolkit.h>
+#include <dali/dali.h>
+#include <chrono>
+#include <string>
+#include <vector>
+
+/**
+ * Measures each LoadPolicy / ReleasePolicy combination on images of several sizes.
+ *
+ * For each case, a script is run with a timer:
+ *  - the image view is created, then attached after a delay, as when a screen is prepared before being shown,
+ *  - it is detached and reattached a few times, checking after each detach whether the visual still holds its texture,
+ *  - it is destroyed and a new image view of the same image is attached straight away.
+ * The time from each attach to the ResourceReady signal is recorded, and the decode time of each image is measured
+ * synchronously beforehand; a table of the results is logged and shown once all the cases have run.
+ */
+class ImagePolicyBenchmark : public Dali::ConnectionTracker
+{
+public:
+  /**
+   * @param[in] window The window the image views are attached to
+   */
+  ImagePolicyBenchmark(Dali::Window window);
+
+  ~ImagePolicyBenchmark();
+
+  /**
+   * Runs all the cases.
+   */
+  void Start();
+
+private:
+  enum class Step
+  {
+    MEASURE_DECODING,
+    ATTACH,
+    DETACH,
+    CHECK_HELD,
+    RECREATE,
+    NEXT_CASE,
+    START_CASE
+  };
+
+  struct Case
+  {
+    Dali::Toolkit::ImageVisual::LoadPolicy::Type    loadPolicy;
+    Dali::Toolkit::ImageVisual::ReleasePolicy::Type releasePolicy;
+    size_t                                          image; ///< Index of the image
+
+    std::vector<float> attachToReadyMs; ///< The first attach, then each reattach
+    float              recreateToReadyMs{0.0f};
+    size_t             heldAfterDetachBytes{0u}; ///< Largest texture held by the detached view
+  };
+
+  struct Image
+  {
+    std::string path;
+    std::string label;
+    float       decodeMs{0.0f};
+    size_t      textureBytes{0u}; ///< Decoded size
+  };
+
+  /**
+   * Decodes each image once, which also warms up the file cache for the cases.
+   */
+  void MeasureDecoding();
+
+  /**
+   * Creates the image view of the current case, to be attached after a delay.
+   */
+  void StartCase();
+
+  Dali::Toolkit::ImageView CreateImageView(const Case& benchmarkCase);
+
+  void Attach();
+
+  void OnResourceReady(Dali::Toolkit::Control control);
+
+  /**
+   * Goes to the next step of the script after a delay.
+   */
+  void Schedule(Step step, uint32_t delayMs);
+
+  bool OnTimer();
+
+  void ReportResults();
+
+private:
+  Dali::Window             mWindow;
+  Dali::Toolkit::Control   mContainer; ///< Parent of the image view when attached
+  Dali::Toolkit::TextLabel mStatus;
+  Dali::Toolkit::ImageView mImageView;
+  Dali::Timer              mTimer;
+
+  std::vector<Image> mImages;
+  std::vector<Case>  mCases;
+  size_t             mCaseIndex{0u};
+  uint32_t           mCycle{0u};
+  Step               mNextStep{Step::MEASURE_DECODING};
+  bool               mScheduled{false};
+  bool               mWaitingForReady{false};
+  bool               mRecreating{false};
+
+  std::chrono::steady_clock::time_point mAttachTime;
+};
+
+#endif // DALI_DEMO_IMAGE_POLICY_BENCHMARK_H
@@ -16,13 +16,17 @@
  */
 
 // EXTERNAL INCLUDES
+#include <algorithm>
 #include <cstdint> // uint32_t, uint16_t etc
 #include <cstdio>
+#include <cstdlib>
+#include <iostream>
 #include <string>
 
 #include <dali/public-api/math/random.h>
 #include <dali/public-api/rendering/frame-buffer.h>
 #include <dali/public-api/rendering/renderer.h>
+#include <dali/public-api/rendering/sampler.h>
 #include <dali/public-api/rendering/texture-set.h>
 #include <dali/public-api/rendering/texture.h>
 
@@ -42,6 +46,15 @@ const char* const BACKGROUND_IMAGE(DEMO_IMAGE_DIR "background-2.jpg");
 // number of metaballs
 constexpr uint32_t METABALL_NUMBER = 6;
 
+// interval of checking whether metaball animations are idle, in milliseconds
+constexpr uint32_t IDLE_CHECK_INTERVAL = 100;
+
+// Scale of the metaball FBO relative to the screen, set with -s[scale]
+float gMetaballScale = 1.0f;
+
+// Whether the metaball FBO is rendered only when metaballs animate, set with --on-demand
+bool gOnDemand = false;
+
 /**
  * Metadata for each ball
  */
@@ -94,12 +107,20 @@ public:
    */
   void OnKeyEvent(const KeyEvent& event);
 
+  /**
+   * Idle timer callback, stops refreshing the metaball FBO once nothing animates
+   */
+  bool OnIdleCheckTick();
+
 private: // Data
   Application& mApplication;
   Vector2      mScreenSize;
 
   Texture     mBackgroundTexture;
   FrameBuffer mMetaballFBO;
+  RenderTask  mMetaballTask;
+  Timer       mIdleCheckTimer;
+  bool        mTouching;
 
   Actor        mMetaballRoot;
   MetaballInfo mMetaballs[METABALL_NUMBER];
@@ -182,6 +203,16 @@ private: // Data
    * Function to set the actual position of the metaballs when the user clicks the screen
    */
   void SetPositionToMetaballs(const Vector2& metaballCenter);
+
+  /**
+   * Function to check whether the explosion is still in progress
+   */
+  bool IsAnimating() const;
+
+  /**
+   * Function to render the metaball FBO every frame until the metaballs become idle
+   */
+  void RefreshMetaballImage();
 };
 
 /**
@@ -206,7 +237,8 @@ MetaballExplosionController::MetaballExplosionController(Application& applicatio
   mDispersion(0),
   mDispersionAnimation(),
   mTimerDispersion(),
-  mTimeMultiplier(1.0f)
+  mTimeMultiplier(1.0f),
+  mTouching(false)
 {
   // Connect to the Application's Init signal
   mApplication.InitSignal().Connect(this, &MetaballExplosionController::Create);
@@ -245,6 +277,13 @@ void MetaballExplosionController::Create(Application& app)
   mTimerDispersion = Timer::New(150);
   mTimerDispersion.TickSignal().Connect(this, &MetaballExplosionController::OnTimerDispersionTick);
 
+  if(gOnDemand)
+  {
+    mIdleCheckTimer = Timer::New(IDLE_CHECK_INTERVAL);
+    mIdleCheckTimer.TickSignal().Connect(this, &MetaballExplosionController::OnIdleCheckTick);
+    RefreshMetaballImage();
+  }
+
   // Connect the callback to the touch signal on the mesh actor
   window.GetRootLayer().TouchedSignal().Connect(this, &MetaballExplosionController::OnTouch);
 }
@@ -355,21 +394,25 @@ void MetaballExplosionController::CreateMetaballActors()
 void MetaballExplosionController::CreateMetaballImage()
 {
   // Create an FBO and a render task to create to render the metaballs with a fragment shader
+  // The FBO may be smaller than the screen, the default camera keeps the aspect ratio so the
+  // metaballs are just rendered at lower resolution and upsampled by the composition
   Window window = mApplication.GetWindow();
 
-  mMetaballFBO = FrameBuffer::New(mScreenSize.x, mScreenSize.y);
+  uint32_t width  = std::max(1u, static_cast<uint32_t>(mScreenSize.x * gMetaballScale));
+  uint32_t height = std::max(1u, static_cast<uint32_t>(mScreenSize.y * gMetaballScale));
+  mMetaballFBO    = FrameBuffer::New(width, height);
 
   window.Add(mMetaballRoot);
 
   // Create the render task used to render the metaballs
   RenderTaskList taskList = window.GetRenderTaskList();
-  RenderTask     task     = taskList.CreateTask();
-  task.SetRefreshRate(RenderTask::REFRESH_ALWAYS);
-  task.SetSourceActor(mMetaballRoot);
-  task.SetExclusive(true);
-  task.SetClearColor(Color::BLACK);
-  task.SetClearEnabled(true);
-  task.SetFrameBuffer(mMetaballFBO);
+  mMetaballTask           = taskList.CreateTask();
+  mMetaballTask.SetRefreshRate(RenderTask::REFRESH_ALWAYS);
+  mMetaballTask.SetSourceActor(mMetaballRoot);
+  mMetaballTask.SetExclusive(true);
+  mMetaballTask.SetClearColor(Color::BLACK);
+  mMetaballTask.SetClearEnabled(true);
+  mMetaballTask.SetFrameBuffer(mMetaballFBO);
 }
 
 void MetaballExplosionController::CreateComposition()
@@ -382,6 +425,12 @@ void MetaballExplosionController::CreateComposition()
   textureSet.SetTexture(0u, mBackgroundTexture);
   textureSet.SetTexture(1u, mMetaballFBO.GetColorTexture());
 
+  // Bilinear filtering upsamples the reduced resolution metaball image
+  Sampler sampler = Sampler::New();
+  sampler.SetFilterMode(FilterMode::LINEAR, FilterMode::LINEAR);
+  sampler.SetWrapMode(WrapMode::CLAMP_TO_EDGE, WrapMode::CLAMP_TO_EDGE);
+  textureSet.SetSampler(1u, sampler);
+
   // Create geometry
   Geometry metaballGeom = CreateGeometry(false);
 
@@ -522,6 +571,9 @@ bool MetaballExplosionController::OnTouch(Actor actor, const TouchEvent& touch)
   {
     case PointState::DOWN:
     {
+      mTouching = true;
+      RefreshMetaballImage();
+
       ResetMetaballs(true);
 
       const Vector2 screen         = touch.GetScreenPosition(0);
@@ -541,6 +593,7 @@ bool MetaballExplosionController::OnTouch(Actor actor, const TouchEvent& touch)
     case PointState::LEAVE:
     case PointState::INTERRUPTED:
     {
+      mTouching = false;
       mTimerDispersion.Start();
       break;
     }
@@ -550,6 +603,55 @@ bool MetaballExplosionController::OnTouch(Actor actor, const TouchEvent& touch)
   return true;
 }
 
+bool MetaballExplosionController::IsAnimating() const
+{
+  if(mTimerDispersion.IsRunning() && mDispersion < METABALL_NUMBER)
+  {
+    return true;
+  }
+
+  for(uint32_t i = 0; i < METABALL_NUMBER; i++)
+  {
+    if(mDispersionAnimation[i] && mDispersionAnimation[i].GetState() == Animation::PLAYING)
+    {
+      return true;
+    }
+  }
+  return false;
+}
+
+void MetaballExplosionController::RefreshMetaballImage()
+{
+  if(gOnDemand)
+  {
+    // Resume the position variation paused while idle
+    for(uint32_t i = 0; i < METABALL_NUMBER; i++)
+    {
+      mPositionVarAnimation[i].Play();
+    }
+    mMetaballTask.SetRefreshRate(RenderTask::REFRESH_ALWAYS);
+    mIdleCheckTimer.Start();
+  }
+}
+
+bool MetaballExplosionController::OnIdleCheckTick()
+{
+  if(mTouching || IsAnimating())
+  {
+    return true;
+  }
+
+  // The looping position variation would keep the FBO busy forever, pause it while idle
+  for(uint32_t i = 0; i < METABALL_NUMBER; i++)
+  {
+    mPositionVarAnimation[i].Pause();
+  }
+
+  // Render the final state once and stop refreshing
+  mMetaballTask.SetRefreshRate(RenderTask::REFRESH_ONCE);
+  return false;
+}
+
 void MetaballExplosionController::OnKeyEvent(const KeyEvent& event)
 {
   if(event.GetState() == KeyEvent::DOWN)
@@ -566,6 +668,32 @@ void MetaballExplosionController::OnKeyEvent(const KeyEvent& event)
  */
 int32_t DALI_EXPORT_API main(int argc, char** argv)
 {
+  for(int i(1); i < argc; ++i)
+  {
+    std::string arg(argv[i]);
+    if(arg.compare("--on-demand") == 0)
+    {
+      gOnDemand = true;
+    }
+    else if(arg.compare(0, 2, "-s") == 0)
+    {
+      auto scale = atof(arg.substr(2, arg.size()).c_str());
+      if(scale > 0.0f && scale <= 1.0f)
+      {
+        gMetaballScale = scale;
+      }
+    }
+    else if((arg.compare("--help") == 0) || (arg.compare("-h") == 0))
+    {
+      std::cout << "metaball-explosion.example [OPTIONS]" << std::endl;
+      std::cout << "  Options:" << std::endl;
+      std::cout << "    --on-demand  Renders the metaball image only while the metaballs animate" << std::endl;
+      std::cout << "    -s[scale]    Replace [scale] with the metaball image scale in (0, 1], i.e. -s0.5. Default is 1." << std::endl;
+      std::cout << "    -h|--help    Help" << std::endl;
+      return 0;
+    }
+  }
+
   Application application = Application::New(&argc, &argv);
 
   MetaballExplosionController test(application);
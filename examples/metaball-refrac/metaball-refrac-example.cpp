@@ -16,12 +16,16 @@
  */
 
 // EXTERNAL INCLUDES
+#include <algorithm>
 #include <cstdint> // uint32_t, uint16_t etc
 #include <cstdio>
+#include <cstdlib>
+#include <iostream>
 #include <string>
 
 #include <dali/public-api/rendering/frame-buffer.h>
 #include <dali/public-api/rendering/renderer.h>
+#include <dali/public-api/rendering/sampler.h>
 #include <dali/public-api/rendering/texture-set.h>
 #include <dali/public-api/rendering/texture.h>
 
@@ -43,6 +47,15 @@ const float       GRAVITY_Y(-0.09);
 // number of metaballs
 constexpr uint32_t METABALL_NUMBER = 6;
 
+// interval of checking whether metaball animations are idle, in milliseconds
+constexpr uint32_t IDLE_CHECK_INTERVAL = 100;
+
+// Scale of the metaball FBO relative to the screen, set with -s[scale]
+float gMetaballScale = 1.0f;
+
+// Whether the metaball FBO is rendered only when metaballs animate, set with --on-demand
+bool gOnDemand = false;
+
 /**
  * Metadata for each ball
  */
@@ -98,12 +111,20 @@ public:
    */
   void OnKeyEvent(const KeyEvent& event);
 
+  /**
+   * Idle timer callback, stops refreshing the metaball FBO once nothing animates
+   */
+  bool OnIdleCheckTick();
+
 private: // Data
   Application& mApplication;
   Vector2      mScreenSize;
 
   Texture     mBackgroundTexture;
   FrameBuffer mMetaballFBO;
+  RenderTask  mMetaballTask;
+  Timer       mIdleCheckTimer;
+  bool        mTouching;
 
   Actor        mMetaballRoot;
   MetaballInfo mMetaballs[METABALL_NUMBER];
@@ -191,6 +212,16 @@ private: // Data
    * Function to set the actual position of the metaballs when the user clicks the screen
    */
   void SetPositionToMetaballs(const Vector2& metaballCenter);
+
+  /**
+   * Function to check whether any of the metaball animations is still playing
+   */
+  bool IsAnimating() const;
+
+  /**
+   * Function to render the metaball FBO every frame until the metaballs become idle
+   */
+  void RefreshMetaballImage();
 };
 
 /**
@@ -198,7 +229,8 @@ private: // Data
  */
 
 MetaballRefracController::MetaballRefracController(Application& application)
-: mApplication(application)
+: mApplication(application),
+  mTouching(false)
 {
   // Connect to the Application's Init signal
   mApplication.InitSignal().Connect(this, &MetaballRefracController::Create);
@@ -230,6 +262,13 @@ void MetaballRefracController::Create(Application& app)
   CreateComposition();
   CreateAnimations();
 
+  if(gOnDemand)
+  {
+    mIdleCheckTimer = Timer::New(IDLE_CHECK_INTERVAL);
+    mIdleCheckTimer.TickSignal().Connect(this, &MetaballRefracController::OnIdleCheckTick);
+    RefreshMetaballImage();
+  }
+
   // Connect the callback to the touch signal on the mesh actor
   window.GetRootLayer().TouchedSignal().Connect(this, &MetaballRefracController::OnTouch);
 }
@@ -345,20 +384,24 @@ void MetaballRefracController::CreateMetaballActors()
 void MetaballRefracController::CreateMetaballImage()
 {
   // Create an FBO and a render task to create to render the metaballs with a fragment shader
-  Window window = mApplication.GetWindow();
-  mMetaballFBO  = FrameBuffer::New(mScreenSize.x, mScreenSize.y);
+  // The FBO may be smaller than the screen, the default camera keeps the aspect ratio so the
+  // metaballs are just rendered at lower resolution and upsampled by the composition
+  Window   window = mApplication.GetWindow();
+  uint32_t width  = std::max(1u, static_cast<uint32_t>(mScreenSize.x * gMetaballScale));
+  uint32_t height = std::max(1u, static_cast<uint32_t>(mScreenSize.y * gMetaballScale));
+  mMetaballFBO    = FrameBuffer::New(width, height);
 
   window.Add(mMetaballRoot);
 
   //Creation of the render task used to render the metaballs
   RenderTaskList taskList = window.GetRenderTaskList();
-  RenderTask     task     = taskList.CreateTask();
-  task.SetRefreshRate(RenderTask::REFRESH_ALWAYS);
-  task.SetSourceActor(mMetaballRoot);
-  task.SetExclusive(true);
-  task.SetClearColor(Color::BLACK);
-  task.SetClearEnabled(true);
-  task.SetFrameBuffer(mMetaballFBO);
+  mMetaballTask           = taskList.CreateTask();
+  mMetaballTask.SetRefreshRate(RenderTask::REFRESH_ALWAYS);
+  mMetaballTask.SetSourceActor(mMetaballRoot);
+  mMetaballTask.SetExclusive(true);
+  mMetaballTask.SetClearColor(Color::BLACK);
+  mMetaballTask.SetClearEnabled(true);
+  mMetaballTask.SetFrameBuffer(mMetaballFBO);
 }
 
 void MetaballRefracController::CreateComposition()
@@ -371,6 +414,12 @@ void MetaballRefracController::CreateComposition()
   mTextureSetRefraction.SetTexture(0u, mBackgroundTexture);
   mTextureSetRefraction.SetTexture(1u, mMetaballFBO.GetColorTexture());
 
+  // Bilinear filtering upsamples the reduced resolution metaball image
+  Sampler sampler = Sampler::New();
+  sampler.SetFilterMode(FilterMode::LINEAR, FilterMode::LINEAR);
+  sampler.SetWrapMode(WrapMode::CLAMP_TO_EDGE, WrapMode::CLAMP_TO_EDGE);
+  mTextureSetRefraction.SetSampler(1u, sampler);
+
   // Create normal shader
   mShaderNormal = Shader::New(SHADER_METABALL_VERT, SHADER_FRAGMENT_FRAG);
 
@@ -583,6 +632,9 @@ bool MetaballRefracController::OnTouch(Actor actor, const TouchEvent& touch)
   {
     case PointState::DOWN:
     {
+      mTouching = true;
+      RefreshMetaballImage();
+
       StopAfterClickAnimations();
       for(uint32_t i = 0; i < METABALL_NUMBER; i++)
       {
@@ -634,6 +686,8 @@ bool MetaballRefracController::OnTouch(Actor actor, const TouchEvent& touch)
     case PointState::LEAVE:
     case PointState::INTERRUPTED:
     {
+      mTouching = false;
+
       //Stop click animations
       StopClickAnimations();
 
@@ -655,6 +709,47 @@ bool MetaballRefracController::OnTouch(Actor actor, const TouchEvent& touch)
   return true;
 }
 
+bool MetaballRefracController::IsAnimating() const
+{
+  const Animation* animations[] = {mGravityAnimation, mRadiusDecAnimation, mRadiusIncFastAnimation, mRadiusIncSlowAnimation, mPositionVarAnimation};
+  for(const Animation* animationArray : animations)
+  {
+    for(uint32_t i = 0; i < METABALL_NUMBER; i++)
+    {
+      if(animationArray[i] && animationArray[i].GetState() == Animation::PLAYING)
+      {
+        return true;
+      }
+    }
+  }
+  return false;
+}
+
+void MetaballRefracController::RefreshMetaballImage()
+{
+  if(gOnDemand)
+  {
+    mMetaballTask.SetRefreshRate(RenderTask::REFRESH_ALWAYS);
+    mIdleCheckTimer.Start();
+  }
+}
+
+bool MetaballRefracController::OnIdleCheckTick()
+{
+  if(mTouching || IsAnimating())
+  {
+    return true;
+  }
+
+  // The metaballs have fallen off the screen, the radius variation only keeps them wobbling
+  mRadiusVarAnimation[2].Stop();
+  mRadiusVarAnimation[3].Stop();
+
+  // Render the final state once and stop refreshing
+  mMetaballTask.SetRefreshRate(RenderTask::REFRESH_ONCE);
+  return false;
+}
+
 void MetaballRefracController::OnKeyEvent(const KeyEvent& event)
 {
   if(event.GetState() == KeyEvent::DOWN)
@@ -671,6 +766,32 @@ void MetaballRefracController::OnKeyEvent(const KeyEvent& event)
  */
 int32_t DALI_EXPORT_API main(int argc, char** argv)
 {
+  for(int i(1); i < argc; ++i)
+  {
+    std::string arg(argv[i]);
+    if(arg.compare("--on-demand") == 0)
+    {
+      gOnDemand = true;
+    }
+    else if(arg.compare(0, 2, "-s") == 0)
+    {
+      auto scale = atof(arg.substr(2, arg.size()).c_str());
+      if(scale > 0.0f && scale <= 1.0f)
+      {
+        gMetaballScale = scale;
+      }
+    }
+    else if((arg.compare("--help") == 0) || (arg.compare("-h") == 0))
+    {
+      std::cout << "metaball-refrac.example [OPTIONS]" << std::endl;
+      std::cout << "  Options:" << std::endl;
+      std::cout << "    --on-demand  Renders the metaball image only while the metaballs animate" << std::endl;
+      std::cout << "    -s[scale]    Replace [scale] with the metaball image scale in (0, 1], i.e. -s0.5. Default is 1." << std::endl;
+      std::cout << "    -h|--help    Help" << std::endl;
+      return 0;
+    }
+  }
+
   Application application = Application::New(&argc, &argv);
 
   MetaballRefracController test(application);
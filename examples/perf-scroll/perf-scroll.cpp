@@ -17,11 +17,17 @@
 
 // EXTERNAL INCLUDES
 #include <dali-toolkit/dali-toolkit.h>
+#include <dali/devel-api/common/stage.h>
+#include <algorithm>
+#include <cmath>
+#include <fstream>
 #include <iostream>
+#include <memory>
 
 // INTERNAL INCLUDES
 #include "generated/perf-scroll-frag.h"
 #include "generated/perf-scroll-vert.h"
+#include "shared/frame-stats.h"
 #include "shared/utility.h"
 
 using namespace Dali;
@@ -153,12 +159,14 @@ struct VertexWithTexture
 
 bool gUseMesh(false);
 bool gUseNinePatch(false);
+bool gVirtualize(false);
 
 constexpr unsigned int ROWS_PER_PAGE(15);
 constexpr unsigned int COLUMNS_PER_PAGE(15);
 constexpr unsigned int PAGE_COUNT(10);
 
-float gScrollDuration(10.0f); ///< Default animation duration for the scroll, is modifiable with the -t option
+float        gScrollDuration(10.0f); ///< Default animation duration for the scroll, is modifiable with the -t option
+unsigned int gMarginColumns(2u);     ///< Columns kept on either side of the visible page when virtualized, is modifiable with the -m option
 
 Renderer CreateRenderer(unsigned int index, Geometry geometry, Shader shader)
 {
@@ -172,6 +180,23 @@ Renderer CreateRenderer(unsigned int index, Geometry geometry, Shader shader)
   return renderer;
 }
 
+/**
+ * Returns the peak resident set size of the process in kilobytes, 0 if unknown
+ */
+unsigned long GetPeakMemoryKb()
+{
+  std::ifstream status("/proc/self/status");
+  std::string   line;
+  while(std::getline(status, line))
+  {
+    if(line.compare(0, 6, "VmHWM:") == 0)
+    {
+      return std::stoul(line.substr(6));
+    }
+  }
+  return 0u;
+}
+
 } // namespace
 
 /**
@@ -180,6 +205,9 @@ Renderer CreateRenderer(unsigned int index, Geometry geometry, Shader shader)
  *  -t[duration] (seconds)
  *  --use-mesh (Use Renderer API)
  *  --nine-patch (Use nine-patch images in ImageView)
+ *  --virtualize (Only create actors for the visible page and a margin, recycling them while scrolling)
+ *  -m[columns] (Margin on either side of the visible page when virtualized)
+ * Frame times, update thread time and peak memory are printed when the scroll finishes.
  */
 class PerfScroll : public ConnectionTracker
 {
@@ -188,7 +216,8 @@ public:
   : mApplication(application),
     mRowsPerPage(ROWS_PER_PAGE),
     mColumnsPerPage(COLUMNS_PER_PAGE),
-    mPageCount(PAGE_COUNT)
+    mPageCount(PAGE_COUNT),
+    mWindowColumns(0u)
   {
     // Connect to the Application's Init signal
     mApplication.InitSignal().Connect(this, &PerfScroll::Create);
@@ -218,16 +247,43 @@ public:
     mParent.SetProperty(Actor::Property::ANCHOR_POINT, AnchorPoint::TOP_LEFT);
     window.Add(mParent);
 
+    mFrameStats = std::make_unique<DemoHelper::FrameStats>();
+    DevelStage::AddFrameCallback(Stage::GetCurrent(), *mFrameStats, window.GetRootLayer());
+
+    const unsigned int totalColumns = mColumnsPerPage * mPageCount;
+    if(gVirtualize)
+    {
+      // Partially visible column on top of the page, then the margin on either side
+      mWindowColumns = std::min(totalColumns, mColumnsPerPage + 1u + 2u * gMarginColumns);
+    }
+    else
+    {
+      mWindowColumns = totalColumns;
+    }
+
     if(gUseMesh)
     {
-      CreateMeshActors();
+      CreateMeshActors(mWindowColumns * mRowsPerPage);
+    }
+    else
+    {
+      CreateImageViews(mWindowColumns * mRowsPerPage);
+    }
+
+    if(gVirtualize)
+    {
+      mSlotColumn.assign(mWindowColumns, totalColumns);
+      UpdateWindow(0.0f);
+
+      // Recycle the columns which scrolled out every time the parent moves by a column
+      PropertyNotification notification = mParent.AddPropertyNotification(Actor::Property::POSITION_X, StepCondition(mSize.x, 0.0f));
+      notification.NotifySignal().Connect(this, &PerfScroll::OnScrolled);
     }
     else
     {
-      CreateImageViews();
+      PositionActors();
     }
 
-    PositionActors();
     ScrollAnimation();
   }
 
@@ -243,49 +299,103 @@ public:
     return !gUseNinePatch ? IMAGE_PATH[i % NUM_IMAGES] : NINEPATCH_IMAGE_PATH[i % NUM_NINEPATCH_IMAGES];
   }
 
-  void CreateImageViews()
+  void SetImage(Actor& actor, int i)
+  {
+    if(gUseMesh)
+    {
+      if(actor.GetRendererCount())
+      {
+        actor.RemoveRenderer(0u);
+      }
+      actor.AddRenderer(mRenderers[i % mRenderers.size()]);
+    }
+    else
+    {
+      Property::Map propertyMap;
+      propertyMap.Insert(Toolkit::ImageVisual::Property::URL, ImagePath(i));
+      propertyMap.Insert(Toolkit::Visual::Property::TYPE, Toolkit::Visual::IMAGE);
+      actor.SetProperty(Toolkit::ImageView::Property::IMAGE, propertyMap);
+    }
+  }
+
+  void CreateImageViews(unsigned int actorCount)
   {
-    Window       window = mApplication.GetWindow();
-    unsigned int actorCount(mRowsPerPage * mColumnsPerPage * mPageCount);
     mActor.resize(actorCount);
 
     for(size_t i(0); i < actorCount; ++i)
     {
       mActor[i] = ImageView::New();
-      Property::Map propertyMap;
-      propertyMap.Insert(Toolkit::ImageVisual::Property::URL, ImagePath(i));
-      propertyMap.Insert(Toolkit::Visual::Property::TYPE, Toolkit::Visual::IMAGE);
-      mActor[i].SetProperty(Toolkit::ImageView::Property::IMAGE, propertyMap);
+      SetImage(mActor[i], i);
       mActor[i].SetResizePolicy(ResizePolicy::FIXED, Dimension::ALL_DIMENSIONS);
       mParent.Add(mActor[i]);
     }
   }
 
-  void CreateMeshActors()
+  void CreateMeshActors(unsigned int actorCount)
   {
     unsigned int numImages = !gUseNinePatch ? NUM_IMAGES : NUM_NINEPATCH_IMAGES;
 
     //Create all the renderers
-    std::vector<Renderer> renderers(numImages);
-    Shader                shader   = Shader::New(SHADER_PERF_SCROLL_VERT, SHADER_PERF_SCROLL_FRAG);
-    Geometry              geometry = DemoHelper::CreateTexturedQuad();
+    mRenderers.resize(numImages);
+    Shader   shader   = Shader::New(SHADER_PERF_SCROLL_VERT, SHADER_PERF_SCROLL_FRAG);
+    Geometry geometry = DemoHelper::CreateTexturedQuad();
     for(unsigned int i(0); i < numImages; ++i)
     {
-      renderers[i] = CreateRenderer(i, geometry, shader);
+      mRenderers[i] = CreateRenderer(i, geometry, shader);
     }
 
     //Create the actors
-    Window       window = mApplication.GetWindow();
-    unsigned int actorCount(mRowsPerPage * mColumnsPerPage * mPageCount);
     mActor.resize(actorCount);
     for(size_t i(0); i < actorCount; ++i)
     {
       mActor[i] = Actor::New();
-      mActor[i].AddRenderer(renderers[i % numImages]);
+      SetImage(mActor[i], i);
       mParent.Add(mActor[i]);
     }
   }
 
+  /**
+   * Moves the actors of a slot of the virtualized window to the given column,
+   * so they show the same images as the actors of that column in the eager mode
+   */
+  void AssignColumn(unsigned int slot, unsigned int column)
+  {
+    for(size_t j(0); j < mRowsPerPage; ++j)
+    {
+      Actor& actor = mActor[slot * mRowsPerPage + j];
+      actor.SetProperty(Actor::Property::POSITION, Vector3(mSize.x * column + mSize.x * 0.5f, mSize.y * j + mSize.y * 0.5f, 0.0f));
+      actor.SetProperty(Actor::Property::SIZE, mSize);
+      SetImage(actor, column * mRowsPerPage + j);
+    }
+    mSlotColumn[slot] = column;
+    ++mLoadedColumns;
+  }
+
+  /**
+   * Makes sure the columns around the visible page are materialised for the given scroll position.
+   * Each column always uses the slot (column % window size) so only columns which scrolled out are reused.
+   */
+  void UpdateWindow(float scrollX)
+  {
+    const int totalColumns = mColumnsPerPage * mPageCount;
+    int       firstColumn  = int(std::floor(-scrollX / mSize.x)) - int(gMarginColumns);
+    firstColumn            = std::max(0, std::min(firstColumn, totalColumns - int(mWindowColumns)));
+
+    for(unsigned int column = firstColumn; column < firstColumn + mWindowColumns; ++column)
+    {
+      const unsigned int slot = column % mWindowColumns;
+      if(mSlotColumn[slot] != column)
+      {
+        AssignColumn(slot, column);
+      }
+    }
+  }
+
+  void OnScrolled(PropertyNotification& source)
+  {
+    UpdateWindow(mParent.GetCurrentProperty<float>(Actor::Property::POSITION_X));
+  }
+
   void PositionActors()
   {
     Window  window = mApplication.GetWindow();
@@ -319,7 +429,25 @@ public:
     Animation scrollAnimation = Animation::New(gScrollDuration);
     scrollAnimation.AnimateBy(Property(mParent, Actor::Property::POSITION), Vector3(-(PAGE_COUNT - 1.) * windowSize.x, 0.0f, 0.0f));
     scrollAnimation.Play();
-    scrollAnimation.FinishedSignal().Connect(this, [&](Animation&) { mApplication.Quit(); });
+    scrollAnimation.FinishedSignal().Connect(this, [&](Animation&) {
+      PrintStats();
+      mApplication.Quit();
+    });
+  }
+
+  void PrintStats()
+  {
+    cout << "perf-scroll: " << (gVirtualize ? "virtualized" : "eager") << (gUseMesh ? " mesh actors" : " image views") << endl;
+    cout << "  Actors:          " << mActor.size() << endl;
+    if(gVirtualize)
+    {
+      cout << "  Columns loaded:  " << mLoadedColumns << endl;
+    }
+    const DemoHelper::FrameStats::Sample stats = mFrameStats->Get();
+    cout << "  Frames:          " << stats.frames << endl;
+    cout << "  Frame time:      " << stats.GetAverageFrameMs() << "ms average, " << stats.GetMaxFrameMs() << "ms max" << endl;
+    cout << "  Update thread:   " << stats.GetAverageUpdateMs() << "ms per frame" << endl;
+    cout << "  Peak memory:     " << GetPeakMemoryKb() << "kB" << endl;
   }
 
   void OnKeyEvent(const KeyEvent& event)
@@ -336,14 +464,20 @@ public:
 private:
   Application& mApplication;
 
-  std::vector<Actor> mActor;
-  Actor              mParent;
+  std::vector<Actor>    mActor;
+  std::vector<Renderer> mRenderers;
+  Actor                 mParent;
+
+  std::vector<unsigned int>   mSlotColumn;        ///< Column shown by each slot of the virtualized window
+  unsigned int                mLoadedColumns{0u}; ///< Number of columns assigned to a slot, including the initial ones
+  std::unique_ptr<DemoHelper::FrameStats> mFrameStats;
 
   Vector3 mSize;
 
   const unsigned int mRowsPerPage;
   const unsigned int mColumnsPerPage;
   const unsigned int mPageCount;
+  unsigned int       mWindowColumns; ///< Number of columns materialised
 };
 
 int DALI_EXPORT_API main(int argc, char** argv)
@@ -359,6 +493,18 @@ int DALI_EXPORT_API main(int argc, char** argv)
     {
       gUseNinePatch = true;
     }
+    else if(arg.compare("--virtualize") == 0)
+    {
+      gVirtualize = true;
+    }
+    else if(arg.compare(0, 2, "-m") == 0)
+    {
+      auto newMargin = atoi(arg.substr(2, arg.size()).c_str());
+      if(newMargin >= 0)
+      {
+        gMarginColumns = newMargin;
+      }
+    }
     else if(arg.compare(0, 2, "-t") == 0)
     {
       auto newDuration = atof(arg.substr(2, arg.size()).c_str());
@@ -373,6 +519,8 @@ int DALI_EXPORT_API main(int argc, char** argv)
       cout << "  Options:" << endl;
       cout << "    --use-mesh    Uses the Rendering API directly to create actors" << endl;
       cout << "    --nine-patch  Uses n-patch images instead" << endl;
+      cout << "    --virtualize  Only creates actors for the visible page and a margin, recycling them while scrolling" << endl;
+      cout << "    -m[columns]   Replace [columns] with the margin on either side of the visible page, i.e. -m4. Default is 2." << endl;
       cout << "    -t[seconds]   Replace [seconds] with the animation time required, i.e. -t4. Default is 10s." << endl;
       cout << "    -h|--help     Help" << endl;
       return 0;
@@ -21,8 +21,13 @@
 // EXTERNAL INCLUDES
 #include <dali/devel-api/adaptor-framework/file-stream.h>
 
+// INTERNAL INCLUDES
+#include "shared/json-reader.h"
+
 namespace
 {
+using DemoHelper::JsonReader;
+
 // string contains enum type index encoded matching glTFAttributeType
 const std::vector<std::string> GLTF_STR_ATTRIBUTE_TYPE = {
   "POSITION",
@@ -63,83 +68,74 @@ uint32_t glTFComponentTypeStrToNum(const std::string& name)
   return iter->second;
 }
 
-template<class T>
-struct JsonResult
+/**
+ * Calls function() for each element of the array which is the next value
+ */
+template<class Function>
+bool ForEachElement(JsonReader& reader, Function&& function)
 {
-  bool success;
-  T    result;
-
-  operator T() const
+  if(!reader.BeginArray())
   {
-    return static_cast<T>(result);
+    return false;
   }
-};
-
-template<>
-struct JsonResult<bool>
-{
-  bool success;
-  bool result;
-
-  operator bool() const
+  while(reader.NextElement())
   {
-    return result;
+    if(!function())
+    {
+      return false;
+    }
   }
-};
+  return !reader.HasError();
+}
 
-template<class Expected, class Converted = Expected>
-JsonResult<picojson::value> JsonFindValue(const picojson::object& object, const std::string& name)
+/**
+ * Calls function(key) for each member of the object which is the next value
+ */
+template<class Function>
+bool ForEachMember(JsonReader& reader, Function&& function)
 {
-  auto iter = find_if(object.begin(), object.end(), [name](decltype(*object.begin())& item) {
-    return item.first == name;
-  });
-
-  if(iter == object.end())
+  std::string_view key;
+  if(!reader.BeginObject())
   {
-    return {false};
+    return false;
   }
-
-  return {true, iter->second};
-};
-
-template<class Expected, class Converted = Expected>
-JsonResult<Converted> JsonGetValue(const picojson::value& val, const std::string& name, const Converted& onFail)
-{
-  if(val.contains(name))
+  while(reader.NextMember(key))
   {
-    return {true, static_cast<Converted>(val.get(name).get<Expected>())};
+    if(!function(key))
+    {
+      return false;
+    }
   }
-  return {false, onFail};
+  return !reader.HasError();
 }
 
-template<class Expected, class Converted = Expected>
-bool JsonGetValueOut(const picojson::value& val, const std::string& name, Converted& writeOut)
+/**
+ * Reads an array of numbers
+ */
+template<class T>
+bool ReadArray(JsonReader& reader, std::vector<T>& values)
 {
-  if(val.contains(name))
-  {
-    writeOut = static_cast<Converted>(val.get(name).get<Expected>());
+  values.clear();
+  return ForEachElement(reader, [&reader, &values]() {
+    T value;
+    if(!reader.ReadNumber(value))
+    {
+      return false;
+    }
+    values.emplace_back(value);
     return true;
-  }
-  return false;
+  });
 }
 
 /**
- * Safe json value accessor
+ * Reads an array of numbers into a fixed size array, ignoring any extra ones
  */
-template<class Expected, class Converted = Expected>
-JsonResult<std::vector<Converted>> JsonGetArray(const picojson::value& val, const std::string& name, std::vector<Converted> valueOnFail = {})
+bool ReadArray(JsonReader& reader, float* values, size_t count)
 {
-  if(val.contains(name))
-  {
-    const auto&            array = val.get(name).get<picojson::array>();
-    std::vector<Converted> result{};
-    for(const auto& item : array)
-    {
-      result.emplace_back(static_cast<Converted>(item.get<Expected>()));
-    }
-    return {true, result};
-  }
-  return {false, valueOnFail};
+  size_t index = 0u;
+  return ForEachElement(reader, [&reader, values, count, &index]() {
+    return index < count ? reader.ReadNumber(values[index++]) : reader.Skip();
+  });
 }
 
 } // namespace
@@ -163,8 +159,6 @@ void glTF::LoadFromFile(const std::string& filename)
   mBuffer    = LoadFile(binFile);
   jsonBuffer = LoadFile(jsonFile);
 
-  jsonBuffer.push_back('\0'); // It should be null terminated.
-
   // Log errors
   if(mBuffer.empty())
   {
@@ -179,24 +173,6 @@ void glTF::LoadFromFile(const std::string& filename)
     GLTF_LOG("Error, buffer GLTF empty!");
   }
   else
-  {
-    GLTF_LOG("GLTF: %s loaded, size = %d", binFile.c_str(), int(jsonBuffer.size()));
-  }
-
-  // Abort if errors
-  if(jsonBuffer.empty() || mBuffer.empty())
-  {
-    return;
-  }
-
-  // parse json
-  auto err = picojson::parse(jsonNode, std::string(reinterpret_cast<char*>(jsonBuffer.data())));
-  if(!err.empty())
-  {
-    GLTF_LOG("GLTF: Error parsing %s, error: %s", jsonFile.c_str(), err.c_str());
-    return;
-  }
-  else
   {
     GLTF_LOG("GLTF: %s loaded, size = %d", jsonFile.c_str(), int(jsonBuffer.size()));
   }
@@ -204,11 +180,14 @@ void glTF::LoadFromFile(const std::string& filename)
 
 bool glTF::ParseJSON()
 {
-  if(!jsonNode.is<picojson::object>())
+  if(jsonBuffer.empty() || mBuffer.empty())
   {
     return false;
   }
 
+  // Read straight from the file buffer, without building a document first
+  JsonReader reader(reinterpret_cast<const char*>(jsonBuffer.data()), jsonBuffer.size());
+
   // Add dummy first node to nodes (scene node)
   mNodes.emplace_back();
 
@@ -216,184 +195,312 @@ bool glTF::ParseJSON()
   std::vector<uint32_t>     textureSources{};
   std::vector<glTF_Texture> images{};
 
-  for(auto& val : jsonNode.get<picojson::object>())
-  {
-    GLTF_LOG("node: %s", val.first.c_str());
+  ForEachMember(reader, [&](std::string_view key) {
+    GLTF_LOG("node: %.*s", int(key.size()), key.data());
 
     // Parse bufferviews
-    if(val.first == "bufferViews")
+    if(key == "bufferViews")
     {
-      auto bufferViews = val.second;
-      for(auto& view : bufferViews.get<picojson::array>())
-      {
-        auto bufferIndex = uint32_t(view.get("buffer").get<double>());
-        auto byteLength  = uint32_t(view.get("byteLength").get<double>());
-        auto byteOffset  = uint32_t(view.get("byteOffset").get<double>());
-
+      return ForEachElement(reader, [&]() {
         glTF_BufferView bufferView{};
-        bufferView.bufferIndex = bufferIndex;
-        bufferView.byteLength  = byteLength;
-        bufferView.byteOffset  = byteOffset;
-
+        bool            success = ForEachMember(reader, [&](std::string_view key) {
+          if(key == "buffer")
+          {
+            return reader.ReadNumber(bufferView.bufferIndex);
+          }
+          else if(key == "byteLength")
+          {
+            return reader.ReadNumber(bufferView.byteLength);
+          }
+          else if(key == "byteOffset")
+          {
+            return reader.ReadNumber(bufferView.byteOffset);
+          }
+          return reader.Skip();
+        });
         mBufferViews.emplace_back(bufferView);
-      }
+        return success;
+      });
     }
 
     // parse accessors
-    else if(val.first == "accessors")
+    else if(key == "accessors")
     {
-      for(const auto& accessor : val.second.get<picojson::array>())
-      {
-        auto gltfAccessor          = glTF_Accessor{};
-        gltfAccessor.bufferView    = uint32_t(accessor.get("bufferView").get<double>());
-        gltfAccessor.componentType = uint32_t(accessor.get("componentType").get<double>());
-        gltfAccessor.count         = uint32_t(accessor.get("count").get<double>());
-        gltfAccessor.type          = accessor.get("type").get<std::string>();
+      return ForEachElement(reader, [&]() {
+        auto gltfAccessor = glTF_Accessor{};
+        bool success      = ForEachMember(reader, [&](std::string_view key) {
+          if(key == "bufferView")
+          {
+            return reader.ReadNumber(gltfAccessor.bufferView);
+          }
+          else if(key == "componentType")
+          {
+            return reader.ReadNumber(gltfAccessor.componentType);
+          }
+          else if(key == "count")
+          {
+            return reader.ReadNumber(gltfAccessor.count);
+          }
+          else if(key == "type")
+          {
+            return reader.ReadString(gltfAccessor.type);
+          }
+          return reader.Skip();
+        });
         gltfAccessor.componentSize = glTFComponentTypeStrToNum(gltfAccessor.type);
         mAccessors.emplace_back(gltfAccessor);
-      }
+        return success;
+      });
     }
 
     // parse meshes
-    else if(val.first == "meshes")
+    else if(key == "meshes")
     {
-      for(const auto& mesh : val.second.get<picojson::array>())
-      {
+      return ForEachElement(reader, [&]() {
         glTF_Mesh gltfMesh{};
-        gltfMesh.name = mesh.get("name").get<std::string>();
-
-        // get primitives (in this implementation assuming single mesh consists of
-        // one and only one primitive)
-        const auto& primitive = mesh.get("primitives").get<picojson::array>()[0];
-        const auto& attrs     = primitive.get("attributes").get<picojson::object>();
-        for(const auto& attr : attrs)
-        {
-          auto type    = glTFAttributeTypeStrToEnum(attr.first);
-          auto bvIndex = uint32_t(attr.second.get<double>());
-          gltfMesh.attributes.emplace_back(std::make_pair(type, bvIndex));
-          GLTF_LOG("GLTF: ATTR: type: %d, index: %d", int(type), int(bvIndex));
-        }
-
-        gltfMesh.indices  = uint32_t(primitive.get("indices").get<double>());
-        gltfMesh.material = uint32_t(primitive.get("material").get<double>());
+        bool      success = ForEachMember(reader, [&](std::string_view key) {
+          if(key == "name")
+          {
+            return reader.ReadString(gltfMesh.name);
+          }
+          else if(key == "primitives")
+          {
+            // get primitives (in this implementation assuming single mesh consists of
+            // one and only one primitive)
+            auto primitiveIndex = 0u;
+            return ForEachElement(reader, [&]() {
+              if(primitiveIndex++ > 0u)
+              {
+                return reader.Skip();
+              }
+              return ForEachMember(reader, [&](std::string_view key) {
+                if(key == "attributes")
+                {
+                  return ForEachMember(reader, [&](std::string_view key) {
+                    auto type    = glTFAttributeTypeStrToEnum(std::string(key));
+                    auto bvIndex = 0u;
+                    if(!reader.ReadNumber(bvIndex))
+                    {
+                      return false;
+                    }
+                    gltfMesh.attributes.emplace_back(std::make_pair(type, bvIndex));
+                    GLTF_LOG("GLTF: ATTR: type: %d, index: %d", int(type), int(bvIndex));
+                    return true;
+                  });
+                }
+                else if(key == "indices")
+                {
+                  return reader.ReadNumber(gltfMesh.indices);
+                }
+                else if(key == "material")
+                {
+                  return reader.ReadNumber(gltfMesh.material);
+                }
+                return reader.Skip();
+              });
+            });
+          }
+          return reader.Skip();
+        });
         mMeshes.emplace_back(gltfMesh);
-      }
+        return success;
+      });
     }
     // parse cameras
-    else if(val.first == "cameras")
+    else if(key == "cameras")
     {
-      glTF_Camera tgifCamera{};
-      for(const auto& camera : val.second.get<picojson::array>())
-      {
-        tgifCamera.name          = camera.get("name").to_str();
-        tgifCamera.isPerspective = (camera.get("type").to_str() == "perspective");
-        if(tgifCamera.isPerspective)
-        {
-          const auto& perspective = camera.get("perspective");
-          tgifCamera.yfov         = static_cast<float>(perspective.get("yfov").get<double>());
-          tgifCamera.zfar         = static_cast<float>(perspective.get("zfar").get<double>());
-          tgifCamera.znear        = static_cast<float>(perspective.get("znear").get<double>());
-        }
-
+      return ForEachElement(reader, [&]() {
+        glTF_Camera tgifCamera{};
+        bool        success = ForEachMember(reader, [&](std::string_view key) {
+          if(key == "name")
+          {
+            return reader.ReadString(tgifCamera.name);
+          }
+          else if(key == "type")
+          {
+            std::string_view type;
+            if(!reader.ReadString(type))
+            {
+              return false;
+            }
+            tgifCamera.isPerspective = (type == "perspective");
+            return true;
+          }
+          else if(key == "perspective")
+          {
+            return ForEachMember(reader, [&](std::string_view key) {
+              if(key == "yfov")
+              {
+                return reader.ReadNumber(tgifCamera.yfov);
+              }
+              else if(key == "zfar")
+              {
+                return reader.ReadNumber(tgifCamera.zfar);
+              }
+              else if(key == "znear")
+              {
+                return reader.ReadNumber(tgifCamera.znear);
+              }
+              return reader.Skip();
+            });
+          }
+          return reader.Skip();
+        });
         mCameras.emplace_back(tgifCamera);
-      }
+        return success;
+      });
     }
     // parse nodes
-    else if(val.first == "nodes")
+    else if(key == "nodes")
     {
       auto nodeIndex = 1u;
-      for(const auto& node : val.second.get<picojson::array>())
-      {
+      return ForEachElement(reader, [&]() {
         glTF_Node gltfNode{};
-        gltfNode.name    = node.get("name").to_str();
-        auto rotation    = JsonGetArray<double, float>(node, "rotation", {0.0f, 0.0f, 0.0f, 1.0f});
-        auto translation = JsonGetArray<double, float>(node, "translation", {0.0f, 0.0f, 0.0f});
-        auto scale       = JsonGetArray<double, float>(node, "scale", {1.0f, 1.0f, 1.0f});
-        std::copy(rotation.result.begin(), rotation.result.end(), gltfNode.rotationQuaternion);
-        std::copy(translation.result.begin(), translation.result.end(), gltfNode.translation);
-        std::copy(scale.result.begin(), scale.result.end(), gltfNode.scale);
-
-        auto children = JsonGetArray<double, uint32_t>(node, "children");
-        if(children.success)
-        {
-          gltfNode.children = std::move(children.result);
-        }
-        gltfNode.index    = nodeIndex;
-        gltfNode.cameraId = 0xffffffff;
-        gltfNode.meshId   = 0xffffffff;
-
-        auto cameraId = JsonGetValue<double, uint32_t>(node, "camera", 0xffffffff);
-        if(cameraId.success)
-        {
-          gltfNode.cameraId = cameraId.result;
-        }
-        auto meshId = JsonGetValue<double, uint32_t>(node, "mesh", 0xffffffff);
-        if(meshId.success)
-        {
-          gltfNode.meshId = meshId.result;
-        }
+        gltfNode.index = nodeIndex++;
+        bool success   = ForEachMember(reader, [&](std::string_view key) {
+          if(key == "name")
+          {
+            return reader.ReadString(gltfNode.name);
+          }
+          else if(key == "rotation")
+          {
+            return ReadArray(reader, gltfNode.rotationQuaternion, 4u);
+          }
+          else if(key == "translation")
+          {
+            return ReadArray(reader, gltfNode.translation, 3u);
+          }
+          else if(key == "scale")
+          {
+            return ReadArray(reader, gltfNode.scale, 3u);
+          }
+          else if(key == "children")
+          {
+            return ReadArray(reader, gltfNode.children);
+          }
+          else if(key == "camera")
+          {
+            return reader.ReadNumber(gltfNode.cameraId);
+          }
+          else if(key == "mesh")
+          {
+            return reader.ReadNumber(gltfNode.meshId);
+          }
+          return reader.Skip();
+        });
         mNodes.emplace_back(gltfNode);
-        ++nodeIndex;
-      }
+        return success;
+      });
     }
     // parse scenes, note: only first scene is being parsed
-    else if(val.first == "scenes")
+    else if(key == "scenes")
     {
-      auto&       sceneNode = mNodes[0];
-      const auto& scene     = val.second.get<picojson::array>()[0];
-      sceneNode.name        = JsonGetValue<std::string>(scene, "name", std::string());
-      auto result           = JsonGetArray<double, uint32_t>(scene, "nodes");
-      sceneNode.children    = result.result;
-      sceneNode.index       = 0;
+      auto sceneIndex = 0u;
+      return ForEachElement(reader, [&]() {
+        if(sceneIndex++ > 0u)
+        {
+          return reader.Skip();
+        }
+        auto& sceneNode = mNodes[0];
+        sceneNode.index = 0;
+        return ForEachMember(reader, [&](std::string_view key) {
+          if(key == "name")
+          {
+            return reader.ReadString(sceneNode.name);
+          }
+          else if(key == "nodes")
+          {
+            return ReadArray(reader, sceneNode.children);
+          }
+          return reader.Skip();
+        });
+      });
     }
-    else if(val.first == "materials")
+    else if(key == "materials")
     {
-      for(const auto& node : val.second.get<picojson::array>())
-      {
+      return ForEachElement(reader, [&]() {
         // Get pbr material, base color texture
         glTF_Material material{};
-        material.doubleSided = JsonGetValue<bool>(node, "doubleSided", false).result;
-        material.name        = JsonGetValue<std::string>(node, "name", std::string()).result;
-        if(node.contains("pbrMetallicRoughness"))
-        {
-          const auto& node0 = node.get("pbrMetallicRoughness");
-          if(node0.contains("baseColorTexture"))
+        bool          success = ForEachMember(reader, [&](std::string_view key) {
+          if(key == "doubleSided")
           {
-            const auto& node1                                       = node0.get("baseColorTexture");
-            auto        index                                       = uint32_t(node1.get("index").get<double>());
-            auto        texCoord                                    = uint32_t(node1.get("texCoord").get<double>());
-            material.pbrMetallicRoughness.enabled                   = true;
-            material.pbrMetallicRoughness.baseTextureColor.index    = index;
-            material.pbrMetallicRoughness.baseTextureColor.texCoord = texCoord;
+            return reader.ReadBool(material.doubleSided);
           }
-        }
+          else if(key == "name")
+          {
+            return reader.ReadString(material.name);
+          }
+          else if(key == "pbrMetallicRoughness")
+          {
+            return ForEachMember(reader, [&](std::string_view key) {
+              if(key == "baseColorTexture")
+              {
+                auto& baseTextureColor                = material.pbrMetallicRoughness.baseTextureColor;
+                material.pbrMetallicRoughness.enabled = true;
+                return ForEachMember(reader, [&](std::string_view key) {
+                  if(key == "index")
+                  {
+                    return reader.ReadNumber(baseTextureColor.index);
+                  }
+                  else if(key == "texCoord")
+                  {
+                    return reader.ReadNumber(baseTextureColor.texCoord);
+                  }
+                  return reader.Skip();
+                });
+              }
+              return reader.Skip();
+            });
+          }
+          return reader.Skip();
+        });
         mMaterials.emplace_back(material);
-      }
+        return success;
+      });
     }
-    else if(val.first == "textures")
+    else if(key == "textures")
     {
-      for(const auto& item : val.second.get<picojson::array>())
-      {
-        auto source = JsonGetValue<double, uint32_t>(item, "source", 0xffffffff);
-        textureSources.emplace_back(source.result);
-      }
+      return ForEachElement(reader, [&]() {
+        auto source  = 0xffffffffu;
+        bool success = ForEachMember(reader, [&](std::string_view key) {
+          return key == "source" ? reader.ReadNumber(source) : reader.Skip();
+        });
+        textureSources.emplace_back(source);
+        return success;
+      });
     }
-    else if(val.first == "images")
+    else if(key == "images")
     {
-      for(const auto& item : val.second.get<picojson::array>())
-      {
+      return ForEachElement(reader, [&]() {
         glTF_Texture tex{};
-        JsonGetValueOut<std::string>(item, "name", tex.name);
-        JsonGetValueOut<std::string>(item, "uri", tex.uri);
+        bool         success = ForEachMember(reader, [&](std::string_view key) {
+          if(key == "name")
+          {
+            return reader.ReadString(tex.name);
+          }
+          else if(key == "uri")
+          {
+            return reader.ReadString(tex.uri);
+          }
+          return reader.Skip();
+        });
         images.emplace_back(tex);
-      }
+        return success;
+      });
     }
+    return reader.Skip();
+  });
+
+  if(!reader.Finish())
+  {
+    GLTF_LOG("GLTF: Error parsing JSON at offset %d, error: %s", int(reader.GetErrorOffset()), reader.GetError());
+    return false;
   }
 
   // Resolve cross-referencing
   for(const auto& source : textureSources)
   {
-    mTextures.emplace_back(images[source]);
+    mTextures.emplace_back(source < images.size() ? images[source] : glTF_Texture{});
   }
 
   return true;
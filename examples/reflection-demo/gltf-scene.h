@@ -21,9 +21,7 @@
 // EXTERNAL INCLUDES
 #include <dali/integration-api/debug.h>
 #include <string>
-
-// INTERNAL INCLUDES
-#include "third-party/pico-json.h"
+#include <vector>
 
 #define GLTF_LOG(...)                                                              \
   {                                                                                \
@@ -171,9 +169,6 @@ private:
   std::vector<glTF_Texture>    mTextures;
   glTF_Buffer                  mBuffer;
   glTF_Buffer                  jsonBuffer;
-
-  // json nodes
-  picojson::value jsonNode;
 };
 
 #endif //DALI_CMAKE_GLTF_SCENE_H
@@ -0,0 +1,296 @@
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include "local-image-server.h"
+
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <poll.h>
+#include <sys/socket.h>
+#include <sys/time.h>
+#include <unistd.h>
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <fstream>
+#include <functional>
+#include <iterator>
+#include <random>
+
+namespace
+{
+constexpr int    ACCEPT_POLL_MS     = 100;  ///< How often the accept thread checks whether it should stop
+constexpr int    RECEIVE_TIMEOUT_MS = 2000; ///< Longest wait for a request, so that a silent client can't block Stop()
+constexpr size_t CHUNK_SIZE         = 4096; ///< Granularity of the bandwidth throttling
+constexpr size_t MAX_REQUEST        = 4096;
+
+const char* const NOT_FOUND   = "HTTP/1.0 404 Not Found\r\nContent-Length: 0\r\nConnection: close\r\n\r\n";
+const char* const UNAVAILABLE = "HTTP/1.0 503 Service Unavailable\r\nContent-Length: 0\r\nConnection: close\r\n\r\n";
+const char* const BAD_REQUEST = "HTTP/1.0 400 Bad Request\r\nContent-Length: 0\r\nConnection: close\r\n\r\n";
+
+/**
+ * @return The path of the request line, without the query and the leading slash, or an empty string
+ */
+std::string GetRequestedFile(const std::string& request)
+{
+  if(request.compare(0, 5, "GET /") != 0)
+  {
+    return std::string();
+  }
+
+  const size_t start = 5u;
+  const size_t end   = request.find_first_of(" ?\r\n", start);
+  if(end == std::string::npos)
+  {
+    return std::string();
+  }
+
+  std::string file = request.substr(start, end - start);
+  if(file.find("..") != std::string::npos)
+  {
+    return std::string(); // Stay in the root directory
+  }
+  return file;
+}
+
+const char* GetContentType(const std::string& file)
+{
+  const size_t dot = file.rfind('.');
+  if(dot != std::string::npos)
+  {
+    const std::string extension = file.substr(dot + 1u);
+    if(extension == "png")
+    {
+      return "image/png";
+    }
+    if(extension == "gif")
+    {
+      return "image/gif";
+    }
+    if(extension == "webp")
+    {
+      return "image/webp";
+    }
+  }
+  return "image/jpeg";
+}
+
+} // namespace
+
+LocalImageServer::LocalImageServer(const std::string& rootDirectory, const Options& options)
+: mRootDirectory(rootDirectory),
+  mOptions(options)
+{
+}
+
+LocalImageServer::~LocalImageServer()
+{
+  Stop();
+}
+
+bool LocalImageServer::Start()
+{
+  if(mRunning)
+  {
+    return true;
+  }
+
+  mListenSocket = socket(AF_INET, SOCK_STREAM, 0);
+  if(mListenSocket < 0)
+  {
+    return false;
+  }
+
+  sockaddr_in address{};
+  address.sin_family      = AF_INET;
+  address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+  address.sin_port        = 0; // Any free port
+
+  socklen_t length = sizeof(address);
+  if(bind(mListenSocket, reinterpret_cast<sockaddr*>(&address), sizeof(address)) != 0 ||
+     listen(mListenSocket, SOMAXCONN) != 0 ||
+     getsockname(mListenSocket, reinterpret_cast<sockaddr*>(&address), &length) != 0)
+  {
+    close(mListenSocket);
+    mListenSocket = -1;
+    return false;
+  }
+  mPort = ntohs(address.sin_port);
+
+  mRunning      = true;
+  mAcceptThread = std::thread(&LocalImageServer::AcceptLoop, this);
+  return true;
+}
+
+void LocalImageServer::Stop()
+{
+  if(!mRunning)
+  {
+    return;
+  }
+
+  mRunning = false;
+  mAcceptThread.join();
+  for(auto& connection : mConnections)
+  {
+    connection.thread.join();
+  }
+  mConnections.clear();
+
+  close(mListenSocket);
+  mListenSocket = -1;
+}
+
+std::string LocalImageServer::GetUrl(const std::string& fileName) const
+{
+  return "http://127.0.0.1:" + std::to_string(mPort) + "/" + fileName;
+}
+
+void LocalImageServer::ResetCounters()
+{
+  mPeakActiveRequests = mActiveRequests.load();
+  mRequestCount       = 0u;
+  mFailureCount       = 0u;
+}
+
+void LocalImageServer::AcceptLoop()
+{
+  pollfd listener{mListenSocket, POLLIN, 0};
+  while(mRunning)
+  {
+    // Join the threads of the requests already served, so that they don't pile up over the runs
+    for(auto iter = mConnections.begin(); iter != mConnections.end();)
+    {
+      if(iter->finished)
+      {
+        iter->thread.join();
+        iter = mConnections.erase(iter);
+      }
+      else
+      {
+        ++iter;
+      }
+    }
+
+    if(poll(&listener, 1, ACCEPT_POLL_MS) <= 0)
+    {
+      continue;
+    }
+
+    const int connection = accept(mListenSocket, nullptr, nullptr);
+    if(connection >= 0)
+    {
+      const timeval timeout{RECEIVE_TIMEOUT_MS / 1000, (RECEIVE_TIMEOUT_MS % 1000) * 1000};
+      setsockopt(connection, SOL_SOCKET, SO_RCVTIMEO, &timeout, sizeof(timeout));
+
+      mConnections.emplace_back();
+      Connection& served = mConnections.back();
+      served.thread      = std::thread(&LocalImageServer::Serve, this, connection, std::ref(served.finished));
+    }
+  }
+}
+
+void LocalImageServer::Serve(int connection, std::atomic<bool>& finished)
+{
+  const uint32_t active = ++mActiveRequests;
+  uint32_t       peak   = mPeakActiveRequests;
+  while(active > peak && !mPeakActiveRequests.compare_exchange_weak(peak, active))
+  {
+  }
+  ++mRequestCount;
+
+  // Read the request line and headers; the body of a GET is empty.
+  std::string request;
+  char        buffer[512];
+  while(request.find("\r\n\r\n") == std::string::npos && request.size() < MAX_REQUEST)
+  {
+    const ssize_t received = recv(connection, buffer, sizeof(buffer), 0);
+    if(received <= 0)
+    {
+      break;
+    }
+    request.append(buffer, received);
+  }
+
+  if(mOptions.latencyMs > 0u)
+  {
+    std::this_thread::sleep_for(std::chrono::milliseconds(mOptions.latencyMs));
+  }
+
+  // Seeded with the request line, so that runs with the same options fail the same URLs
+  // whatever the order in which the concurrent requests arrive.
+  std::minstd_rand random(std::hash<std::string>()(request.substr(0u, request.find("\r\n"))));
+  const std::string file = GetRequestedFile(request);
+  if(file.empty())
+  {
+    Send(connection, BAD_REQUEST, strlen(BAD_REQUEST));
+  }
+  else if(mOptions.failurePercent > 0u && random() % 100u < mOptions.failurePercent)
+  {
+    ++mFailureCount;
+    Send(connection, UNAVAILABLE, strlen(UNAVAILABLE));
+  }
+  else
+  {
+    std::ifstream stream(mRootDirectory + file, std::ios::binary);
+    if(!stream)
+    {
+      ++mFailureCount;
+      Send(connection, NOT_FOUND, strlen(NOT_FOUND));
+    }
+    else
+    {
+      const std::vector<char> content((std::istreambuf_iterator<char>(stream)), std::istreambuf_iterator<char>());
+
+      const std::string header = "HTTP/1.0 200 OK\r\nContent-Type: " + std::string(GetContentType(file)) +
+                                 "\r\nContent-Length: " + std::to_string(content.size()) +
+                                 "\r\nConnection: close\r\n\r\n";
+      if(Send(connection, header.data(), header.size()))
+      {
+        Send(connection, content.data(), content.size());
+      }
+    }
+  }
+
+  shutdown(connection, SHUT_WR);
+  close(connection);
+  --mActiveRequests;
+  finished = true;
+}
+
+bool LocalImageServer::Send(int connection, const char* data, size_t size)
+{
+  const auto start = std::chrono::steady_clock::now();
+  size_t     sent  = 0u;
+  while(sent < size && mRunning)
+  {
+    const ssize_t result = send(connection, data + sent, std::min(CHUNK_SIZE, size - sent), MSG_NOSIGNAL);
+    if(result <= 0)
+    {
+      return false;
+    }
+    sent += result;
+
+    if(mOptions.bandwidthKBps > 0u)
+    {
+      // Sleep until the time at which this many bytes are due.
+      const auto due = start + std::chrono::microseconds(sent * 1000u / mOptions.bandwidthKBps);
+      std::this_thread::sleep_until(due);
+    }
+  }
+  return sent == size;
+}
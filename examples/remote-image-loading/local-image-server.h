@@ -0,0 +1,129 @@
+#ifndef DALI_DEMO_LOCAL_IMAGE_SERVER_H
+#define DALI_DEMO_LOCAL_IMAGE_SERVER_H
+
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <atomic>
+#include <cstdint>
+#include <list>
+#include <string>
+#include <thread>
+#include <vector>
+
+/**
+ * Minimal HTTP/1.0 server on the loopback interface, standing in for an image CDN.
+ *
+ * Every GET is served from the root directory on its own thread, after the configured latency
+ * and at the configured bandwidth; a share of the requests can be made to fail with a 503.
+ * The query string is ignored, so the same file can be requested under many URLs.
+ */
+class LocalImageServer
+{
+public:
+  struct Options
+  {
+    uint32_t latencyMs{0u};      ///< Delay before answering each request
+    uint32_t bandwidthKBps{0u};  ///< Bandwidth of each response in KB per second, 0 for unlimited
+    uint32_t failurePercent{0u}; ///< Share of the requests answered with a 503
+  };
+
+  /**
+   * @param[in] rootDirectory Directory served, with a trailing slash
+   * @param[in] options Latency, bandwidth and failures
+   */
+  LocalImageServer(const std::string& rootDirectory, const Options& options);
+
+  ~LocalImageServer();
+
+  /**
+   * Listens on an ephemeral port of 127.0.0.1.
+   * @return false if the socket can't be set up
+   */
+  bool Start();
+
+  /**
+   * Stops listening and waits for the requests being served.
+   */
+  void Stop();
+
+  /**
+   * @return The URL of a file of the root directory
+   */
+  std::string GetUrl(const std::string& fileName) const;
+
+  uint32_t GetActiveRequests() const
+  {
+    return mActiveRequests;
+  }
+
+  uint32_t GetPeakActiveRequests() const
+  {
+    return mPeakActiveRequests;
+  }
+
+  uint32_t GetRequestCount() const
+  {
+    return mRequestCount;
+  }
+
+  uint32_t GetFailureCount() const
+  {
+    return mFailureCount;
+  }
+
+  /**
+   * Restarts the request counters, e.g. between two runs.
+   */
+  void ResetCounters();
+
+private:
+  void AcceptLoop();
+
+  /**
+   * Answers a request, then sets finished for the accept thread to join this thread.
+   */
+  void Serve(int connection, std::atomic<bool>& finished);
+
+  /**
+   * Sends the whole buffer, throttled to the bandwidth
+   */
+  bool Send(int connection, const char* data, size_t size);
+
+private:
+  const std::string mRootDirectory;
+  const Options     mOptions;
+
+  struct Connection
+  {
+    std::thread       thread;
+    std::atomic<bool> finished{false};
+  };
+
+  int                   mListenSocket{-1};
+  uint16_t              mPort{0u};
+  std::atomic<bool>     mRunning{false};
+  std::thread           mAcceptThread;
+  std::list<Connection> mConnections; ///< Requests being served, only touched by the accept thread and Stop()
+
+  std::atomic<uint32_t> mActiveRequests{0u};
+  std::atomic<uint32_t> mPeakActiveRequests{0u};
+  std::atomic<uint32_t> mRequestCount{0u};
+  std::atomic<uint32_t> mFailureCount{0u};
+};
+
+#endif // DALI_DEMO_LOCAL_IMAGE_SERVER_H
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2023 Samsung Electronics Co., Ltd.
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -16,14 +16,53 @@
  */
 
 #include <dali-toolkit/dali-toolkit.h>
+#include <dali-toolkit/devel-api/controls/control-devel.h>
 #include <dali/dali.h>
 #include <dali/devel-api/actors/actor-devel.h>
 #include <shared/utility.h>
 #include <stdlib.h>
+#include <algorithm>
+#include <chrono>
+#include <cmath>
 #include <iostream>
+#include <map>
+#include <memory>
+#include <sstream>
+#include "local-image-server.h"
+#include "shared/utility.h"
 
 using namespace Dali;
 using namespace Dali::Toolkit;
+using DemoHelper::MillisecondsSince;
+
+namespace
+{
+const char* const GALLERY_IMAGE_PREFIX = "gallery-medium-";
+constexpr int     NUM_GALLERY_IMAGES   = 53;
+constexpr int     SAMPLE_INTERVAL_MS   = 10;   ///< How often the number of requests being served is sampled
+constexpr int     STATUS_INTERVAL_MS   = 500;  ///< How often the status is refreshed while loading, relayouting it skews the times to ready
+constexpr float   CELL_FILL            = 0.9f; ///< Share of its grid cell filled by each image view
+
+bool                      gUseLocalServer(false); ///< Load from a local server instead of the internet, set with the --local option
+int                       gImageCount(50);        ///< Number of image views loaded from the local server, set with the -n option
+LocalImageServer::Options gServerOptions;         ///< Set with the -l, -b and -f options
+
+using Clock = std::chrono::steady_clock;
+
+/**
+ * @return The value at the given percentile of sorted values
+ */
+float GetPercentile(const std::vector<float>& sortedValues, float percentile)
+{
+  if(sortedValues.empty())
+  {
+    return 0.0f;
+  }
+  const size_t rank = static_cast<size_t>(std::ceil(percentile * 0.01f * sortedValues.size()));
+  return sortedValues[std::min(std::max(rank, size_t(1u)), sortedValues.size()) - 1u];
+}
+
+} // namespace
 
 // This example shows the load-time image scaling and filtering features.
 //
@@ -60,6 +99,13 @@ public:
     mWindow.KeyEventSignal().Connect(this, &MyTester::OnKey);
     mWindow.TouchedSignal().Connect(this, &MyTester::OnTouch);
 
+    if(gUseLocalServer)
+    {
+      mWindow.KeyEventSignal().Connect(this, &MyTester::OnKeyEvent);
+      StartLocalServer();
+      return;
+    }
+
     TextLabel rubric = TextLabel::New("You will need a working internet connection to see the images below");
     rubric.SetProperty(TextLabel::Property::MULTI_LINE, true);
     rubric.SetProperty(TextLabel::Property::TEXT_COLOR, Color::WHITE);
@@ -119,6 +165,166 @@ public:
     mWindow.KeyEventSignal().Connect(this, &MyTester::OnKeyEvent);
   }
 
+  /**
+   * Serves the demo images locally and starts the first run.
+   */
+  void StartLocalServer()
+  {
+    mStatus = TextLabel::New();
+    mStatus.SetProperty(TextLabel::Property::MULTI_LINE, true);
+    mStatus.SetProperty(TextLabel::Property::TEXT_COLOR, Color::WHITE);
+    mStatus.SetProperty(TextLabel::Property::POINT_SIZE, 8.0f);
+    mStatus.SetResizePolicy(ResizePolicy::FILL_TO_PARENT, Dimension::WIDTH);
+    mStatus.SetResizePolicy(ResizePolicy::DIMENSION_DEPENDENCY, Dimension::HEIGHT);
+    mStatus.SetProperty(Actor::Property::PARENT_ORIGIN, ParentOrigin::TOP_CENTER);
+    mStatus.SetProperty(Actor::Property::ANCHOR_POINT, AnchorPoint::TOP_CENTER);
+    mWindow.Add(mStatus);
+
+    mServer = std::make_unique<LocalImageServer>(DEMO_IMAGE_DIR, gServerOptions);
+    if(!mServer->Start())
+    {
+      mStatus.SetProperty(TextLabel::Property::TEXT, "Unable to start the local image server");
+      mServer.reset();
+      return;
+    }
+
+    mSampleTimer = Timer::New(SAMPLE_INTERVAL_MS);
+    mSampleTimer.TickSignal().Connect(this, &MyTester::OnSampleTimer);
+
+    StartRun();
+  }
+
+  /**
+   * Creates a grid of image views all loading from the local server at once.
+   * The URLs are unique to each run and view so that no load is shared through the texture cache.
+   */
+  void StartRun()
+  {
+    if(mGrid)
+    {
+      UnparentAndReset(mGrid);
+    }
+    mImageIndices.clear();
+    mLatencies.assign(gImageCount, 0.0f);
+    mReadyCount     = 0;
+    mFailedCount    = 0;
+    mConcurrencySum = 0u;
+    mSampleCount    = 0u;
+    mServer->ResetCounters();
+    ++mRunCount;
+
+    const Vector2 windowSize = mWindow.GetSize();
+    const float   top        = windowSize.height * 0.15f;
+    const int     columns    = static_cast<int>(std::ceil(std::sqrt(static_cast<float>(gImageCount))));
+    const int     rows       = (gImageCount + columns - 1) / columns;
+    const Vector2 cellSize(windowSize.width / columns, (windowSize.height - top) / rows);
+
+    mGrid = Actor::New();
+    mGrid.SetProperty(Actor::Property::PARENT_ORIGIN, ParentOrigin::TOP_LEFT);
+    mGrid.SetProperty(Actor::Property::ANCHOR_POINT, AnchorPoint::TOP_LEFT);
+    mGrid.SetProperty(Actor::Property::POSITION, Vector2(0.0f, top));
+    mWindow.Add(mGrid);
+
+    mRunStart = Clock::now();
+    for(int i = 0; i < gImageCount; ++i)
+    {
+      std::ostringstream fileName;
+      fileName << GALLERY_IMAGE_PREFIX << (i % NUM_GALLERY_IMAGES) + 1 << ".jpg?run=" << mRunCount << "&i=" << i;
+
+      Property::Map imageMap;
+      imageMap.Insert(Visual::Property::TYPE, Visual::IMAGE);
+      imageMap.Insert(ImageVisual::Property::URL, mServer->GetUrl(fileName.str()));
+      imageMap.Insert(ImageVisual::Property::DESIRED_WIDTH, static_cast<int>(cellSize.width));
+      imageMap.Insert(ImageVisual::Property::DESIRED_HEIGHT, static_cast<int>(cellSize.height));
+
+      ImageView imageView = ImageView::New();
+      imageView.SetProperty(ImageView::Property::IMAGE, imageMap);
+      imageView.SetProperty(Actor::Property::PARENT_ORIGIN, ParentOrigin::TOP_LEFT);
+      imageView.SetProperty(Actor::Property::ANCHOR_POINT, AnchorPoint::CENTER);
+      imageView.SetProperty(Actor::Property::POSITION, Vector2(cellSize.width * (i % columns + 0.5f), cellSize.height * (i / columns + 0.5f)));
+      imageView.SetProperty(Actor::Property::SIZE, cellSize * CELL_FILL);
+      imageView.ResourceReadySignal().Connect(this, &MyTester::OnImageReady);
+      mImageIndices[imageView.GetProperty<int>(Actor::Property::ID)] = i;
+      mGrid.Add(imageView);
+    }
+
+    mSampleTimer.Start();
+    UpdateStatus(false);
+  }
+
+  /**
+   * Keeps the time to ready of each image view; also emitted when the image has failed to load.
+   */
+  void OnImageReady(Control control)
+  {
+    auto iter = mImageIndices.find(control.GetProperty<int>(Actor::Property::ID));
+    if(iter == mImageIndices.end())
+    {
+      return; // From a previous run
+    }
+
+    mLatencies[iter->second] = MillisecondsSince(mRunStart);
+    if(DevelControl::GetVisualResourceStatus(control, ImageView::Property::IMAGE) == Visual::ResourceStatus::FAILED)
+    {
+      ++mFailedCount;
+    }
+    mImageIndices.erase(iter);
+
+    if(++mReadyCount == gImageCount)
+    {
+      mSampleTimer.Stop();
+      UpdateStatus(true);
+    }
+  }
+
+  /**
+   * Samples the number of requests the server is answering at once, and refreshes the status now and then.
+   */
+  bool OnSampleTimer()
+  {
+    const uint32_t active = mServer->GetActiveRequests();
+    mConcurrencySum += active;
+    if(++mSampleCount % (STATUS_INTERVAL_MS / SAMPLE_INTERVAL_MS) == 0u)
+    {
+      UpdateStatus(false);
+    }
+    return true;
+  }
+
+  void UpdateStatus(bool finished)
+  {
+    std::ostringstream status;
+    status << "Run " << mRunCount << ": " << mReadyCount << "/" << gImageCount << " ready, "
+           << mServer->GetActiveRequests() << " fetching, latency " << gServerOptions.latencyMs << "ms, bandwidth ";
+    if(gServerOptions.bandwidthKBps > 0u)
+    {
+      status << gServerOptions.bandwidthKBps << "KB/s";
+    }
+    else
+    {
+      status << "unlimited";
+    }
+    status << ", failures " << gServerOptions.failurePercent << "%";
+
+    if(finished)
+    {
+      std::vector<float> latencies(mLatencies);
+      std::sort(latencies.begin(), latencies.end());
+
+      std::ostringstream results;
+      results.precision(1);
+      results << std::fixed << "all ready " << latencies.back() << "ms, p50 " << GetPercentile(latencies, 50.0f)
+              << "ms, p95 " << GetPercentile(latencies, 95.0f) << "ms, " << mFailedCount << " failed ("
+              << mServer->GetFailureCount() << " by the server), concurrent fetches peak " << mServer->GetPeakActiveRequests()
+              << " mean " << (mSampleCount > 0u ? static_cast<float>(mConcurrencySum) / mSampleCount : 0.0f)
+              << " (sampled every " << SAMPLE_INTERVAL_MS << "ms), " << mServer->GetRequestCount() << " requests";
+      std::cout << "Run " << mRunCount << " of " << gImageCount << " images: " << results.str() << std::endl;
+
+      status << "\n" << results.str() << "\nPress Enter to run again";
+    }
+    mStatus.SetProperty(TextLabel::Property::TEXT, status.str());
+  }
+
   void OnAnimationEnd(Animation& source)
   {
     std::cout << "OnAnimationEnd" << std::endl;
@@ -132,6 +338,10 @@ public:
       {
         mApplication.Quit();
       }
+      else if(mServer && mReadyCount == gImageCount && event.GetKeyName().compare("Return") == 0)
+      {
+        StartRun();
+      }
     }
   }
 
@@ -203,10 +413,61 @@ private:
 
   Animation mAnimation;
   Timer     mTimer;
+
+  // Local server mode
+  std::unique_ptr<LocalImageServer> mServer;
+  TextLabel                         mStatus;
+  Actor                             mGrid;
+  Timer                             mSampleTimer;
+  std::map<int, int>                mImageIndices; ///< Index of each image view still loading, by actor ID
+  std::vector<float>                mLatencies;    ///< Time to ready of each image view, in ms
+  Clock::time_point                 mRunStart;
+  int                               mRunCount{0};
+  int                               mReadyCount{0};
+  int                               mFailedCount{0};
+  uint64_t                          mConcurrencySum{0u};
+  uint32_t                          mSampleCount{0u};
 };
 
 int DALI_EXPORT_API main(int argc, char** argv)
 {
+  for(int i(1); i < argc; ++i)
+  {
+    std::string arg(argv[i]);
+    if(arg.compare("--local") == 0)
+    {
+      gUseLocalServer = true;
+    }
+    else if(arg.compare(0, 2, "-n") == 0)
+    {
+      gImageCount = std::max(1, atoi(arg.substr(2, arg.size()).c_str()));
+    }
+    else if(arg.compare(0, 2, "-l") == 0)
+    {
+      gServerOptions.latencyMs = std::max(0, atoi(arg.substr(2, arg.size()).c_str()));
+    }
+    else if(arg.compare(0, 2, "-b") == 0)
+    {
+      gServerOptions.bandwidthKBps = std::max(0, atoi(arg.substr(2, arg.size()).c_str()));
+    }
+    else if(arg.compare(0, 2, "-f") == 0)
+    {
+      gServerOptions.failurePercent = std::min(100, std::max(0, atoi(arg.substr(2, arg.size()).c_str())));
+    }
+    else if((arg.compare("--help") == 0) || (arg.compare("-h") == 0))
+    {
+      std::cout << "remote-image-loading.example [OPTIONS]" << std::endl;
+      std::cout << "  Options:" << std::endl;
+      std::cout << "    --local        Loads the demo images from a local HTTP server instead of the internet" << std::endl;
+      std::cout << "    -n[count]      Number of images loaded from the local server, 50 by default" << std::endl;
+      std::cout << "    -l[ms]         Latency of each response of the local server" << std::endl;
+      std::cout << "    -b[KB/s]       Bandwidth of each response of the local server, unlimited by default" << std::endl;
+      std::cout << "    -f[percent]    Share of the requests the local server fails" << std::endl;
+      std::cout << "    -h|--help      Help" << std::endl;
+      return 0;
+    }
+  }
+
   Application application = Application::New(&argc, &argv, "");
   MyTester    test(application);
   application.MainLoop();
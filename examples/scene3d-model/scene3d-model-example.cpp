@@ -23,10 +23,16 @@
 #include <dali/devel-api/adaptor-framework/image-loading.h>
 #include <dali/integration-api/debug.h>
 #include <dali/public-api/actors/camera-actor.h>
+#include <chrono>
 #include <cstring>
+#include <iostream>
+
+#include "shared/baked-scene-loader.h"
+#include "shared/utility.h"
 
 using namespace Dali;
 using namespace Dali::Toolkit;
+using DemoHelper::MillisecondsSince;
 
 /*
  * This example shows how to create and display a Model control.
@@ -133,6 +139,10 @@ const int32_t NUM_OF_GLTF_MODELS = sizeof(gltf_list) / sizeof(gltf_list[0]);
 
 const std::string modeldir = DEMO_MODEL_DIR;
 const std::string imagedir = DEMO_IMAGE_DIR;
+
+const char* BAKED_SCENE_EXTENSION = ".dsb";
+
+bool gUseBakedScenes(false); ///< Load the .dsb baked by scene-baker when there is one, set with the --baked option
 const std::string uri_cube_diffuse_texture(imagedir + "forest_diffuse_cubemap.png");
 const std::string uri_diffuse_texture(imagedir + "Studio/Irradiance.ktx");
 const std::string uri_specular_texture(imagedir + "Studio/Radiance.ktx");
@@ -283,7 +293,30 @@ public:
     std::string gltfUrl = modeldir;
     gltfUrl += gltf_list[index].name;
 
-    mModel = Dali::Scene3D::Model::New(gltfUrl);
+    mLoadStart        = std::chrono::steady_clock::now();
+    mLoadedBakedScene = false;
+    if(gUseBakedScenes)
+    {
+      const std::string name(gltf_list[index].name);
+      const std::string bakedUrl = modeldir + name.substr(0, name.find_last_of('.')) + BAKED_SCENE_EXTENSION;
+
+      // The vertices, indices and pixels are copied out of the mapping, which can go once the model is created
+      BakedScene::MappedFile bakedFile;
+      if(bakedFile.Open(bakedUrl))
+      {
+        mModel            = BakedScene::CreateModel(bakedFile, gltf_list[index].size);
+        mLoadedBakedScene = true;
+      }
+      else
+      {
+        DALI_LOG_RELEASE_INFO("Scene3DModel: no baked scene at %s, loading %s\n", bakedUrl.c_str(), gltfUrl.c_str());
+      }
+    }
+
+    if(!mLoadedBakedScene)
+    {
+      mModel = Dali::Scene3D::Model::New(gltfUrl);
+    }
     mModel.SetProperty(Dali::Actor::Property::SIZE, gltf_list[index].size);
     mModel.SetProperty(Dali::Actor::Property::POSITION_Y, gltf_list[index].yPosition);
     mModel.SetProperty(Dali::Actor::Property::ANCHOR_POINT, AnchorPoint::CENTER);
@@ -298,6 +331,9 @@ public:
   void ResourceReady(Control control)
   {
     mReadyToLoad = true;
+
+    DALI_LOG_RELEASE_INFO("Scene3DModel: %s ready in %.1fms from the %s\n", gltf_list[mCurrentGlTF].name, MillisecondsSince(mLoadStart), mLoadedBakedScene ? "baked scene" : "text model");
+
     if(mModel.GetAnimationCount() > 0)
     {
       Animation animation = (std::string("exercise_model.dli") == gltf_list[mCurrentGlTF].name) ? mModel.GetAnimation("idleToSquatClip_0") : mModel.GetAnimation(0u);
@@ -640,10 +676,30 @@ private:
   int32_t mCurrentGlTF{0};
 
   bool mReadyToLoad{true};
+
+  std::chrono::steady_clock::time_point mLoadStart;               ///< When loading of the current model started
+  bool                                  mLoadedBakedScene{false}; ///< Whether the current model comes from a baked scene
 };
 
 int32_t DALI_EXPORT_API main(int32_t argc, char** argv)
 {
+  for(int i(1); i < argc; ++i)
+  {
+    std::string arg(argv[i]);
+    if(arg.compare("--baked") == 0)
+    {
+      gUseBakedScenes = true;
+    }
+    else if((arg.compare("--help") == 0) || (arg.compare("-h") == 0))
+    {
+      std::cout << "scene3d-model.example [OPTIONS]" << std::endl;
+      std::cout << "  Options:" << std::endl;
+      std::cout << "    --baked     Loads <model>.dsb, baked with scene-baker, instead of the model when there is one" << std::endl;
+      std::cout << "    -h|--help   Help" << std::endl;
+      return 0;
+    }
+  }
+
   Application         application = Application::New(&argc, &argv);
   Scene3DModelExample test(application);
   application.MainLoop();
@@ -0,0 +1,101 @@
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+#include "scene-cache.h"
+#include <dali/integration-api/debug.h>
+
+namespace
+{
+float ToMegabytes(size_t bytes)
+{
+  return bytes / (1024.0f * 1024.0f);
+}
+
+} // namespace
+
+SceneCache::SceneCache(size_t budgetBytes)
+: mBudgetBytes(budgetBytes)
+{
+}
+
+SceneLoadTaskPtr SceneCache::Find(const std::string& sceneName)
+{
+  for(auto iter = mEntries.begin(); iter != mEntries.end(); ++iter)
+  {
+    if(iter->task->GetSceneName() == sceneName)
+    {
+      mEntries.splice(mEntries.begin(), mEntries, iter);
+      return mEntries.front().task;
+    }
+  }
+  return SceneLoadTaskPtr();
+}
+
+void SceneCache::Add(SceneLoadTaskPtr task)
+{
+  if(!Find(task->GetSceneName()))
+  {
+    Insert(task, mEntries.begin());
+  }
+}
+
+void SceneCache::AddPreloaded(SceneLoadTaskPtr task)
+{
+  if(!Contains(task->GetSceneName()))
+  {
+    Insert(task, mEntries.end());
+  }
+}
+
+void SceneCache::Insert(SceneLoadTaskPtr task, std::list<Entry>::iterator position)
+{
+  const size_t bytes = task->GetMemoryEstimate();
+  const auto   added = mEntries.insert(position, Entry{task, bytes});
+  mUsedBytes += bytes;
+
+  auto iter = mEntries.end();
+  while(mUsedBytes > mBudgetBytes && --iter != mEntries.begin())
+  {
+    if(iter == added)
+    {
+      continue;
+    }
+
+    DALI_LOG_RELEASE_INFO("Scene3D: cache evicts %s (%.1fMB)\n", iter->task->GetSceneName().c_str(), ToMegabytes(iter->bytes));
+    mUsedBytes -= iter->bytes;
+    iter = mEntries.erase(iter);
+  }
+
+  DALI_LOG_RELEASE_INFO("Scene3D: cache holds %zu scenes, %.1f/%.1fMB\n", mEntries.size(), ToMegabytes(mUsedBytes), ToMegabytes(mBudgetBytes));
+}
+
+bool SceneCache::Contains(const std::string& sceneName) const
+{
+  for(auto& entry : mEntries)
+  {
+    if(entry.task->GetSceneName() == sceneName)
+    {
+      return true;
+    }
+  }
+  return false;
+}
+
+void SceneCache::Clear()
+{
+  mEntries.clear();
+  mUsedBytes = 0u;
+}
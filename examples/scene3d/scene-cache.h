@@ -0,0 +1,96 @@
+#ifndef SCENE_CACHE_H_
+#define SCENE_CACHE_H_
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <list>
+#include <string>
+#include "scene-load-task.h"
+
+/**
+ * Least recently used cache of loaded scenes, i.e. of the ResourceBundle and SceneDefinition
+ * held by finished SceneLoadTasks, so that reopening a scene only creates its actors.
+ * Scenes are evicted, least recently used first, once their estimated memory exceeds the budget.
+ * The most recently used scene, i.e. the one on display, is never evicted.
+ */
+class SceneCache
+{
+public:
+  /**
+   * @param[in] budgetBytes Memory the cached scenes may use
+   */
+  explicit SceneCache(size_t budgetBytes);
+
+  /**
+   * Finds a scene and marks it as the most recently used.
+   * @return The task which has loaded the scene, or an empty pointer if it isn't cached
+   */
+  SceneLoadTaskPtr Find(const std::string& sceneName);
+
+  /**
+   * Adds a scene whose resources are generated, as the most recently used, then evicts scenes
+   * until the budget is met. The scene just added is kept even if it alone exceeds the budget.
+   */
+  void Add(SceneLoadTaskPtr task);
+
+  /**
+   * Adds a preloaded scene as the least recently used, so that it is the first to be evicted
+   * and never displaces the scene on display, then evicts scenes until the budget is met.
+   */
+  void AddPreloaded(SceneLoadTaskPtr task);
+
+  /**
+   * @return Whether the scene is cached, without marking it as used
+   */
+  bool Contains(const std::string& sceneName) const;
+
+  void Clear();
+
+  size_t GetUsedBytes() const
+  {
+    return mUsedBytes;
+  }
+
+  size_t GetBudgetBytes() const
+  {
+    return mBudgetBytes;
+  }
+
+  size_t GetCount() const
+  {
+    return mEntries.size();
+  }
+
+private:
+  struct Entry
+  {
+    SceneLoadTaskPtr task;
+    size_t           bytes;
+  };
+
+  /**
+   * Inserts the scene before position unless it is cached, then evicts the least recently used
+   * scenes other than the one inserted and the most recently used one until the budget is met.
+   */
+  void Insert(SceneLoadTaskPtr task, std::list<Entry>::iterator position);
+
+  std::list<Entry> mEntries; ///< Most recently used first
+  size_t           mBudgetBytes;
+  size_t           mUsedBytes{0u};
+};
+
+#endif // SCENE_CACHE_H_
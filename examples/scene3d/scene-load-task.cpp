@@ -0,0 +1,230 @@
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+#include "scene-load-task.h"
+#include <algorithm>
+#include <filesystem>
+#include <string_view>
+#include "shared/utility.h"
+
+using namespace Dali;
+using namespace Dali::Scene3D::Loader;
+using DemoHelper::MillisecondsSince;
+
+namespace
+{
+const Vector3 CAMERA_DEFAULT_POSITION(0.0f, 0.0f, 3.5f);
+
+const std::string_view GLTF_EXTENSION = ".gltf";
+
+void ConfigureBlendShapeShaders(ResourceBundle& resources, const SceneDefinition& scene, Actor root, std::vector<BlendshapeShaderConfigurationRequest>&& requests)
+{
+  std::vector<std::string> errors;
+  auto                     onError = [&errors](const std::string& msg)
+  {
+    errors.push_back(msg);
+  };
+  if(!scene.ConfigureBlendshapeShaders(resources, root, std::move(requests), onError))
+  {
+    ExceptionFlinger flinger(ASSERT_LOCATION);
+    for(auto& msg : errors)
+    {
+      flinger << msg << '\n';
+    }
+  }
+}
+
+} // namespace
+
+SceneLoadTask::SceneLoadTask(const std::string& sceneName, ResourceBundle::PathProvider pathProvider, CallbackBase* callback)
+: AsyncTask(callback),
+  mSceneName(sceneName),
+  mPathProvider(std::move(pathProvider)),
+  mOutput{
+    mResources,
+    mScene,
+    mMetaData,
+    mAnimations,
+    mAnimGroups,
+    mCameraParameters,
+    mLights},
+  mCreationTime(std::chrono::steady_clock::now())
+{
+}
+
+SceneLoadTask::~SceneLoadTask() = default;
+
+void SceneLoadTask::Process()
+{
+  const auto start = std::chrono::steady_clock::now();
+  mQueueTimeMs     = MillisecondsSince(mCreationTime);
+
+  if(mCancelled)
+  {
+    return;
+  }
+
+  try
+  {
+    auto path = mPathProvider(ResourceType::Mesh) + mSceneName;
+
+    // Only the raw data of the resources is loaded here; textures and geometry are created on the event thread.
+    mModelLoader.reset(new ModelLoader(path, mPathProvider(ResourceType::Mesh) + "/", mOutput));
+    mModelLoader->LoadModel(mPathProvider, true);
+    mSucceeded = !mCancelled;
+  }
+  catch(const DaliException& e)
+  {
+    mError = e.condition;
+  }
+  catch(const std::exception& e)
+  {
+    mError = e.what();
+  }
+
+  if(mCancelled)
+  {
+    // Drop the decoded data right away rather than when the last reference goes
+    mResources = ResourceBundle();
+    mModelLoader.reset();
+  }
+
+  mParseTimeMs = MillisecondsSince(start);
+}
+
+void SceneLoadTask::Cancel()
+{
+  mCancelled = true;
+}
+
+void SceneLoadTask::GenerateResources()
+{
+  if(!mResourcesGenerated)
+  {
+    const auto start = std::chrono::steady_clock::now();
+    mResources.GenerateResources();
+    mResourcesGenerated = true;
+    mUploadTimeMs       = MillisecondsSince(start);
+  }
+}
+
+size_t SceneLoadTask::GetMemoryEstimate() const
+{
+  size_t bytes = 0u;
+  for(auto& material : mResources.mMaterials)
+  {
+    if(auto textureSet = material.second)
+    {
+      for(uint32_t i = 0u; i < textureSet.GetTextureCount(); ++i)
+      {
+        if(auto texture = textureSet.GetTexture(i))
+        {
+          // RGBA, plus a third for the mipmaps
+          bytes += size_t(texture.GetWidth()) * texture.GetHeight() * 4u * 4u / 3u;
+        }
+      }
+    }
+  }
+
+  for(auto& mesh : mResources.mMeshes)
+  {
+    auto& definition = mesh.first;
+    bytes += definition.mIndices.mBlob.mLength + definition.mPositions.mBlob.mLength +
+             definition.mNormals.mBlob.mLength + definition.mTangents.mBlob.mLength;
+  }
+  return bytes;
+}
+
+Actor SceneLoadTask::CreateScene(CameraActor camera, std::vector<Animation>& generatedAnimations)
+{
+  GenerateResources();
+
+  const auto start = std::chrono::steady_clock::now();
+
+  if(mCameraParameters.empty())
+  {
+    mCameraParameters.push_back(CameraParameters());
+    mCameraParameters[0].matrix.SetTranslation(CAMERA_DEFAULT_POSITION);
+  }
+  mCameraParameters[0].ConfigureCamera(camera);
+  SetActorCentered(camera);
+
+  std::filesystem::path modelPath(mSceneName);
+  std::string           extension = modelPath.extension();
+  std::transform(extension.begin(), extension.end(), extension.begin(), ::tolower);
+
+  ShaderManagerPtr             shaderManager  = (extension == GLTF_EXTENSION) ? new ShaderManager() : nullptr;
+  ViewProjection               viewProjection = mCameraParameters[0].GetViewProjection();
+  Transforms                   xforms{
+    MatrixStack{},
+    viewProjection};
+  NodeDefinition::CreateParams nodeParams{
+    mResources,
+    xforms,
+    shaderManager,
+    {},
+    {},
+    {}};
+
+  Actor root = Actor::New();
+  SetActorCentered(root);
+
+  auto& resourceChoices = mModelLoader->GetResourceChoices();
+  for(auto iRoot : mScene.GetRoots())
+  {
+    if(auto actor = mScene.CreateNodes(iRoot, resourceChoices, nodeParams))
+    {
+      mScene.ConfigureSkinningShaders(mResources, actor, std::move(nodeParams.mSkinnables));
+      ConfigureBlendShapeShaders(mResources, mScene, actor, std::move(nodeParams.mBlendshapeRequests));
+
+      mScene.ApplyConstraints(actor, std::move(nodeParams.mConstrainables));
+
+      root.Add(actor);
+    }
+  }
+
+  generatedAnimations.clear();
+  if(!mAnimations.empty())
+  {
+    generatedAnimations.reserve(mAnimations.size());
+    auto getActor = [&](const AnimatedProperty& property)
+    {
+      Dali::Actor actor;
+      if(property.mNodeIndex != INVALID_INDEX)
+      {
+        auto* node = mScene.GetNode(property.mNodeIndex);
+        if(node != nullptr)
+        {
+          actor = root.FindChildById(node->mNodeId);
+        }
+      }
+      else
+      {
+        actor = root.FindChildByName(property.mNodeName);
+      }
+      return actor;
+    };
+
+    for(auto& animationDefinition : mAnimations)
+    {
+      generatedAnimations.push_back(animationDefinition.ReAnimate(getActor));
+    }
+    generatedAnimations[0].Play();
+  }
+
+  mCreateTimeMs = MillisecondsSince(start);
+  return root;
+}
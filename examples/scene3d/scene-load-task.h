@@ -0,0 +1,152 @@
+#ifndef SCENE_LOAD_TASK_H_
+#define SCENE_LOAD_TASK_H_
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <dali-scene3d/dali-scene3d.h>
+#include <dali/dali.h>
+#include <dali/public-api/adaptor-framework/async-task-manager.h>
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <string>
+#include <vector>
+
+class SceneLoadTask;
+using SceneLoadTaskPtr = Dali::IntrusivePtr<SceneLoadTask>;
+
+/**
+ * Loads a .dli / .gltf scene in two phases:
+ *  - Process() runs on a worker thread of the AsyncTaskManager; it parses the scene, reads the
+ *    buffers and decodes the images into the raw data of the ResourceBundle.
+ *  - CreateScene() runs on the event thread once the task has completed; it uploads the
+ *    resources, creates the actors and the animations.
+ * The time spent in each phase is kept for logging.
+ */
+class SceneLoadTask : public Dali::AsyncTask
+{
+public:
+  /**
+   * @param[in] sceneName File name of the scene, relative to the models directory
+   * @param[in] pathProvider Provides the directory of each type of resource
+   * @param[in] callback Called on the event thread once Process() has finished
+   */
+  SceneLoadTask(const std::string& sceneName, Dali::Scene3D::Loader::ResourceBundle::PathProvider pathProvider, Dali::CallbackBase* callback);
+
+  ~SceneLoadTask() override;
+
+  /**
+   * Worker thread phase.
+   */
+  void Process() override;
+
+  /**
+   * Asks the task to drop its work; a running Process() can only stop in between steps.
+   */
+  void Cancel();
+
+  /**
+   * @return Whether Process() has loaded the scene, false if it failed or was cancelled
+   */
+  bool HasSucceeded() const
+  {
+    return mSucceeded;
+  }
+
+  /**
+   * @return The reason Process() has failed
+   */
+  const std::string& GetError() const
+  {
+    return mError;
+  }
+
+  /**
+   * Creates the textures and geometry from the raw data, once; must only be called on the event thread once Process() has succeeded.
+   */
+  void GenerateResources();
+
+  /**
+   * Estimates the memory held by the resources, once they are generated: texture pixels and mesh buffers.
+   */
+  size_t GetMemoryEstimate() const;
+
+  /**
+   * Event thread phase, must only be called once Process() has succeeded; the resources are shared by all the scenes created.
+   * @param[in] camera Configured from the first camera of the scene
+   * @param[out] generatedAnimations The animations of the scene, the first one is played
+   * @return The root of the scene
+   */
+  Dali::Actor CreateScene(Dali::CameraActor camera, std::vector<Dali::Animation>& generatedAnimations);
+
+  /**
+   * @return The name of the scene being loaded
+   */
+  const std::string& GetSceneName() const
+  {
+    return mSceneName;
+  }
+
+  float GetQueueTimeMs() const
+  {
+    return mQueueTimeMs;
+  }
+
+  float GetParseTimeMs() const
+  {
+    return mParseTimeMs;
+  }
+
+  float GetUploadTimeMs() const
+  {
+    return mUploadTimeMs;
+  }
+
+  float GetCreateTimeMs() const
+  {
+    return mCreateTimeMs;
+  }
+
+private:
+  const std::string                                   mSceneName;
+  Dali::Scene3D::Loader::ResourceBundle::PathProvider mPathProvider;
+
+  Dali::Scene3D::Loader::ResourceBundle                       mResources;
+  Dali::Scene3D::Loader::SceneDefinition                      mScene;
+  Dali::Scene3D::Loader::SceneMetadata                        mMetaData;
+  std::vector<Dali::Scene3D::Loader::AnimationDefinition>      mAnimations;
+  std::vector<Dali::Scene3D::Loader::AnimationGroupDefinition> mAnimGroups;
+  std::vector<Dali::Scene3D::Loader::CameraParameters>         mCameraParameters;
+  std::vector<Dali::Scene3D::Loader::LightParameters>          mLights;
+  Dali::Scene3D::Loader::LoadResult                            mOutput;
+
+  std::unique_ptr<Dali::Scene3D::Loader::ModelLoader> mModelLoader;
+
+  std::chrono::steady_clock::time_point mCreationTime;
+
+  std::string       mError;
+  bool              mSucceeded{false};
+  bool              mResourcesGenerated{false};
+  std::atomic<bool> mCancelled{false};
+
+  float mQueueTimeMs{0.0f};  ///< From creation to the start of Process()
+  float mParseTimeMs{0.0f};  ///< Parsing and raw resource loading, on the worker thread
+  float mUploadTimeMs{0.0f}; ///< Generating textures and geometry, on the event thread
+  float mCreateTimeMs{0.0f}; ///< Creating actors, shaders and animations, on the event thread
+};
+
+#endif // SCENE_LOAD_TASK_H_
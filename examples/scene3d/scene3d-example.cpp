@@ -15,15 +15,18 @@
  *
  */
 #include "scene3d-example.h"
+#include <dali/integration-api/debug.h>
 #include <dirent.h>
+#include <algorithm>
 #include <cstring>
-#include <filesystem>
 #include <string_view>
 #include "scene3d-extension.h"
+#include "shared/utility.h"
 
 using namespace Dali;
 using namespace Dali::Toolkit;
 using namespace Dali::Scene3D::Loader;
+using DemoHelper::MillisecondsSince;
 
 namespace
 {
@@ -31,7 +34,8 @@ const float ROTATION_SCALE = 180.f; // the amount of rotation that a swipe whose
 
 const float ITEM_HEIGHT = 50.f;
 
-const Vector3 CAMERA_DEFAULT_POSITION(0.0f, 0.0f, 3.5f);
+const size_t       SCENE_CACHE_BUDGET = 256u * 1024u * 1024u; ///< Estimated memory of the cached scenes
+const unsigned int PRELOAD_DISTANCE   = 1u;                   ///< Scenes this close to the focused item are loaded ahead
 
 const std::string_view DLI_EXTENSION  = ".dli";
 const std::string_view GLTF_EXTENSION = ".gltf";
@@ -45,6 +49,14 @@ const std::string RESOURCE_TYPE_DIRS[]{
 
 using StringVector = std::vector<std::string>;
 
+ResourceBundle::PathProvider GetPathProvider()
+{
+  return [](ResourceType::Value type)
+  {
+    return Application::GetResourcePath() + RESOURCE_TYPE_DIRS[type];
+  };
+}
+
 StringVector ListFiles(
   const std::string& path, bool (*predicate)(const char*) = [](const char*)
                            { return true; })
@@ -112,132 +124,33 @@ Actor CreateErrorMessage(std::string msg)
   return label;
 }
 
-void ConfigureBlendShapeShaders(ResourceBundle& resources, const SceneDefinition& scene, Actor root, std::vector<BlendshapeShaderConfigurationRequest>&& requests)
+Actor CreateLoadingView(const std::string& sceneName)
 {
-  std::vector<std::string> errors;
-  auto                     onError = [&errors](const std::string& msg)
-  {
-    errors.push_back(msg);
-  };
-  if(!scene.ConfigureBlendshapeShaders(resources, root, std::move(requests), onError))
-  {
-    ExceptionFlinger flinger(ASSERT_LOCATION);
-    for(auto& msg : errors)
-    {
-      flinger << msg << '\n';
-    }
-  }
-}
-
-Actor LoadScene(std::string sceneName, CameraActor camera, std::vector<Dali::Animation>& generatedAnimations, Animation& animation)
-{
-  ResourceBundle::PathProvider pathProvider = [](ResourceType::Value type)
-  {
-    return Application::GetResourcePath() + RESOURCE_TYPE_DIRS[type];
-  };
-
-  auto path = pathProvider(ResourceType::Mesh) + sceneName;
-
-  ResourceBundle                                          resources;
-  SceneDefinition                                         scene;
-  SceneMetadata                                           metaData;
-  std::vector<Dali::Scene3D::Loader::AnimationDefinition> animations;
-  std::vector<AnimationGroupDefinition>                   animGroups;
-  std::vector<CameraParameters>                           cameraParameters;
-  std::vector<LightParameters>                            lights;
-
-  animations.clear();
-
-  LoadResult output{
-    resources,
-    scene,
-    metaData,
-    animations,
-    animGroups,
-    cameraParameters,
-    lights};
-
-  Dali::Scene3D::Loader::ModelLoader modelLoader(path, pathProvider(ResourceType::Mesh) + "/", output);
-  modelLoader.LoadModel(pathProvider);
-
-  if(cameraParameters.empty())
-  {
-    cameraParameters.push_back(CameraParameters());
-    cameraParameters[0].matrix.SetTranslation(CAMERA_DEFAULT_POSITION);
-  }
-  cameraParameters[0].ConfigureCamera(camera);
-  SetActorCentered(camera);
-
-  std::filesystem::path modelPath(path);
-  std::string           extension = modelPath.extension();
-  std::transform(extension.begin(), extension.end(), extension.begin(), ::tolower);
-
-  Scene3D::Loader::ShaderManagerPtr shaderManager  = (extension == GLTF_EXTENSION) ? new Scene3D::Loader::ShaderManager() : nullptr;
-  ViewProjection                    viewProjection = cameraParameters[0].GetViewProjection();
-  Transforms                        xforms{
-    MatrixStack{},
-    viewProjection};
-  NodeDefinition::CreateParams nodeParams{
-    resources,
-    xforms,
-    shaderManager,
-    {},
-    {},
-    {}};
-
-  Actor root = Actor::New();
-  SetActorCentered(root);
-
-  auto& resourceChoices = modelLoader.GetResourceChoices();
-  for(auto iRoot : scene.GetRoots())
-  {
-    if(auto actor = scene.CreateNodes(iRoot, resourceChoices, nodeParams))
-    {
-      scene.ConfigureSkinningShaders(resources, actor, std::move(nodeParams.mSkinnables));
-      ConfigureBlendShapeShaders(resources, scene, actor, std::move(nodeParams.mBlendshapeRequests));
-
-      scene.ApplyConstraints(actor, std::move(nodeParams.mConstrainables));
-
-      root.Add(actor);
-    }
-  }
-
-  generatedAnimations.clear();
-  if(!animations.empty())
-  {
-    generatedAnimations.reserve(animations.size());
-    auto getActor = [&](const Scene3D::Loader::AnimatedProperty& property)
-    {
-      Dali::Actor actor;
-      if(property.mNodeIndex != Scene3D::Loader::INVALID_INDEX)
-      {
-        auto* node = scene.GetNode(property.mNodeIndex);
-        if(node != nullptr)
-        {
-          actor = root.FindChildById(node->mNodeId);
-        }
-      }
-      else
-      {
-        actor = root.FindChildByName(property.mNodeName);
-      }
-      return actor;
-    };
-
-    for(auto& animationDefinition : animations)
-    {
-      generatedAnimations.push_back(animationDefinition.ReAnimate(getActor));
-    }
-    generatedAnimations[0].Play();
-  }
-
-  return root;
+  auto view = Control::New();
+  view.SetResizePolicy(ResizePolicy::FILL_TO_PARENT, Dimension::ALL_DIMENSIONS);
+  SetActorCentered(view);
+
+  auto label = MakeLabel("Loading " + sceneName + "...");
+  label.SetProperty(TextLabel::Property::HORIZONTAL_ALIGNMENT, HorizontalAlignment::CENTER);
+  view.Add(label);
+
+  // ModelLoader doesn't report how far it got, so the bar only shows that loading is in progress
+  auto progressBar = ProgressBar::New();
+  progressBar.SetProperty(ProgressBar::Property::INDETERMINATE, true);
+  progressBar.SetResizePolicy(ResizePolicy::SIZE_RELATIVE_TO_PARENT, Dimension::WIDTH);
+  progressBar.SetProperty(Actor::Property::SIZE_MODE_FACTOR, Vector3(0.8f, 1.0f, 1.0f));
+  progressBar.SetProperty(Actor::Property::PARENT_ORIGIN, Vector3(0.5f, 0.6f, 0.5f));
+  progressBar.SetProperty(Actor::Property::ANCHOR_POINT, AnchorPoint::CENTER);
+  view.Add(progressBar);
+
+  return view;
 }
 
 } // namespace
 
 Scene3DExample::Scene3DExample(Dali::Application& app)
 : mApp(app),
+  mSceneCache(SCENE_CACHE_BUDGET),
   mScene3DExtension(new Scene3DExtension())
 {
   if(!std::getenv("DALI_APPLICATION_PACKAGE"))
@@ -365,11 +278,25 @@ void Scene3DExample::OnKeyboardFocusChanged(Actor originalFocusedActor, Actor cu
   {
     auto itemId = mItemView.GetItemId(currentFocusedActor);
     mItemView.ScrollToItem(itemId, 0.1f);
+
+    if(!mScene && !mLoadTask && itemId < mSceneNames.size())
+    {
+      PreloadAround(itemId);
+    }
   }
 }
 
 void Scene3DExample::OnTerminate(Application& app)
 {
+  CancelLoading();
+  for(auto& preload : mPreloadTasks)
+  {
+    preload.second->Cancel();
+    AsyncTaskManager::Get().RemoveTask(preload.second);
+  }
+  mPreloadTasks.clear();
+  mSceneCache.Clear();
+
   mTapDetector.Reset();
   mPanDetector.Reset();
 
@@ -390,17 +317,19 @@ void Scene3DExample::OnKey(const KeyEvent& e)
   {
     if(IsKey(e, DALI_KEY_ESCAPE) || IsKey(e, DALI_KEY_BACK))
     {
-      if(mScene)
+      if(mLoadTask)
+      {
+        CancelLoading();
+        ReturnToSceneList();
+      }
+      else if(mScene)
       {
         mPanDetector.Reset();
 
         mNavigationView.Pop();
         mScene.Reset();
 
-        if(mActivatedActor)
-        {
-          KeyboardFocusManager::Get().SetCurrentFocusActor(mActivatedActor);
-        }
+        ReturnToSceneList();
         auto window = mApp.GetWindow();
         window.GetRootLayer().SetProperty(Layer::Property::BEHAVIOR, Layer::LAYER_UI);
       }
@@ -434,37 +363,206 @@ void Scene3DExample::OnPan(Actor actor, const PanGesture& pan)
 
 void Scene3DExample::OnTap(Dali::Actor actor, const Dali::TapGesture& tap)
 {
+  if(mLoadTask)
+  {
+    return;
+  }
+
   mActivatedActor = actor;
 
-  auto id = mItemView.GetItemId(actor);
+  auto        id        = mItemView.GetItemId(actor);
+  const auto& sceneName = mSceneNames[id];
+  mLoadStart            = std::chrono::steady_clock::now();
 
-  try
+  if(auto cached = mSceneCache.Find(sceneName))
   {
-    auto window = mApp.GetWindow();
-    window.GetRootLayer().SetProperty(Layer::Property::BEHAVIOR, Layer::LAYER_3D);
-    auto renderTasks = window.GetRenderTaskList();
-    renderTasks.RemoveTask(mSceneRender);
+    ShowScene(cached, true);
+    return;
+  }
 
-    auto scene = LoadScene(mSceneNames[id], mSceneCamera, mSceneAnimations, mCurrentAnimation);
+  // Parsing and decoding happen on a worker thread, OnSceneLoaded() creates the actors.
+  auto preload = mPreloadTasks.find(sceneName);
+  if(preload != mPreloadTasks.end())
+  {
+    mLoadTask = preload->second;
+    mPreloadTasks.erase(preload);
+  }
+  else
+  {
+    mLoadTask = StartLoading(sceneName);
+  }
 
-    auto sceneRender = renderTasks.CreateTask();
-    sceneRender.SetCameraActor(mSceneCamera);
-    sceneRender.SetSourceActor(scene);
-    sceneRender.SetExclusive(true);
+  mLoadingView = CreateLoadingView(sceneName);
+  mNavigationView.Push(mLoadingView);
+}
 
-    mScene       = scene;
-    mSceneRender = sceneRender;
+SceneLoadTaskPtr Scene3DExample::StartLoading(const std::string& sceneName)
+{
+  SceneLoadTaskPtr task = new SceneLoadTask(sceneName, GetPathProvider(), MakeCallback(this, &Scene3DExample::OnSceneLoaded));
+  AsyncTaskManager::Get().AddTask(task);
+  return task;
+}
 
-    mPanDetector = PanGestureDetector::New();
-    mPanDetector.DetectedSignal().Connect(this, &Scene3DExample::OnPan);
-    mPanDetector.Attach(mNavigationView);
+void Scene3DExample::OnSceneLoaded(AsyncTaskPtr task)
+{
+  auto* loaded = static_cast<SceneLoadTask*>(task.Get());
+
+  if(mLoadTask && loaded == mLoadTask.Get())
+  {
+    SceneLoadTaskPtr loadTask = mLoadTask;
+    mLoadTask.Reset();
+
+    mNavigationView.Pop();
+    mLoadingView.Reset();
+
+    ShowScene(loadTask, false);
+    return;
+  }
+
+  auto preload = mPreloadTasks.find(loaded->GetSceneName());
+  if(preload != mPreloadTasks.end() && preload->second.Get() == loaded)
+  {
+    SceneLoadTaskPtr preloadTask = preload->second;
+    mPreloadTasks.erase(preload);
+
+    if(preloadTask->HasSucceeded())
+    {
+      preloadTask->GenerateResources();
+      DALI_LOG_RELEASE_INFO("Scene3D: %s preloaded (parse %.1fms on worker, upload %.1fms)\n",
+                            preloadTask->GetSceneName().c_str(),
+                            preloadTask->GetParseTimeMs(),
+                            preloadTask->GetUploadTimeMs());
+      mSceneCache.AddPreloaded(preloadTask);
+    }
+  }
+  // Otherwise the task was cancelled
+}
+
+void Scene3DExample::ShowScene(SceneLoadTaskPtr loadTask, bool fromCache)
+{
+  if(!loadTask->HasSucceeded())
+  {
+    mScene = CreateErrorMessage(loadTask->GetError());
+  }
+  else
+  {
+    try
+    {
+      auto window = mApp.GetWindow();
+      window.GetRootLayer().SetProperty(Layer::Property::BEHAVIOR, Layer::LAYER_3D);
+      auto renderTasks = window.GetRenderTaskList();
+      renderTasks.RemoveTask(mSceneRender);
+
+      auto scene = loadTask->CreateScene(mSceneCamera, mSceneAnimations);
+
+      auto sceneRender = renderTasks.CreateTask();
+      sceneRender.SetCameraActor(mSceneCamera);
+      sceneRender.SetSourceActor(scene);
+      sceneRender.SetExclusive(true);
+
+      mScene       = scene;
+      mSceneRender = sceneRender;
+
+      mPanDetector = PanGestureDetector::New();
+      mPanDetector.DetectedSignal().Connect(this, &Scene3DExample::OnPan);
+      mPanDetector.Attach(mNavigationView);
+
+      mSceneCache.Add(loadTask);
+    }
+    catch(const DaliException& e)
+    {
+      mScene = CreateErrorMessage(e.condition);
+    }
+  }
+
+  if(fromCache)
+  {
+    DALI_LOG_RELEASE_INFO("Scene3D: %s opened from cache in %.1fms (create %.1fms)\n",
+                          loadTask->GetSceneName().c_str(),
+                          MillisecondsSince(mLoadStart),
+                          loadTask->GetCreateTimeMs());
   }
-  catch(const DaliException& e)
+  else
   {
-    mScene = CreateErrorMessage(e.condition);
+    DALI_LOG_RELEASE_INFO("Scene3D: %s loaded in %.1fms (queue %.1fms, parse %.1fms on worker, upload %.1fms, create %.1fms on event thread)\n",
+                          loadTask->GetSceneName().c_str(),
+                          MillisecondsSince(mLoadStart),
+                          loadTask->GetQueueTimeMs(),
+                          loadTask->GetParseTimeMs(),
+                          loadTask->GetUploadTimeMs(),
+                          loadTask->GetCreateTimeMs());
   }
 
   mNavigationView.Push(mScene);
 
   mScene3DExtension->ConnectTouchSignals();
+
+  // Moving to the next or previous scene should be near-instant as well
+  if(mActivatedActor)
+  {
+    PreloadAround(mItemView.GetItemId(mActivatedActor));
+  }
+}
+
+void Scene3DExample::PreloadAround(unsigned int itemId)
+{
+  auto isNear = [itemId](unsigned int id)
+  {
+    return id + PRELOAD_DISTANCE >= itemId && id <= itemId + PRELOAD_DISTANCE;
+  };
+
+  // Drop the preloads which are no longer near the focus
+  for(auto iter = mPreloadTasks.begin(); iter != mPreloadTasks.end();)
+  {
+    auto name = std::find(mSceneNames.begin(), mSceneNames.end(), iter->first);
+    if(!isNear(name - mSceneNames.begin()))
+    {
+      iter->second->Cancel();
+      AsyncTaskManager::Get().RemoveTask(iter->second);
+      iter = mPreloadTasks.erase(iter);
+    }
+    else
+    {
+      ++iter;
+    }
+  }
+
+  const unsigned int first = itemId > PRELOAD_DISTANCE ? itemId - PRELOAD_DISTANCE : 0u;
+  for(unsigned int id = first; id <= itemId + PRELOAD_DISTANCE && id < mSceneNames.size(); ++id)
+  {
+    const auto& sceneName = mSceneNames[id];
+    if(!mSceneCache.Contains(sceneName) &&
+       mPreloadTasks.find(sceneName) == mPreloadTasks.end() &&
+       !(mLoadTask && mLoadTask->GetSceneName() == sceneName))
+    {
+      mPreloadTasks[sceneName] = StartLoading(sceneName);
+    }
+  }
+}
+
+void Scene3DExample::CancelLoading()
+{
+  if(mLoadTask)
+  {
+    // A task which has already started still runs to the end, but its result is dropped
+    mLoadTask->Cancel();
+    AsyncTaskManager::Get().RemoveTask(mLoadTask);
+
+    DALI_LOG_RELEASE_INFO("Scene3D: %s cancelled after %.1fms\n", mLoadTask->GetSceneName().c_str(), MillisecondsSince(mLoadStart));
+    mLoadTask.Reset();
+  }
+
+  if(mLoadingView)
+  {
+    mNavigationView.Pop();
+    mLoadingView.Reset();
+  }
+}
+
+void Scene3DExample::ReturnToSceneList()
+{
+  if(mActivatedActor)
+  {
+    KeyboardFocusManager::Get().SetCurrentFocusActor(mActivatedActor);
+  }
 }
@@ -21,7 +21,11 @@
 #include <dali-toolkit/dali-toolkit.h>
 #include <dali-toolkit/devel-api/controls/navigation-view/navigation-view.h>
 #include <dali/dali.h>
+#include <chrono>
+#include <map>
 #include <memory>
+#include "scene-cache.h"
+#include "scene-load-task.h"
 
 class Scene3DExtension;
 
@@ -52,6 +56,13 @@ private: // data
 
   Dali::Actor mActivatedActor;
 
+  SceneLoadTaskPtr                      mLoadTask;    ///< Scene being loaded in the background, if any
+  Dali::Actor                           mLoadingView; ///< Shown while mLoadTask is running
+  std::chrono::steady_clock::time_point mLoadStart;
+
+  SceneCache                              mSceneCache;
+  std::map<std::string, SceneLoadTaskPtr> mPreloadTasks; ///< Scenes loaded ahead of being opened, by name
+
 public:
   Dali::Actor mScene;
 
@@ -68,6 +79,13 @@ private: // methods
   void OnPan(Dali::Actor actor, const Dali::PanGesture& pan);
   void OnTap(Dali::Actor actor, const Dali::TapGesture& tap);
 
+  SceneLoadTaskPtr StartLoading(const std::string& sceneName);
+  void             OnSceneLoaded(Dali::AsyncTaskPtr task);
+  void             ShowScene(SceneLoadTaskPtr loadTask, bool fromCache);
+  void             PreloadAround(unsigned int itemId);
+  void             CancelLoading();
+  void             ReturnToSceneList();
+
   Dali::Actor OnKeyboardPreFocusChange(Dali::Actor current, Dali::Actor proposed, Dali::Toolkit::Control::KeyboardFocus::Direction direction);
   void        OnKeyboardFocusedActorActivated(Dali::Actor activatedActor);
   void        OnKeyboardFocusChanged(Dali::Actor originalFocusedActor, Dali::Actor currentFocusedActor);
@@ -0,0 +1,14 @@
+uniform sampler2D sInstanceData;
+
+layout(std140) uniform FragmentBlock
+{
+  lowp vec4 uColor;
+  mediump int uInstanceIndex;
+};
+
+void main()
+{
+  // Colors uploaded once per frame to a texture, one texel per actor
+  ivec2 size = textureSize(sInstanceData, 0);
+  fragColor = texelFetch(sInstanceData, ivec2(uInstanceIndex % size.x, uInstanceIndex / size.x), 0) * uColor;
+}
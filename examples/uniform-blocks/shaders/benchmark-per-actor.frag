@@ -0,0 +1,11 @@
+layout(std140) uniform FragmentBlock
+{
+  lowp vec4 uColor;
+  mediump vec4 uInstanceColor;
+};
+
+void main()
+{
+  // Color written to each actor every frame
+  fragColor = uInstanceColor * uColor;
+}
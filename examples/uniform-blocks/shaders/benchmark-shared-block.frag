@@ -0,0 +1,12 @@
+layout(std140) uniform FragmentBlock
+{
+  lowp vec4 uColor;
+  mediump vec4 uSharedColors[1024];
+  mediump int uInstanceIndex;
+};
+
+void main()
+{
+  // Colors written once per frame to the shader, actors only hold the index
+  fragColor = uSharedColors[uInstanceIndex] * uColor;
+}
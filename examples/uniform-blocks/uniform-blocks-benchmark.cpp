@@ -0,0 +1,359 @@
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include "uniform-blocks-benchmark.h"
+
+#include <dali/devel-api/common/stage.h>
+
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+
+#include "generated/benchmark-data-texture-frag.h"
+#include "generated/benchmark-per-actor-frag.h"
+#include "generated/benchmark-shared-block-frag.h"
+#include "generated/benchmark-vert.h"
+#include "shared/frame-stats.h"
+
+using namespace Dali;
+using Dali::Toolkit::TextLabel;
+
+namespace
+{
+const uint32_t ACTOR_COUNTS[] = {100u, 1000u, 10000u};
+const uint32_t ACTOR_COUNT_RUNS(sizeof(ACTOR_COUNTS) / sizeof(ACTOR_COUNTS[0]));
+const uint32_t MODE_COUNT(3u);
+
+const uint32_t TICK_INTERVAL(16u);       ///< Interval of writing instance data, in milliseconds
+const uint32_t WARM_UP_DURATION(1000u);  ///< Time before measuring, in milliseconds
+const uint32_t MEASURE_DURATION(3000u);  ///< Time of measuring, in milliseconds
+
+const uint32_t SHARED_BLOCK_SIZE(1024u); ///< Must match uSharedColors in benchmark-shared-block.frag
+const uint32_t DATA_TEXTURE_WIDTH(256u);
+
+const float ACTOR_SIZE(16.0f);
+
+const char* GetModeName(UniformBlocksBenchmark::Mode mode)
+{
+  switch(mode)
+  {
+    case UniformBlocksBenchmark::Mode::PER_ACTOR:
+      return "per actor";
+    case UniformBlocksBenchmark::Mode::SHARED_BLOCK:
+      return "shared block";
+    default:
+      return "data texture";
+  }
+}
+
+/**
+ * Color of the actor at the given time, cheap enough not to dominate the writes
+ */
+Vector4 GetInstanceColor(uint32_t index, float time)
+{
+  const float phase = time + float(index) * 0.01f;
+  return Vector4(0.5f + 0.5f * std::sin(phase), 0.5f + 0.5f * std::sin(phase + 2.1f), 0.5f + 0.5f * std::sin(phase + 4.2f), 1.0f);
+}
+} // namespace
+
+UniformBlocksBenchmark::UniformBlocksBenchmark(Application& application)
+: mApplication(application)
+{
+  mApplication.InitSignal().Connect(this, &UniformBlocksBenchmark::Create);
+}
+
+UniformBlocksBenchmark::~UniformBlocksBenchmark() = default;
+
+void UniformBlocksBenchmark::Create(Application& application)
+{
+  Window window = application.GetWindow();
+  window.SetBackgroundColor(Color::WHITE);
+  window.KeyEventSignal().Connect(this, &UniformBlocksBenchmark::OnKeyEvent);
+
+  // Same quad as the uniform blocks test
+  struct Vertex2D
+  {
+    Vector2 co;
+  };
+  const Vertex2D quad[] = {{Vector2(-0.5f, -0.5f)}, {Vector2(0.5f, -0.5f)}, {Vector2(0.5f, 0.5f)}, {Vector2(-0.5f, -0.5f)}, {Vector2(0.5f, 0.5f)}, {Vector2(-0.5f, 0.5f)}};
+
+  Property::Map attrMap{};
+  attrMap.Add("aPosition", Property::Type::VECTOR2);
+  VertexBuffer vb = VertexBuffer::New(attrMap);
+  vb.SetData(quad, 6);
+
+  mGeometry = Geometry::New();
+  mGeometry.SetType(Geometry::Type::TRIANGLES);
+  mGeometry.AddVertexBuffer(vb);
+
+  mLabel = TextLabel::New();
+  mLabel.SetProperty(Actor::Property::ANCHOR_POINT, AnchorPoint::TOP_LEFT);
+  mLabel.SetProperty(Actor::Property::PARENT_ORIGIN, ParentOrigin::TOP_LEFT);
+  mLabel.SetProperty(TextLabel::Property::MULTI_LINE, true);
+  window.Add(mLabel);
+
+  mFrameStats = std::make_unique<DemoHelper::FrameStats>();
+  DevelStage::AddFrameCallback(Stage::GetCurrent(), *mFrameStats, window.GetRootLayer());
+
+  printf("%-14s %8s %8s %16s %20s\n", "mode", "actors", "fps", "event ms/tick", "update+render ms");
+
+  StartRun();
+
+  mTimer = Timer::New(TICK_INTERVAL);
+  mTimer.TickSignal().Connect(this, &UniformBlocksBenchmark::OnTick);
+  mTimer.Start();
+}
+
+void UniformBlocksBenchmark::StartRun()
+{
+  const Mode     mode       = Mode(mRun / ACTOR_COUNT_RUNS);
+  const uint32_t actorCount = ACTOR_COUNTS[mRun % ACTOR_COUNT_RUNS];
+
+  UnparentAndReset(mContainer);
+  mActors.clear();
+  mColorIndices.clear();
+  mTexels.clear();
+  mDataTexture.Reset();
+
+  CreateRenderer(mode, actorCount);
+
+  mContainer = Actor::New();
+  mContainer.SetProperty(Actor::Property::ANCHOR_POINT, AnchorPoint::CENTER);
+  mContainer.SetProperty(Actor::Property::PARENT_ORIGIN, ParentOrigin::CENTER);
+
+  Vector2 windowSize(mApplication.GetWindow().GetSize());
+  windowSize -= Vector2(ACTOR_SIZE, ACTOR_SIZE);
+
+  mActors.reserve(actorCount);
+  for(uint32_t i = 0; i < actorCount; ++i)
+  {
+    Actor actor = Actor::New();
+    actor.SetProperty(Actor::Property::ANCHOR_POINT, AnchorPoint::CENTER);
+    actor.SetProperty(Actor::Property::PARENT_ORIGIN, ParentOrigin::CENTER);
+    actor.SetProperty(Actor::Property::POSITION, Vector3(Random::Range(-0.5f, 0.5f) * windowSize.x, Random::Range(-0.5f, 0.5f) * windowSize.y, 0.0f));
+    actor.SetProperty(Actor::Property::SIZE, Vector2(ACTOR_SIZE, ACTOR_SIZE));
+    actor.AddRenderer(mRenderer);
+
+    switch(mode)
+    {
+      case Mode::PER_ACTOR:
+      {
+        mColorIndices.push_back(actor.RegisterProperty("uInstanceColor", GetInstanceColor(i, 0.0f)));
+        break;
+      }
+      case Mode::SHARED_BLOCK:
+      {
+        actor.RegisterProperty("uInstanceIndex", int(i % SHARED_BLOCK_SIZE));
+        break;
+      }
+      case Mode::DATA_TEXTURE:
+      {
+        actor.RegisterProperty("uInstanceIndex", int(i));
+        break;
+      }
+    }
+
+    mContainer.Add(actor);
+    mActors.push_back(actor);
+  }
+
+  Window window = mApplication.GetWindow();
+  window.Add(mContainer);
+  mLabel.RaiseToTop();
+
+  char text[128];
+  snprintf(text, sizeof(text), "Run %u/%u\n%s, %u actors", mRun + 1, MODE_COUNT * ACTOR_COUNT_RUNS, GetModeName(mode), actorCount);
+  mLabel.SetProperty(TextLabel::Property::TEXT, text);
+
+  mMeasuring = false;
+  mRunStart  = std::chrono::steady_clock::now();
+}
+
+void UniformBlocksBenchmark::CreateRenderer(Mode mode, uint32_t actorCount)
+{
+  const char* fragmentShader = SHADER_BENCHMARK_PER_ACTOR_FRAG;
+  if(mode == Mode::SHARED_BLOCK)
+  {
+    fragmentShader = SHADER_BENCHMARK_SHARED_BLOCK_FRAG;
+  }
+  else if(mode == Mode::DATA_TEXTURE)
+  {
+    fragmentShader = SHADER_BENCHMARK_DATA_TEXTURE_FRAG;
+  }
+
+  mShader   = Shader::New(Dali::Shader::GetVertexShaderPrefix() + std::string(SHADER_BENCHMARK_VERT),
+                        Dali::Shader::GetFragmentShaderPrefix() + std::string(fragmentShader));
+  mRenderer = Renderer::New(mGeometry, mShader);
+
+  if(mode == Mode::SHARED_BLOCK)
+  {
+    // Actors beyond the size of the block share its entries
+    char buffer[32];
+    for(uint32_t i = 0; i < SHARED_BLOCK_SIZE; ++i)
+    {
+      snprintf(buffer, sizeof(buffer), "uSharedColors[%u]", i);
+      mColorIndices.push_back(mShader.RegisterProperty(buffer, GetInstanceColor(i, 0.0f)));
+    }
+  }
+  else if(mode == Mode::DATA_TEXTURE)
+  {
+    const uint32_t height = (actorCount + DATA_TEXTURE_WIDTH - 1) / DATA_TEXTURE_WIDTH;
+    mDataTexture          = Texture::New(TextureType::TEXTURE_2D, Pixel::RGBA8888, DATA_TEXTURE_WIDTH, height);
+    mTexels.resize(DATA_TEXTURE_WIDTH * height * 4u, 0u);
+
+    Sampler sampler = Sampler::New();
+    sampler.SetFilterMode(FilterMode::NEAREST, FilterMode::NEAREST);
+
+    TextureSet textureSet = TextureSet::New();
+    textureSet.SetTexture(0u, mDataTexture);
+    textureSet.SetSampler(0u, sampler);
+    mRenderer.SetTextures(textureSet);
+  }
+}
+
+void UniformBlocksBenchmark::WriteInstanceData(float time)
+{
+  const Mode mode = Mode(mRun / ACTOR_COUNT_RUNS);
+  switch(mode)
+  {
+    case Mode::PER_ACTOR:
+    {
+      for(uint32_t i = 0; i < mActors.size(); ++i)
+      {
+        mActors[i].SetProperty(mColorIndices[i], GetInstanceColor(i, time));
+      }
+      break;
+    }
+    case Mode::SHARED_BLOCK:
+    {
+      for(uint32_t i = 0; i < mColorIndices.size(); ++i)
+      {
+        mShader.SetProperty(mColorIndices[i], GetInstanceColor(i, time));
+      }
+      break;
+    }
+    case Mode::DATA_TEXTURE:
+    {
+      uint8_t* texel = mTexels.data();
+      for(uint32_t i = 0; i < mActors.size(); ++i, texel += 4)
+      {
+        const Vector4 color(GetInstanceColor(i, time));
+        texel[0] = uint8_t(color.r * 255.0f);
+        texel[1] = uint8_t(color.g * 255.0f);
+        texel[2] = uint8_t(color.b * 255.0f);
+        texel[3] = uint8_t(color.a * 255.0f);
+      }
+
+      // PixelData takes ownership of the copy
+      const uint32_t size   = mTexels.size();
+      uint8_t*       buffer = new uint8_t[size];
+      memcpy(buffer, mTexels.data(), size);
+      PixelData pixelData = PixelData::New(buffer, size, mDataTexture.GetWidth(), mDataTexture.GetHeight(), Pixel::RGBA8888, PixelData::DELETE_ARRAY);
+      mDataTexture.Upload(pixelData);
+      break;
+    }
+  }
+}
+
+bool UniformBlocksBenchmark::OnTick()
+{
+  const auto now = std::chrono::steady_clock::now();
+
+  const auto start = std::chrono::steady_clock::now();
+  WriteInstanceData(std::chrono::duration<float>(now - mRunStart).count());
+  const auto end = std::chrono::steady_clock::now();
+
+  if(!mMeasuring)
+  {
+    if(now - mRunStart >= std::chrono::milliseconds(WARM_UP_DURATION))
+    {
+      // Drop whatever has been counted during the warm-up
+      mFrameStats->Reset();
+
+      mMeasuring    = true;
+      mMeasureStart = now;
+      mEventTimeUs  = 0u;
+      mTicks        = 0u;
+    }
+    return true;
+  }
+
+  mEventTimeUs += std::chrono::duration_cast<std::chrono::microseconds>(end - start).count();
+  ++mTicks;
+
+  if(now - mMeasureStart < std::chrono::milliseconds(MEASURE_DURATION))
+  {
+    return true;
+  }
+
+  const DemoHelper::FrameStats::Sample stats = mFrameStats->Reset();
+
+  Result result;
+  result.mode         = Mode(mRun / ACTOR_COUNT_RUNS);
+  result.actorCount   = ACTOR_COUNTS[mRun % ACTOR_COUNT_RUNS];
+  result.fps          = stats.elapsedUs ? stats.frames * 1000000.0f / stats.elapsedUs : 0.0f;
+  result.eventTimeMs  = mTicks ? mEventTimeUs / 1000.0f / mTicks : 0.0f;
+  result.updateTimeMs = stats.GetAverageUpdateMs();
+  mResults.push_back(result);
+
+  printf("%-14s %8u %8.1f %16.3f %20.3f\n", GetModeName(result.mode), result.actorCount, result.fps, result.eventTimeMs, result.updateTimeMs);
+  fflush(stdout);
+
+  if(++mRun < MODE_COUNT * ACTOR_COUNT_RUNS)
+  {
+    StartRun();
+    return true;
+  }
+
+  PrintSummary();
+  mApplication.Quit();
+  return false;
+}
+
+void UniformBlocksBenchmark::PrintSummary() const
+{
+  // Update/render thread time per frame, one row per actor count
+  printf("\nupdate+render thread ms per frame (fps)\n%8s", "actors");
+  for(uint32_t mode = 0; mode < MODE_COUNT; ++mode)
+  {
+    printf(" %22s", GetModeName(Mode(mode)));
+  }
+  printf("\n");
+
+  for(uint32_t count = 0; count < ACTOR_COUNT_RUNS; ++count)
+  {
+    printf("%8u", ACTOR_COUNTS[count]);
+    for(uint32_t mode = 0; mode < MODE_COUNT; ++mode)
+    {
+      const Result& result = mResults[mode * ACTOR_COUNT_RUNS + count];
+      printf(" %13.3f (%5.1f)", result.updateTimeMs, result.fps);
+    }
+    printf("\n");
+  }
+  fflush(stdout);
+}
+
+void UniformBlocksBenchmark::OnKeyEvent(const KeyEvent& event)
+{
+  if(event.GetState() == KeyEvent::DOWN)
+  {
+    if(IsKey(event, Dali::DALI_KEY_ESCAPE) || IsKey(event, Dali::DALI_KEY_BACK))
+    {
+      mApplication.Quit();
+    }
+  }
+}
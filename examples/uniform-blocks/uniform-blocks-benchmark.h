@@ -0,0 +1,121 @@
+#ifndef DALI_DEMO_UNIFORM_BLOCKS_BENCHMARK_H
+#define DALI_DEMO_UNIFORM_BLOCKS_BENCHMARK_H
+
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <dali-toolkit/dali-toolkit.h>
+
+#include <chrono>
+#include <memory>
+#include <vector>
+
+namespace DemoHelper
+{
+class FrameStats;
+}
+
+/**
+ * Compares ways of feeding per-instance data to many actors sharing one renderer.
+ *
+ * For every mode and actor count the scene is rebuilt, the color of every actor is written
+ * on each tick of a frame-rate timer, and after a warm-up the following are measured:
+ *  - event thread time spent writing the data, per tick,
+ *  - CPU time of the update/render thread per frame, and the frame rate.
+ * A line is printed per run and a summary table at the end, then the application quits.
+ */
+class UniformBlocksBenchmark : public Dali::ConnectionTracker
+{
+public:
+  /**
+   * Ways of passing the per-instance color
+   */
+  enum class Mode
+  {
+    PER_ACTOR,    ///< Uniform property registered and written on each actor
+    SHARED_BLOCK, ///< Uniform array registered on the shader, actors hold an index into it
+    DATA_TEXTURE  ///< Texel per actor uploaded once per frame, actors hold an index into it
+  };
+
+  UniformBlocksBenchmark(Dali::Application& application);
+
+  ~UniformBlocksBenchmark();
+
+private:
+  /**
+   * Result of a single run
+   */
+  struct Result
+  {
+    Mode     mode;
+    uint32_t actorCount;
+    float    fps;
+    float    eventTimeMs;  ///< Event thread time writing data, per tick
+    float    updateTimeMs; ///< Update/render thread CPU time, per frame
+  };
+
+  void Create(Dali::Application& application);
+
+  /**
+   * Rebuilds the scene for the current run
+   */
+  void StartRun();
+
+  /**
+   * Creates shader and renderer shared by all the actors of the run
+   */
+  void CreateRenderer(Mode mode, uint32_t actorCount);
+
+  /**
+   * Writes colors of all actors for the given time
+   */
+  void WriteInstanceData(float time);
+
+  bool OnTick();
+
+  void OnKeyEvent(const Dali::KeyEvent& event);
+
+  void PrintSummary() const;
+
+private:
+  Dali::Application& mApplication;
+
+  Dali::Geometry   mGeometry;
+  Dali::Shader     mShader;
+  Dali::Renderer   mRenderer;
+  Dali::Texture    mDataTexture;
+  Dali::Actor      mContainer;
+  Dali::Timer      mTimer;
+  Dali::Toolkit::TextLabel mLabel;
+
+  std::vector<Dali::Actor>           mActors;
+  std::vector<Dali::Property::Index> mColorIndices; ///< Per actor or shader property indices of the colors
+  std::vector<uint8_t>               mTexels;
+
+  std::unique_ptr<DemoHelper::FrameStats> mFrameStats;
+
+  std::vector<Result> mResults;
+  uint32_t            mRun{0u};
+  bool                mMeasuring{false};
+
+  std::chrono::steady_clock::time_point mRunStart;
+  std::chrono::steady_clock::time_point mMeasureStart;
+  uint64_t                              mEventTimeUs{0u};
+  uint32_t                              mTicks{0u};
+};
+
+#endif // DALI_DEMO_UNIFORM_BLOCKS_BENCHMARK_H
@@ -17,6 +17,10 @@
 
 #include <dali-toolkit/dali-toolkit.h>
 
+#include <iostream>
+
+#include "uniform-blocks-benchmark.h"
+
 #include "generated/uniform-block-vert.h"
 #include "generated/uniform-block-frag.h"
 #include "generated/uniform-block-alt-frag.h"
@@ -205,8 +209,34 @@ private:
 
 int DALI_EXPORT_API main(int argc, char** argv)
 {
-  Application          application = Application::New(&argc, &argv);
-  UniformBlocksController test(application);
-  application.MainLoop();
+  bool benchmark = false;
+
+  for(int i = 1; i < argc; ++i)
+  {
+    std::string arg(argv[i]);
+    if(arg == "--benchmark")
+    {
+      benchmark = true;
+    }
+    else if(arg == "-h" || arg == "--help")
+    {
+      std::cout << "uniform-blocks.example [options]" << std::endl;
+      std::cout << "  --benchmark  Compare per-actor uniforms, a shared uniform array and a data texture" << std::endl;
+      std::cout << "               for 100, 1000 and 10000 actors, print the results and quit" << std::endl;
+      return 0;
+    }
+  }
+
+  Application application = Application::New(&argc, &argv);
+  if(benchmark)
+  {
+    UniformBlocksBenchmark test(application);
+    application.MainLoop();
+  }
+  else
+  {
+    UniformBlocksController test(application);
+    application.MainLoop();
+  }
   return 0;
 }
@@ -22,6 +22,7 @@ uniform float uParallaxAmount;
 
 attribute vec2 aPosition;
 attribute vec2 aTexCoord;
+attribute vec2 aStitch; // offset to the neighbours on the edge of a coarser LOD band
 
 varying vec2 vUv;
 varying vec3 vViewPos;
@@ -88,7 +89,17 @@ void main()
   vec2 scrollPosition = aPosition * uScrollScale + vec2(0., uTime * -kPi);
   vNormal = uNormalMatrix * CalculateNormal(scrollPosition);
 
-  float h = CalculateHeight(scrollPosition);
+  float h;
+  if(dot(aStitch, aStitch) > 0.)
+  {
+    // Lie on the edge of the coarser band, between the neighbours.
+    vec2 stitch = aStitch * uScrollScale;
+    h = (CalculateHeight(scrollPosition - stitch) + CalculateHeight(scrollPosition + stitch)) * .5;
+  }
+  else
+  {
+    h = CalculateHeight(scrollPosition);
+  }
   vHeight = h * uParallaxAmount;
   vec3 position = vec3(aPosition.x, h, aPosition.y);
 
@@ -16,6 +16,7 @@
  */
 #include "utils.h"
 #include <fstream>
+#include <limits>
 #include "dali-toolkit/dali-toolkit.h"
 
 using namespace Dali;
@@ -196,6 +197,113 @@ Geometry CreateTesselatedQuad(unsigned int xVerts, unsigned int yVerts, Vector2
   return geom;
 }
 
+unsigned int GetLodGridVertexCount(const std::vector<LodBand>& bands)
+{
+  unsigned int numVerts = 0;
+  for(auto& band : bands)
+  {
+    numVerts += band.xVerts * band.rows.size();
+  }
+  return numVerts;
+}
+
+Geometry CreateLodGrid(const std::vector<LodBand>& bands, Vector2 scale, VertexFn positionFn, VertexFn texCoordFn)
+{
+  DALI_ASSERT_DEBUG(!bands.empty());
+  struct Vertex
+  {
+    Vector2 aPosition;
+    Vector2 aTexCoord;
+    Vector2 aStitch;
+  };
+  std::vector<Vertex> vertices;
+  vertices.reserve(GetLodGridVertexCount(bands));
+
+  std::vector<uint16_t> indices;
+
+  for(unsigned int b = 0; b < bands.size(); ++b)
+  {
+    const LodBand& band   = bands[b];
+    unsigned int   xVerts = band.xVerts;
+    unsigned int   yVerts = band.rows.size();
+    DALI_ASSERT_DEBUG(xVerts > 1 && yVerts > 1);
+    DALI_ASSERT_DEBUG(vertices.size() + xVerts * yVerts <= std::numeric_limits<uint16_t>::max());
+
+    // Boundary rows are stitched if the neighbouring band is coarser.
+    bool stitchFirst = b > 0 && bands[b - 1].xVerts < xVerts;
+    bool stitchLast  = b + 1 < bands.size() && bands[b + 1].xVerts < xVerts;
+
+    float    dx       = 1.f / (xVerts - 1);
+    uint16_t iVertex0 = vertices.size();
+    for(unsigned int i = 0; i < yVerts; ++i)
+    {
+      Vector2 pos{0.f, band.rows[i]};
+      for(unsigned int j = 0; j < xVerts; ++j)
+      {
+        auto vPos = pos + Vector2{-.5f, -.5f};
+        vertices.push_back(Vertex{(positionFn ? positionFn(vPos) : vPos) * scale,
+                                  texCoordFn ? texCoordFn(pos) : pos,
+                                  Vector2::ZERO});
+        pos.x += dx;
+      }
+
+      if((i == 0 && stitchFirst) || (i == yVerts - 1 && stitchLast))
+      {
+        // Move odd vertices to the middle of the edge between their neighbours, which
+        // are the vertices of the coarser band.
+        Vertex* row = vertices.data() + vertices.size() - xVerts;
+        for(unsigned int j = 1; j < xVerts - 1; j += 2)
+        {
+          row[j].aPosition = (row[j - 1].aPosition + row[j + 1].aPosition) * .5f;
+          row[j].aTexCoord = (row[j - 1].aTexCoord + row[j + 1].aTexCoord) * .5f;
+          row[j].aStitch   = (row[j + 1].aPosition - row[j - 1].aPosition) * .5f;
+        }
+      }
+    }
+
+    for(unsigned int i = 1; i < yVerts; ++i)
+    {
+      if((i & 1) == 0)
+      {
+        for(unsigned int j = 1; j < xVerts; ++j)
+        {
+          int iBase = iVertex0 + i * xVerts + j;
+          indices.push_back(iBase);
+          indices.push_back(iBase - 1);
+          indices.push_back(iBase - xVerts - 1);
+          indices.push_back(indices.back());
+          indices.push_back(iBase - xVerts);
+          indices.push_back(iBase);
+        }
+      }
+      else
+      {
+        for(unsigned int j = 1; j < xVerts; ++j)
+        {
+          int iBase = iVertex0 + i * xVerts + j;
+          indices.push_back(iBase);
+          indices.push_back(iBase - 1);
+          indices.push_back(iBase - xVerts);
+          indices.push_back(indices.back());
+          indices.push_back(iBase - 1);
+          indices.push_back(iBase - xVerts - 1);
+        }
+      }
+    }
+  }
+
+  VertexBuffer vertexBuffer = VertexBuffer::New(Property::Map()
+                                                  .Add("aPosition", Property::VECTOR2)
+                                                  .Add("aTexCoord", Property::VECTOR2)
+                                                  .Add("aStitch", Property::VECTOR2));
+  vertexBuffer.SetData(vertices.data(), vertices.size());
+
+  Geometry geom = Geometry::New();
+  geom.AddVertexBuffer(vertexBuffer);
+  geom.SetIndexBuffer(indices.data(), indices.size());
+  return geom;
+}
+
 Texture LoadTexture(const std::string& path)
 {
   PixelData pixelData = SyncImageLoader::Load(path);
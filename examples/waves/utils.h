@@ -17,6 +17,7 @@
  *
  */
 #include <cmath>
+#include <vector>
 #include "dali/public-api/actors/actor.h"
 #include "dali/public-api/math/vector3.h"
 #include "dali/public-api/rendering/geometry.h"
@@ -75,6 +76,24 @@ using VertexFn = Dali::Vector2 (*)(const Dali::Vector2&);
 /// After returning from the shader, they're transformed
 Dali::Geometry CreateTesselatedQuad(unsigned int xVerts, unsigned int yVerts, Dali::Vector2 scale, VertexFn positionFn = nullptr, VertexFn texCoordFn = nullptr);
 
+///@brief A horizontal band of a level of detail grid, created by CreateLodGrid().
+struct LodBand
+{
+  std::vector<float> rows;   ///< y coordinate of each row of vertices, ascending, in the 0..1 range.
+  unsigned int       xVerts; ///< number of vertices in each row.
+};
+
+///@brief Creates a grid made of @a bands, each with its own tesselation, covering the
+/// same range as CreateTesselatedQuad(). Adjacent bands must share their boundary row and
+/// the number of quads per row may only differ by a factor of 2. The odd vertices on the
+/// boundary row of the denser band are stitched: their aStitch attribute holds the offset
+/// to their neighbours, so that the shader can place them on the edge of the coarser band.
+///@note @a positionFn is expected to be linear along rows.
+Dali::Geometry CreateLodGrid(const std::vector<LodBand>& bands, Dali::Vector2 scale, VertexFn positionFn = nullptr, VertexFn texCoordFn = nullptr);
+
+///@brief Returns the number of vertices that CreateLodGrid() creates for @a bands.
+unsigned int GetLodGridVertexCount(const std::vector<LodBand>& bands);
+
 Dali::Texture LoadTexture(const std::string& path);
 
 enum RendererOptions
@@ -16,8 +16,10 @@
  */
 
 // INTERNAL INCLUDES
+#include <algorithm>
 #include <fstream>
 #include <iostream>
+#include <limits>
 #include <numeric>
 #include "dali/devel-api/adaptor-framework/tilt-sensor.h"
 #include "dali/public-api/actors/camera-actor.h"
@@ -72,6 +74,29 @@ const float TRANSITION_TIME_SCALE = 6.f;
 
 const std::string_view NORMAL_MAP_NAME = "noise512.png";
 
+const Vector2 GRID_SCALE{.25f, 3.8f};
+
+const unsigned int FIXED_GRID_X_VERTS = 16;
+const unsigned int FIXED_GRID_Y_VERTS = 64;
+
+const unsigned int DEFAULT_VERTEX_BUDGET = FIXED_GRID_X_VERTS * FIXED_GRID_Y_VERTS;
+const unsigned int DEFAULT_LOD_BANDS     = 3;
+const unsigned int MAX_LOD_BANDS         = 8;
+
+const unsigned int LOD_SAMPLES     = 128;   // samples along the grid used to measure its projection
+const float        LOD_CELL_GROWTH = 1.05f; // growth of the target cell size until the budget is met
+
+unsigned int gVertexBudget = DEFAULT_VERTEX_BUDGET;
+unsigned int gLodBands     = DEFAULT_LOD_BANDS;
+bool         gFixedGrid    = false;
+
+///@brief Shape of the waves surface; @a v is in the [{ -.5f, -.5f }, { .5f, .5f }] range.
+Vector2 WavesPosition(const Vector2& v)
+{
+  float x = v.x + v.x * (1.f - v.y) * 5.5f;
+  return Vector2{x, v.y - .24f}; // further translation
+}
+
 Vector3 RandomColor()
 {
   float r = .5f + (rand() % RAND_MAX) / float(RAND_MAX) * .5f;
@@ -128,8 +153,9 @@ private:
 
   CameraActor mCamera; // no ownership
 
-  Actor  mWaves;
-  Shader mWaveShader;
+  Actor    mWaves;
+  Renderer mWavesRenderer;
+  Shader   mWaveShader;
 
   Property::Index mUInvLightDir{Property::INVALID_INDEX};
   Property::Index mULightColorSqr{Property::INVALID_INDEX};
@@ -171,17 +197,6 @@ private:
 
     auto shader = CreateShader();
 
-    // Create geometry
-    Geometry geom = CreateTesselatedQuad(
-      16, 64, Vector2{.25f, 3.8f}, [](const Vector2& v) {
-      float y = v.y + .5f;  // 0..1
-      y = std::sqrt(y) - .5f; // perspective correction - increase vertex density closer to viewer
-
-      float x = v.x + v.x * (1.f - y) * 5.5f;
-
-      y -= .24f;  // further translation
-      return Vector2{ x, y }; }, [](const Vector2& v) { return Vector2{v.x, std::sqrt(v.y)}; });
-
     // Create texture
     auto normalMap = LoadTexture(std::string(DEMO_IMAGE_DIR) + NORMAL_MAP_NAME.data());
 
@@ -193,19 +208,23 @@ private:
     sampler.SetWrapMode(WrapMode::REPEAT, WrapMode::REPEAT);
     textures.SetSampler(0, sampler);
 
-    // Create renderer
-    Renderer renderer = CreateRenderer(textures, geom, shader, OPTION_DEPTH_TEST | OPTION_DEPTH_WRITE);
-
     auto waves = CreateActor();
     auto size  = Vector2(window.GetSize());
     waves.SetProperty(Actor::Property::SIZE, Vector3(size.x, 100.f, size.y));
     waves.SetProperty(Actor::Property::ORIENTATION, baseOrientation);
     waves.SetProperty(Actor::Property::COLOR, WAVES_COLOR);
-    waves.AddRenderer(renderer);
 
     window.Add(waves);
     mWaves = waves;
 
+    // Create geometry - the level of detail depends on the orientation of the waves.
+    Geometry geom = CreateGrid();
+
+    // Create renderer
+    Renderer renderer = CreateRenderer(textures, geom, shader, OPTION_DEPTH_TEST | OPTION_DEPTH_WRITE);
+    waves.AddRenderer(renderer);
+    mWavesRenderer = renderer;
+
     window.KeyEventSignal().Connect(this, &WavesExample::OnKeyEvent);
 
     // Setup double tap detector for color change
@@ -246,9 +265,149 @@ private:
     mDoubleTapGesture.Reset();
     mPanGesture.Reset();
 
+    mWavesRenderer.Reset();
     UnparentAndReset(mWaves);
   }
 
+  Geometry CreateGrid()
+  {
+    if(gFixedGrid)
+    {
+      std::cout << "Waves fixed grid: " << FIXED_GRID_X_VERTS * FIXED_GRID_Y_VERTS << " vertices" << std::endl;
+      return CreateTesselatedQuad(
+        FIXED_GRID_X_VERTS, FIXED_GRID_Y_VERTS, GRID_SCALE, [](const Vector2& v) {
+        float y = v.y + .5f;  // 0..1
+        y = std::sqrt(y) - .5f; // perspective correction - increase vertex density closer to viewer
+        return WavesPosition(Vector2{v.x, y}); }, [](const Vector2& v) { return Vector2{v.x, std::sqrt(v.y)}; });
+    }
+
+    std::vector<LodBand> bands = SelectLodBands(gVertexBudget, gLodBands);
+
+    std::cout << "Waves LOD grid: " << GetLodGridVertexCount(bands) << " vertices (budget " << gVertexBudget << "), bands (rows x columns):";
+    for(auto& band : bands)
+    {
+      std::cout << " " << band.rows.size() << "x" << band.xVerts;
+    }
+    std::cout << std::endl;
+
+    return CreateLodGrid(bands, GRID_SCALE, WavesPosition);
+  }
+
+  ///@brief Splits the grid into @a numBands bands of equal height on screen, for the
+  /// current orientation of the waves and the camera. Rows are evenly spaced on screen,
+  /// and columns are halved in bands that are narrower on screen, so that quads are of
+  /// similar size everywhere. The size of the quads is the smallest that fits the grid
+  /// within @a budget vertices.
+  std::vector<LodBand> SelectLodBands(unsigned int budget, unsigned int numBands)
+  {
+    Vector2 windowSize(mApp.GetWindow().GetSize());
+    float   fieldOfView = mCamera.GetProperty<float>(CameraActor::Property::FIELD_OF_VIEW);
+    float   focalLength = windowSize.y * .5f / std::tan(fieldOfView * .5f);
+    Vector3 cameraPos   = mCamera.GetProperty<Vector3>(Actor::Property::POSITION);
+    if(cameraPos.z <= 0.f)
+    {
+      cameraPos = Vector3(0.f, 0.f, focalLength);
+    }
+
+    Vector3    size        = mWaves.GetProperty<Vector3>(Actor::Property::SIZE);
+    Quaternion orientation = mWaves.GetProperty<Quaternion>(Actor::Property::ORIENTATION);
+    auto       project     = [&](float x, float y) {
+      Vector2 pos   = WavesPosition(Vector2{x - .5f, y - .5f}) * GRID_SCALE;
+      Vector3 world = orientation.Rotate(Vector3(pos.x * size.x, 0.f, pos.y * size.z));
+      float   depth = std::max(cameraPos.z - world.z, 1.f);
+      return Vector2(world.x - cameraPos.x, world.y - cameraPos.y) * (focalLength / depth);
+    };
+
+    // Measure the length of the grid on screen along its centre, and its width.
+    float length[LOD_SAMPLES + 1];
+    float width[LOD_SAMPLES + 1];
+    float area = 0.f;
+    Vector2 prevCentre;
+    for(unsigned int i = 0; i <= LOD_SAMPLES; ++i)
+    {
+      float   y      = float(i) / LOD_SAMPLES;
+      Vector2 centre = project(.5f, y);
+      width[i]       = (project(1.f, y) - project(0.f, y)).Length();
+      length[i]      = i > 0 ? length[i - 1] + (centre - prevCentre).Length() : 0.f;
+      area += i > 0 ? (width[i] + width[i - 1]) * .5f * (length[i] - length[i - 1]) : 0.f;
+      prevCentre = centre;
+    }
+
+    auto yAtLength = [&](float l) {
+      auto  i0 = std::min(unsigned(std::lower_bound(length + 1, length + LOD_SAMPLES, l) - length), LOD_SAMPLES) - 1;
+      float dl = length[i0 + 1] - length[i0];
+      float t  = dl > 0.f ? std::min(std::max((l - length[i0]) / dl, 0.f), 1.f) : 0.f;
+      return (i0 + t) / LOD_SAMPLES;
+    };
+
+    float totalLength = length[LOD_SAMPLES];
+    float bandLength  = totalLength / numBands;
+
+    std::vector<float> boundaries(numBands + 1);
+    std::vector<float> maxWidths(numBands, 0.f);
+    for(unsigned int b = 0; b <= numBands; ++b)
+    {
+      boundaries[b] = b == numBands ? 1.f : yAtLength(bandLength * b);
+    }
+    for(unsigned int i = 0; i <= LOD_SAMPLES; ++i)
+    {
+      unsigned int b = std::min(unsigned(length[i] / std::max(bandLength, 1.f)), numBands - 1);
+      maxWidths[b]   = std::max(maxWidths[b], width[i]);
+    }
+
+    // Grow the target size of the quads until the grid fits in the budget.
+    std::vector<int>          levels(numBands);
+    std::vector<unsigned int> yVerts(numBands);
+    float                     cellSize = std::max(std::sqrt(area / budget) * .5f, 1.f);
+    for(;;)
+    {
+      for(unsigned int b = 0; b < numBands; ++b)
+      {
+        levels[b] = std::max(int(std::round(std::log2(std::max(maxWidths[b] / cellSize, 1.f)))), 0);
+        yVerts[b] = std::max(unsigned(std::ceil(bandLength / cellSize)), 1u) + 1;
+      }
+
+      // Neighbouring bands may differ by one level only.
+      for(unsigned int b = 1; b < numBands; ++b)
+      {
+        levels[b] = std::min(levels[b], levels[b - 1] + 1);
+      }
+      for(unsigned int b = numBands - 1; b > 0; --b)
+      {
+        levels[b - 1] = std::min(levels[b - 1], levels[b] + 1);
+      }
+
+      unsigned int numVerts = 0;
+      bool         coarsest = true;
+      for(unsigned int b = 0; b < numBands; ++b)
+      {
+        numVerts += ((1u << levels[b]) + 1) * yVerts[b];
+        coarsest = coarsest && levels[b] == 0 && yVerts[b] == 2;
+      }
+
+      if(numVerts <= budget || coarsest)
+      {
+        break;
+      }
+      cellSize *= LOD_CELL_GROWTH;
+    }
+
+    std::vector<LodBand> bands(numBands);
+    for(unsigned int b = 0; b < numBands; ++b)
+    {
+      LodBand& band = bands[b];
+      band.xVerts   = (1u << levels[b]) + 1;
+      band.rows.resize(yVerts[b]);
+      for(unsigned int i = 0; i < yVerts[b]; ++i)
+      {
+        band.rows[i] = yAtLength(bandLength * (b + float(i) / (yVerts[b] - 1)));
+      }
+      band.rows.front() = boundaries[b];
+      band.rows.back()  = boundaries[b + 1];
+    }
+    return bands;
+  }
+
   Shader CreateShader()
   {
     Vector3 lightColorSqr{LIGHT_COLOR};
@@ -342,6 +501,12 @@ private:
       {
         mApp.Quit();
       }
+      else if(event.GetKeyName() == "l")
+      {
+        // Switch between the level of detail and the fixed grid.
+        gFixedGrid = !gFixedGrid;
+        mWavesRenderer.SetGeometry(CreateGrid());
+      }
     }
   }
 
@@ -389,6 +554,44 @@ private:
 
 int DALI_EXPORT_API main(int argc, char** argv)
 {
+  for(int i(1); i < argc; ++i)
+  {
+    std::string arg(argv[i]);
+    if(arg.compare("--fixed-grid") == 0)
+    {
+      gFixedGrid = true;
+    }
+    else if(arg.compare(0, 2, "-v") == 0)
+    {
+      auto budget = atoi(arg.substr(2, arg.size()).c_str());
+      if(budget > 0)
+      {
+        gVertexBudget = std::min(unsigned(budget), unsigned(std::numeric_limits<uint16_t>::max()));
+      }
+    }
+    else if(arg.compare(0, 2, "-l") == 0)
+    {
+      auto bands = atoi(arg.substr(2, arg.size()).c_str());
+      if(bands > 0)
+      {
+        gLodBands = std::min(unsigned(bands), MAX_LOD_BANDS);
+      }
+    }
+    else if((arg.compare("--help") == 0) || (arg.compare("-h") == 0))
+    {
+      std::cout << "waves.example [OPTIONS]" << std::endl;
+      std::cout << "  Options:" << std::endl;
+      std::cout << "    -v[count]     Vertex budget of the level of detail grid, i.e. -v2048. Default is " << DEFAULT_VERTEX_BUDGET << "." << std::endl;
+      std::cout << "    -l[bands]     Number of level of detail bands, up to " << MAX_LOD_BANDS << ", i.e. -l4. Default is " << DEFAULT_LOD_BANDS << "." << std::endl;
+      std::cout << "    --fixed-grid  Starts with the fixed grid; 'l' switches between the grids." << std::endl;
+      std::cout << "    -h|--help     Help" << std::endl;
+      return 0;
+    }
+  }
+
+  // The coarsest grid has 2x2 vertices per band.
+  gVertexBudget = std::max(gVertexBudget, gLodBands * 4);
+
   Application  application = Application::New(&argc, &argv, DEMO_THEME_PATH);
   WavesExample example(application);
   application.MainLoop();
@@ -179,6 +179,7 @@ exit 0
 %{dali_app_exe_dir}/dali-tests
 %{dali_app_exe_dir}/*.example
 %{dali_app_exe_dir}/dali-builder
+%{dali_app_exe_dir}/scene-baker
 %if "%{?build_example_name}" == ""
 %{dali_app_res_dir}/images/*
 %{dali_app_res_dir}/game/*
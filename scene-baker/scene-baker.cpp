@@ -0,0 +1,632 @@
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+//------------------------------------------------------------------------------
+//
+// Bake a .gltf / .glb / .dli model into a .dsb file
+//
+//  - loads the model with the Scene3D ModelLoader, as the examples do at runtime
+//  - interleaves the vertices, widens the indices to 32 bits, decodes the
+//    textures to RGBA8888 and flattens the nodes into a table
+//  - writes the layout described in shared/baked-scene-format.h
+//  - reports the time taken to parse and decode the text model; the runtime cost
+//    of both formats is compared by the ready times scene3d-model logs
+//
+//    ie run
+//       scene-baker DamagedHelmet.glb DamagedHelmet.dsb
+//
+//       and copy the .dsb next to the model; the scene3d-model example loads it with --baked
+//
+// Skinning, blend shapes and animations aren't baked; such meshes keep their rest pose.
+//
+//------------------------------------------------------------------------------
+
+#include <dali-scene3d/dali-scene3d.h>
+#include <dali/dali.h>
+#include <dali/devel-api/adaptor-framework/image-loading.h>
+#include <dali/devel-api/adaptor-framework/pixel-buffer.h>
+#include <algorithm>
+#include <cfloat>
+#include <chrono>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <map>
+#include <string>
+#include <vector>
+
+#include "shared/baked-scene-format.h"
+#include "shared/utility.h"
+
+using namespace Dali;
+using namespace Dali::Scene3D::Loader;
+using DemoHelper::MillisecondsSince;
+
+namespace
+{
+std::string GetDirectory(const std::string& path)
+{
+  auto slash = path.find_last_of('/');
+  return slash == std::string::npos ? std::string("./") : path.substr(0, slash + 1u);
+}
+
+bool HasExtension(const std::string& path, const char* extension)
+{
+  const size_t length = strlen(extension);
+  if(path.size() < length)
+  {
+    return false;
+  }
+  std::string ending = path.substr(path.size() - length);
+  std::transform(ending.begin(), ending.end(), ending.begin(), ::tolower);
+  return ending == extension;
+}
+
+/**
+ * Bakes the loaded scene into the file layout.
+ */
+class SceneBaker
+{
+public:
+  SceneBaker(LoadResult& loadResult, ResourceBundle::PathProvider& pathProvider)
+  : mLoadResult(loadResult),
+    mPathProvider(pathProvider)
+  {
+  }
+
+  void Bake()
+  {
+    for(auto& mesh : mLoadResult.mResources.mMeshes)
+    {
+      BakeMesh(mesh.first);
+    }
+
+    for(auto& material : mLoadResult.mResources.mMaterials)
+    {
+      BakeMaterial(material.first);
+    }
+
+    for(auto iRoot : mLoadResult.mScene.GetRoots())
+    {
+      BakeNode(iRoot, BakedScene::INVALID_INDEX, Matrix::IDENTITY);
+    }
+  }
+
+  bool Write(const std::string& path)
+  {
+    using namespace BakedScene;
+
+    Header header{};
+    memcpy(header.magic, MAGIC, sizeof(MAGIC));
+    header.version = VERSION;
+    for(int i = 0; i < 3; ++i)
+    {
+      header.boundsMin[i] = mBoundsMin[i];
+      header.boundsMax[i] = mBoundsMax[i];
+    }
+
+    uint32_t offset = sizeof(Header);
+    auto     place  = [&offset](Section& section, uint32_t count, size_t itemSize)
+    {
+      offset         = AlignSection(offset);
+      section.offset = offset;
+      section.count  = count;
+      offset += count * itemSize;
+    };
+    place(header.nodes, mNodes.size(), sizeof(Node));
+    place(header.primitives, mPrimitives.size(), sizeof(Primitive));
+    place(header.meshes, mMeshes.size(), sizeof(Mesh));
+    place(header.materials, mMaterials.size(), sizeof(Material));
+    place(header.textures, mTextures.size(), sizeof(Texture));
+    place(header.data, mData.size(), 1u);
+    place(header.names, mNames.size(), 1u);
+    header.fileSize = offset;
+
+    std::vector<uint8_t> file(header.fileSize, 0u);
+    auto                 copy = [&file](const Section& section, const void* items, size_t itemSize)
+    {
+      if(section.count > 0u)
+      {
+        memcpy(file.data() + section.offset, items, section.count * itemSize);
+      }
+    };
+    memcpy(file.data(), &header, sizeof(Header));
+    copy(header.nodes, mNodes.data(), sizeof(Node));
+    copy(header.primitives, mPrimitives.data(), sizeof(Primitive));
+    copy(header.meshes, mMeshes.data(), sizeof(Mesh));
+    copy(header.materials, mMaterials.data(), sizeof(Material));
+    copy(header.textures, mTextures.data(), sizeof(Texture));
+    copy(header.data, mData.data(), 1u);
+    copy(header.names, mNames.data(), 1u);
+
+    std::ofstream stream(path, std::ios::binary);
+    stream.write(reinterpret_cast<const char*>(file.data()), file.size());
+    return stream.good();
+  }
+
+  void PrintSummary() const
+  {
+    std::cout << "  nodes: " << mNodes.size() << ", meshes: " << mMeshes.size() << ", materials: " << mMaterials.size()
+              << ", textures: " << mTextures.size() << ", data: " << mData.size() / 1024u << "KB" << std::endl;
+  }
+
+private:
+  /**
+   * Appends to the data, aligned for 32-bit reads
+   */
+  uint32_t AppendData(const void* data, size_t size)
+  {
+    const uint32_t offset = (mData.size() + 3u) & ~3u;
+    mData.resize(offset + size);
+    memcpy(mData.data() + offset, data, size);
+    return offset;
+  }
+
+  uint32_t AppendName(const std::string& name)
+  {
+    const uint32_t offset = mNames.size();
+    mNames.insert(mNames.end(), name.begin(), name.end());
+    mNames.push_back('\0');
+    return offset;
+  }
+
+  void BakeMesh(MeshDefinition& definition)
+  {
+    BakedScene::Mesh mesh{};
+    mesh.primitiveType = definition.mPrimitiveType;
+
+    if(definition.IsSkinned() || definition.HasBlendShapes())
+    {
+      std::cout << "  warning: skinning and blend shapes of " << definition.mUri << " aren't baked" << std::endl;
+    }
+
+    MeshDefinition::RawData raw = definition.LoadRaw(mPathProvider(ResourceType::Mesh), mLoadResult.mResources.mBuffers);
+
+    struct Source
+    {
+      const char*    name;
+      uint32_t       attribute;
+      uint32_t       size; ///< Bytes taken from each element
+      const uint8_t* data;
+      uint32_t       elementSize;
+      uint32_t       count;
+    };
+    Source sources[] = {
+      {"aPosition", BakedScene::POSITION, 12u, nullptr, 0u, 0u},
+      {"aNormal", BakedScene::NORMAL, 12u, nullptr, 0u, 0u},
+      {"aTexCoord", BakedScene::TEXCOORD, 8u, nullptr, 0u, 0u},
+      {"aTangent", BakedScene::TANGENT, 12u, nullptr, 0u, 0u}};
+
+    for(auto& attrib : raw.mAttribs)
+    {
+      for(auto& source : sources)
+      {
+        // Only float attributes, an element may be wider than what is kept, i.e. 4 component tangents
+        const uint32_t elementSize = attrib.mNumElements ? attrib.mData.size() / attrib.mNumElements : 0u;
+        if(attrib.mName == source.name && elementSize >= source.size && elementSize % sizeof(float) == 0u)
+        {
+          if(source.attribute == BakedScene::POSITION)
+          {
+            mesh.vertexCount = attrib.mNumElements;
+          }
+          source.data        = attrib.mData.data();
+          source.elementSize = elementSize;
+          source.count       = attrib.mNumElements;
+        }
+      }
+    }
+
+    for(auto& source : sources)
+    {
+      // Every attribute needs as many elements as there are positions
+      if(source.data && source.count >= mesh.vertexCount)
+      {
+        mesh.attributes |= source.attribute;
+      }
+      else
+      {
+        source.data = nullptr;
+      }
+    }
+    mesh.vertexStride = BakedScene::GetVertexStride(mesh.attributes);
+
+    std::vector<uint8_t> vertices(size_t(mesh.vertexCount) * mesh.vertexStride);
+    uint8_t*             vertex = vertices.data();
+    for(uint32_t i = 0u; i < mesh.vertexCount; ++i)
+    {
+      for(auto& source : sources)
+      {
+        if(source.data)
+        {
+          memcpy(vertex, source.data + i * source.elementSize, source.size);
+          vertex += source.size;
+        }
+      }
+    }
+    mesh.vertexOffset = AppendData(vertices.data(), vertices.size());
+
+    if(!raw.mIndices.empty())
+    {
+      std::vector<uint32_t> indices(raw.mIndices.begin(), raw.mIndices.end());
+      mesh.indexCount  = indices.size();
+      mesh.indexOffset = AppendData(indices.data(), indices.size() * sizeof(uint32_t));
+    }
+
+    // Bounds of the mesh, transformed by the nodes later
+    Vector3 boundsMin(FLT_MAX, FLT_MAX, FLT_MAX);
+    Vector3 boundsMax(-FLT_MAX, -FLT_MAX, -FLT_MAX);
+    if(sources[0].data)
+    {
+      for(uint32_t i = 0u; i < mesh.vertexCount; ++i)
+      {
+        const float* position = reinterpret_cast<const float*>(sources[0].data + i * sources[0].elementSize);
+        boundsMin             = Vector3(std::min(boundsMin.x, position[0]), std::min(boundsMin.y, position[1]), std::min(boundsMin.z, position[2]));
+        boundsMax             = Vector3(std::max(boundsMax.x, position[0]), std::max(boundsMax.y, position[1]), std::max(boundsMax.z, position[2]));
+      }
+    }
+    mMeshBounds.push_back({boundsMin, boundsMax});
+
+    mMeshes.push_back(mesh);
+  }
+
+  void BakeMaterial(const MaterialDefinition& definition)
+  {
+    BakedScene::Material material{};
+    for(int i = 0; i < 4; ++i)
+    {
+      material.baseColorFactor[i] = definition.mBaseColorFactor.AsFloat()[i];
+    }
+    for(int i = 0; i < 3; ++i)
+    {
+      material.emissiveFactor[i] = definition.mEmissiveFactor.AsFloat()[i];
+    }
+    material.metallicFactor    = definition.mMetallic;
+    material.roughnessFactor   = definition.mRoughness;
+    material.normalScale       = definition.mNormalScale;
+    material.occlusionStrength = definition.mOcclusionStrength;
+    std::fill(std::begin(material.textures), std::end(material.textures), BakedScene::INVALID_INDEX);
+
+    for(auto& stage : definition.mTextureStages)
+    {
+      uint32_t slot = BakedScene::TEXTURE_SLOT_COUNT;
+      if(stage.mSemantic & MaterialDefinition::ALBEDO)
+      {
+        slot = BakedScene::BASE_COLOR;
+      }
+      else if(stage.mSemantic & (MaterialDefinition::METALLIC | MaterialDefinition::ROUGHNESS))
+      {
+        slot = BakedScene::METALLIC_ROUGHNESS;
+      }
+      else if(stage.mSemantic & MaterialDefinition::NORMAL)
+      {
+        slot = BakedScene::NORMAL_MAP;
+      }
+      else if(stage.mSemantic & MaterialDefinition::OCCLUSION)
+      {
+        slot = BakedScene::OCCLUSION;
+      }
+      else if(stage.mSemantic & MaterialDefinition::EMISSIVE)
+      {
+        slot = BakedScene::EMISSIVE;
+      }
+
+      if(slot < BakedScene::TEXTURE_SLOT_COUNT)
+      {
+        material.textures[slot] = BakeTexture(stage.mTexture);
+      }
+    }
+
+    mMaterials.push_back(material);
+  }
+
+  /**
+   * Decodes a texture to RGBA8888, once per image.
+   * @return The index of the texture, or INVALID_INDEX if it can't be decoded
+   */
+  uint32_t BakeTexture(const TextureDefinition& definition)
+  {
+    const bool        embedded = !definition.mTextureBuffer.empty();
+    const std::string key      = embedded ? "#" + std::to_string(reinterpret_cast<uintptr_t>(definition.mTextureBuffer.data())) : definition.mImageUri;
+    auto              found    = mTextureIndices.find(key);
+    if(found != mTextureIndices.end())
+    {
+      return found->second;
+    }
+
+    Devel::PixelBuffer pixelBuffer = embedded ? LoadImageFromBuffer(const_cast<uint8_t*>(definition.mTextureBuffer.data()), definition.mTextureBuffer.size())
+                                              : LoadImageFromFile(mPathProvider(ResourceType::Material) + definition.mImageUri);
+
+    uint32_t index = BakedScene::INVALID_INDEX;
+    if(pixelBuffer)
+    {
+      const uint32_t width         = pixelBuffer.GetWidth();
+      const uint32_t height        = pixelBuffer.GetHeight();
+      const uint32_t stride        = pixelBuffer.GetStride() ? pixelBuffer.GetStride() : width;
+      const uint32_t bytesPerPixel = Pixel::GetBytesPerPixel(pixelBuffer.GetPixelFormat());
+      const uint8_t* source        = pixelBuffer.GetBuffer();
+
+      std::vector<uint8_t> pixels(size_t(width) * height * 4u);
+      bool                 converted = true;
+      for(uint32_t y = 0u; y < height && converted; ++y)
+      {
+        const uint8_t* row         = source + size_t(y) * stride * bytesPerPixel;
+        uint8_t*       destination = pixels.data() + size_t(y) * width * 4u;
+        for(uint32_t x = 0u; x < width; ++x, destination += 4u)
+        {
+          const uint8_t* pixel = row + x * bytesPerPixel;
+          switch(pixelBuffer.GetPixelFormat())
+          {
+            case Pixel::RGBA8888:
+            {
+              memcpy(destination, pixel, 4u);
+              break;
+            }
+            case Pixel::RGB888:
+            {
+              memcpy(destination, pixel, 3u);
+              destination[3] = 0xff;
+              break;
+            }
+            case Pixel::L8:
+            {
+              destination[0] = destination[1] = destination[2] = pixel[0];
+              destination[3]                                   = 0xff;
+              break;
+            }
+            case Pixel::LA88:
+            {
+              destination[0] = destination[1] = destination[2] = pixel[0];
+              destination[3]                                   = pixel[1];
+              break;
+            }
+            default:
+            {
+              converted = false;
+              break;
+            }
+          }
+        }
+      }
+
+      if(converted)
+      {
+        BakedScene::Texture texture{};
+        texture.format     = BakedScene::RGBA8888;
+        texture.width      = width;
+        texture.height     = height;
+        texture.dataSize   = pixels.size();
+        texture.dataOffset = AppendData(pixels.data(), pixels.size());
+        index              = mTextures.size();
+        mTextures.push_back(texture);
+      }
+    }
+
+    if(index == BakedScene::INVALID_INDEX)
+    {
+      std::cout << "  warning: texture " << (embedded ? std::string("(embedded)") : definition.mImageUri) << " can't be baked" << std::endl;
+    }
+    mTextureIndices[key] = index;
+    return index;
+  }
+
+  void BakeNode(Index iNode, uint32_t parent, const Matrix& parentWorld)
+  {
+    const NodeDefinition* definition = mLoadResult.mScene.GetNode(iNode);
+
+    BakedScene::Node node{};
+    node.parent         = parent;
+    node.name           = AppendName(definition->mName);
+    node.firstPrimitive = mPrimitives.size();
+    for(int i = 0; i < 3; ++i)
+    {
+      node.position[i] = definition->mPosition.AsFloat()[i];
+      node.scale[i]    = definition->mScale.AsFloat()[i];
+    }
+    for(int i = 0; i < 4; ++i)
+    {
+      node.orientation[i] = definition->mOrientation.mVector.AsFloat()[i];
+    }
+
+    Matrix local(false);
+    local.SetTransformComponents(definition->mScale, definition->mOrientation, definition->mPosition);
+    Matrix world(false);
+    Matrix::Multiply(world, local, parentWorld);
+
+    for(auto& renderable : definition->mRenderables)
+    {
+      if(auto model = dynamic_cast<ModelRenderable*>(renderable.get()))
+      {
+        if(model->mMeshIdx < mMeshes.size())
+        {
+          mPrimitives.push_back({model->mMeshIdx, model->mMaterialIdx < mMaterials.size() ? model->mMaterialIdx : BakedScene::INVALID_INDEX});
+          ExpandBounds(mMeshBounds[model->mMeshIdx], world);
+        }
+      }
+    }
+    node.primitiveCount = mPrimitives.size() - node.firstPrimitive;
+
+    const uint32_t index = mNodes.size();
+    mNodes.push_back(node);
+
+    for(auto iChild : definition->mChildren)
+    {
+      BakeNode(iChild, index, world);
+    }
+  }
+
+  void ExpandBounds(const std::pair<Vector3, Vector3>& bounds, const Matrix& world)
+  {
+    if(bounds.first.x > bounds.second.x)
+    {
+      return; // no positions
+    }
+
+    for(int corner = 0; corner < 8; ++corner)
+    {
+      const Vector4 point((corner & 1) ? bounds.second.x : bounds.first.x,
+                          (corner & 2) ? bounds.second.y : bounds.first.y,
+                          (corner & 4) ? bounds.second.z : bounds.first.z,
+                          1.0f);
+      const Vector4 transformed = world * point;
+      for(int i = 0; i < 3; ++i)
+      {
+        mBoundsMin[i] = std::min(mBoundsMin[i], transformed.AsFloat()[i]);
+        mBoundsMax[i] = std::max(mBoundsMax[i], transformed.AsFloat()[i]);
+      }
+    }
+  }
+
+private:
+  LoadResult&                   mLoadResult;
+  ResourceBundle::PathProvider& mPathProvider;
+
+  std::vector<BakedScene::Node>            mNodes;
+  std::vector<BakedScene::Primitive>       mPrimitives;
+  std::vector<BakedScene::Mesh>            mMeshes;
+  std::vector<BakedScene::Material>        mMaterials;
+  std::vector<BakedScene::Texture>         mTextures;
+  std::vector<uint8_t>                     mData;
+  std::vector<char>                        mNames;
+  std::map<std::string, uint32_t>          mTextureIndices;
+  std::vector<std::pair<Vector3, Vector3>> mMeshBounds;
+
+  float mBoundsMin[3]{FLT_MAX, FLT_MAX, FLT_MAX};
+  float mBoundsMax[3]{-FLT_MAX, -FLT_MAX, -FLT_MAX};
+};
+
+void PrintUsage()
+{
+  std::cout << "scene-baker [OPTIONS] <model> <output.dsb>" << std::endl;
+  std::cout << "  Bakes a .gltf, .glb or .dli model for BakedScene::MappedFile" << std::endl;
+  std::cout << "  Options:" << std::endl;
+  std::cout << "    -i <dir>    Directory of the images, the model's directory by default" << std::endl;
+  std::cout << "                or ../images/ next to it for .dli" << std::endl;
+  std::cout << "    -s <dir>    Directory of the shaders of .dli models, ../shaders/ by default" << std::endl;
+  std::cout << "    -h|--help   Help" << std::endl;
+}
+
+} // namespace
+
+int main(int argc, char** argv)
+{
+  std::string imagesDirectory;
+  std::string shadersDirectory;
+  std::string input;
+  std::string output;
+  for(int i(1); i < argc; ++i)
+  {
+    std::string arg(argv[i]);
+    if(arg == "-i" && i + 1 < argc)
+    {
+      imagesDirectory = std::string(argv[++i]) + "/";
+    }
+    else if(arg == "-s" && i + 1 < argc)
+    {
+      shadersDirectory = std::string(argv[++i]) + "/";
+    }
+    else if((arg == "--help") || (arg == "-h"))
+    {
+      PrintUsage();
+      return 0;
+    }
+    else if(input.empty())
+    {
+      input = arg;
+    }
+    else
+    {
+      output = arg;
+    }
+  }
+
+  if(input.empty() || output.empty())
+  {
+    PrintUsage();
+    return 1;
+  }
+
+  const std::string modelDirectory = GetDirectory(input);
+  const bool        isDli          = HasExtension(input, ".dli");
+  if(imagesDirectory.empty())
+  {
+    imagesDirectory = isDli ? modelDirectory + "../images/" : modelDirectory;
+  }
+  if(shadersDirectory.empty())
+  {
+    shadersDirectory = modelDirectory + "../shaders/";
+  }
+
+  ResourceBundle::PathProvider pathProvider = [&](ResourceType::Value type)
+  {
+    switch(type)
+    {
+      case ResourceType::Mesh:
+      {
+        return modelDirectory;
+      }
+      case ResourceType::Shader:
+      {
+        return shadersDirectory;
+      }
+      default:
+      {
+        return imagesDirectory;
+      }
+    }
+  };
+
+  ResourceBundle                        resources;
+  SceneDefinition                       scene;
+  SceneMetadata                         metaData;
+  std::vector<AnimationDefinition>      animations;
+  std::vector<AnimationGroupDefinition> animGroups;
+  std::vector<CameraParameters>         cameraParameters;
+  std::vector<LightParameters>          lights;
+  LoadResult                            loadResult{resources, scene, metaData, animations, animGroups, cameraParameters, lights};
+
+  std::cout << "Baking " << input << std::endl;
+
+  // The raw resources are what the text path has to produce before anything reaches DALi
+  auto        start = std::chrono::steady_clock::now();
+  ModelLoader modelLoader(input, modelDirectory, loadResult);
+  try
+  {
+    modelLoader.LoadModel(pathProvider, true);
+  }
+  catch(const DaliException& e)
+  {
+    std::cout << "  error: " << e.condition << std::endl;
+    return 1;
+  }
+  const float textLoadMs = MillisecondsSince(start);
+
+  if(!animations.empty())
+  {
+    std::cout << "  warning: " << animations.size() << " animations aren't baked" << std::endl;
+  }
+
+  SceneBaker baker(loadResult, pathProvider);
+  baker.Bake();
+  if(!baker.Write(output))
+  {
+    std::cout << "  error: can't write " << output << std::endl;
+    return 1;
+  }
+  baker.PrintSummary();
+
+  std::cout << "  text model parse and decode: " << textLoadMs << "ms" << std::endl;
+  return 0;
+}
@@ -0,0 +1,160 @@
+#ifndef DALI_DEMO_BAKED_SCENE_FORMAT_H
+#define DALI_DEMO_BAKED_SCENE_FORMAT_H
+
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <cstdint>
+
+/**
+ * Layout of the baked scene files (.dsb) written by scene-baker and memory-mapped by
+ * baked-scene-loader.h.
+ *
+ * The file is a Header followed by sections, each starting on a SECTION_ALIGNMENT boundary:
+ *  - a flat node table, parents always before their children,
+ *  - the primitives of the nodes, i.e. mesh and material pairs,
+ *  - the meshes, whose vertices are interleaved and whose indices are 32-bit,
+ *  - the materials and the textures, decoded to RGBA8888,
+ *  - the vertex, index and pixel data, and a table of null terminated names.
+ * All the offsets are from the start of the file and all the values are little endian.
+ */
+namespace BakedScene
+{
+constexpr char     MAGIC[4]          = {'D', 'S', 'B', 'K'};
+constexpr uint32_t VERSION           = 1u; ///< Bumped on any change of the layout
+constexpr uint32_t SECTION_ALIGNMENT = 16u;
+constexpr uint32_t INVALID_INDEX     = 0xffffffffu;
+
+/**
+ * Attributes of the interleaved vertices, in this order
+ */
+enum VertexAttribute : uint32_t
+{
+  POSITION = 1u << 0, ///< 3 floats
+  NORMAL   = 1u << 1, ///< 3 floats
+  TEXCOORD = 1u << 2, ///< 2 floats
+  TANGENT  = 1u << 3, ///< 3 floats
+};
+
+enum TextureSlot : uint32_t
+{
+  BASE_COLOR,
+  METALLIC_ROUGHNESS,
+  NORMAL_MAP,
+  OCCLUSION,
+  EMISSIVE,
+  TEXTURE_SLOT_COUNT
+};
+
+enum TextureFormat : uint32_t
+{
+  RGBA8888
+};
+
+struct Section
+{
+  uint32_t offset;
+  uint32_t count; ///< Number of items, or bytes for the data and the names
+};
+
+struct Header
+{
+  char     magic[4];
+  uint32_t version;
+  uint32_t fileSize;
+  uint32_t reserved;
+  float    boundsMin[3]; ///< Bounds of the scene, in the space of the root nodes
+  float    boundsMax[3];
+  Section  nodes;
+  Section  primitives;
+  Section  meshes;
+  Section  materials;
+  Section  textures;
+  Section  data;
+  Section  names;
+};
+
+struct Node
+{
+  uint32_t parent;         ///< INVALID_INDEX for the roots
+  uint32_t name;           ///< Offset into the names
+  uint32_t firstPrimitive; ///< Index of the first primitive of the node
+  uint32_t primitiveCount;
+  float    position[3];
+  float    orientation[4]; ///< Quaternion as x, y, z, w
+  float    scale[3];
+  uint32_t reserved[2];
+};
+
+struct Primitive
+{
+  uint32_t mesh;
+  uint32_t material; ///< INVALID_INDEX for the default material
+};
+
+struct Mesh
+{
+  uint32_t attributes; ///< VertexAttribute bits
+  uint32_t vertexStride;
+  uint32_t vertexCount;
+  uint32_t vertexOffset;
+  uint32_t indexCount; ///< 0 if the mesh isn't indexed
+  uint32_t indexOffset;
+  uint32_t primitiveType; ///< Dali::Geometry::Type
+  uint32_t reserved;
+};
+
+struct Material
+{
+  float    baseColorFactor[4];
+  float    emissiveFactor[3];
+  float    metallicFactor;
+  float    roughnessFactor;
+  float    normalScale;
+  float    occlusionStrength;
+  uint32_t textures[TEXTURE_SLOT_COUNT]; ///< Index of the texture of each slot, or INVALID_INDEX
+};
+
+struct Texture
+{
+  uint32_t format; ///< TextureFormat
+  uint32_t width;
+  uint32_t height;
+  uint32_t dataOffset;
+  uint32_t dataSize;
+  uint32_t reserved[3];
+};
+
+static_assert(sizeof(Header) % 4u == 0u, "Header must keep the sections 32-bit aligned");
+static_assert(sizeof(Node) == 64u, "Node layout changed, bump VERSION");
+static_assert(sizeof(Mesh) == 32u, "Mesh layout changed, bump VERSION");
+static_assert(sizeof(Texture) == 32u, "Texture layout changed, bump VERSION");
+
+inline uint32_t AlignSection(uint32_t offset)
+{
+  return (offset + SECTION_ALIGNMENT - 1u) & ~(SECTION_ALIGNMENT - 1u);
+}
+
+inline uint32_t GetVertexStride(uint32_t attributes)
+{
+  return ((attributes & POSITION) ? 12u : 0u) + ((attributes & NORMAL) ? 12u : 0u) +
+         ((attributes & TEXCOORD) ? 8u : 0u) + ((attributes & TANGENT) ? 12u : 0u);
+}
+
+} // namespace BakedScene
+
+#endif // DALI_DEMO_BAKED_SCENE_FORMAT_H
@@ -0,0 +1,367 @@
+#ifndef DALI_DEMO_BAKED_SCENE_LOADER_H
+#define DALI_DEMO_BAKED_SCENE_LOADER_H
+
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <dali-scene3d/public-api/controls/model/model.h>
+#include <dali-scene3d/public-api/model-components/material.h>
+#include <dali-scene3d/public-api/model-components/model-node.h>
+#include <dali-scene3d/public-api/model-components/model-primitive.h>
+#include <dali/dali.h>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include "baked-scene-format.h"
+
+namespace BakedScene
+{
+/**
+ * Read-only memory mapping of a baked scene file.
+ *
+ * Opening maps the file and validates the header, the section bounds and the ranges given by the
+ * tables, so that a corrupt or truncated file is rejected rather than read past its end. Only the
+ * tables are read then; the pages of the vertex and pixel data are read by the kernel as the
+ * geometries and textures are created.
+ */
+class MappedFile
+{
+public:
+  MappedFile() = default;
+
+  MappedFile(const MappedFile&) = delete;
+  MappedFile& operator=(const MappedFile&) = delete;
+
+  ~MappedFile()
+  {
+    Close();
+  }
+
+  /**
+   * Maps the file and checks it.
+   * @param[in] path Path of the .dsb file
+   * @return false if it can't be mapped, isn't a baked scene of this VERSION or is inconsistent
+   */
+  bool Open(const std::string& path)
+  {
+    Close();
+
+    int fd = open(path.c_str(), O_RDONLY);
+    if(fd < 0)
+    {
+      return false;
+    }
+
+    struct stat status;
+    if(fstat(fd, &status) == 0 && size_t(status.st_size) >= sizeof(Header))
+    {
+      void* address = mmap(nullptr, status.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+      if(address != MAP_FAILED)
+      {
+        mData = static_cast<const uint8_t*>(address);
+        mSize = status.st_size;
+      }
+    }
+    close(fd); // The mapping keeps its own reference
+
+    if(mData && !IsValid())
+    {
+      Close();
+    }
+    return mData != nullptr;
+  }
+
+  void Close()
+  {
+    if(mData)
+    {
+      munmap(const_cast<uint8_t*>(mData), mSize);
+      mData = nullptr;
+      mSize = 0u;
+    }
+  }
+
+  const Header& GetHeader() const
+  {
+    return *reinterpret_cast<const Header*>(mData);
+  }
+
+  template<typename T>
+  const T* GetTable(const Section& section) const
+  {
+    return reinterpret_cast<const T*>(mData + section.offset);
+  }
+
+  const uint8_t* GetData(uint32_t offset) const
+  {
+    return mData + GetHeader().data.offset + offset;
+  }
+
+  const char* GetName(uint32_t offset) const
+  {
+    return reinterpret_cast<const char*>(mData + GetHeader().names.offset + offset);
+  }
+
+private:
+  bool IsValid() const
+  {
+    const Header& header = GetHeader();
+    if(memcmp(header.magic, MAGIC, sizeof(MAGIC)) != 0 || header.version != VERSION || header.fileSize != mSize)
+    {
+      return false;
+    }
+
+    auto fits = [this](const Section& section, size_t itemSize)
+    {
+      return section.offset % 4u == 0u && section.offset <= mSize && section.count <= (mSize - section.offset) / itemSize;
+    };
+    if(!fits(header.nodes, sizeof(Node)) || !fits(header.primitives, sizeof(Primitive)) ||
+       !fits(header.meshes, sizeof(Mesh)) || !fits(header.materials, sizeof(Material)) ||
+       !fits(header.textures, sizeof(Texture)) || !fits(header.data, 1u) || !fits(header.names, 1u) ||
+       (header.names.count > 0u && GetName(header.names.count - 1u)[0] != '\0'))
+    {
+      return false;
+    }
+
+    // The tables are trusted from here on, so every range they give must be within its section
+    auto inData = [&header](uint64_t offset, uint64_t size)
+    {
+      return offset <= header.data.count && size <= header.data.count - offset;
+    };
+
+    const Mesh* meshes = GetTable<Mesh>(header.meshes);
+    for(uint32_t i = 0u; i < header.meshes.count; ++i)
+    {
+      const Mesh& mesh = meshes[i];
+      if(mesh.vertexStride == 0u || mesh.vertexStride != GetVertexStride(mesh.attributes) ||
+         !inData(mesh.vertexOffset, uint64_t(mesh.vertexCount) * mesh.vertexStride) ||
+         (mesh.indexCount > 0u && (mesh.indexOffset % 4u != 0u || !inData(mesh.indexOffset, uint64_t(mesh.indexCount) * sizeof(uint32_t)))))
+      {
+        return false;
+      }
+    }
+
+    const Texture* textures = GetTable<Texture>(header.textures);
+    for(uint32_t i = 0u; i < header.textures.count; ++i)
+    {
+      const Texture& texture = textures[i];
+      if(texture.format != RGBA8888 || texture.dataSize != uint64_t(texture.width) * texture.height * 4u ||
+         !inData(texture.dataOffset, texture.dataSize))
+      {
+        return false;
+      }
+    }
+
+    // The names end with a null, so a name starting within them is terminated
+    const Node* nodes = GetTable<Node>(header.nodes);
+    for(uint32_t i = 0u; i < header.nodes.count; ++i)
+    {
+      if(nodes[i].name >= header.names.count)
+      {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  const uint8_t* mData{nullptr};
+  size_t         mSize{0u};
+};
+
+/**
+ * Creates the geometry of a mesh; the vertex and index data are copied straight from the mapping.
+ */
+inline Dali::Geometry CreateGeometry(const MappedFile& file, const Mesh& mesh)
+{
+  Dali::Property::Map format;
+  if(mesh.attributes & POSITION)
+  {
+    format["aPosition"] = Dali::Property::VECTOR3;
+  }
+  if(mesh.attributes & NORMAL)
+  {
+    format["aNormal"] = Dali::Property::VECTOR3;
+  }
+  if(mesh.attributes & TEXCOORD)
+  {
+    format["aTexCoord"] = Dali::Property::VECTOR2;
+  }
+  if(mesh.attributes & TANGENT)
+  {
+    format["aTangent"] = Dali::Property::VECTOR3;
+  }
+
+  Dali::VertexBuffer vertexBuffer = Dali::VertexBuffer::New(format);
+  vertexBuffer.SetData(file.GetData(mesh.vertexOffset), mesh.vertexCount);
+
+  Dali::Geometry geometry = Dali::Geometry::New();
+  geometry.AddVertexBuffer(vertexBuffer);
+  if(mesh.indexCount > 0u)
+  {
+    geometry.SetIndexBuffer(reinterpret_cast<const uint32_t*>(file.GetData(mesh.indexOffset)), mesh.indexCount);
+  }
+  geometry.SetType(static_cast<Dali::Geometry::Type>(mesh.primitiveType));
+  return geometry;
+}
+
+/**
+ * Creates and uploads a texture; PixelData owns its buffer, so the pixels are copied once.
+ */
+inline Dali::Texture CreateTexture(const MappedFile& file, const Texture& texture)
+{
+  uint8_t* pixels = static_cast<uint8_t*>(malloc(texture.dataSize));
+  memcpy(pixels, file.GetData(texture.dataOffset), texture.dataSize);
+
+  Dali::PixelData pixelData = Dali::PixelData::New(pixels, texture.dataSize, texture.width, texture.height, Dali::Pixel::RGBA8888, Dali::PixelData::FREE);
+  Dali::Texture   result    = Dali::Texture::New(Dali::TextureType::TEXTURE_2D, Dali::Pixel::RGBA8888, texture.width, texture.height);
+  result.Upload(pixelData);
+  result.GenerateMipmaps();
+  return result;
+}
+
+inline Dali::Scene3D::Material CreateMaterial(const Material& material, const std::vector<Dali::Texture>& textures)
+{
+  using Dali::Scene3D::Material;
+
+  Material result = Material::New();
+  result.SetProperty(Material::Property::BASE_COLOR_FACTOR, Dali::Vector4(material.baseColorFactor));
+  result.SetProperty(Material::Property::METALLIC_FACTOR, material.metallicFactor);
+  result.SetProperty(Material::Property::ROUGHNESS_FACTOR, material.roughnessFactor);
+  result.SetProperty(Material::Property::NORMAL_SCALE, material.normalScale);
+  result.SetProperty(Material::Property::OCCLUSION_STRENGTH, material.occlusionStrength);
+  result.SetProperty(Material::Property::EMISSIVE_FACTOR, Dali::Vector3(material.emissiveFactor));
+
+  const Material::TextureType::Type TEXTURE_TYPES[TEXTURE_SLOT_COUNT] = {
+    Material::TextureType::BASE_COLOR,
+    Material::TextureType::METALLIC_ROUGHNESS,
+    Material::TextureType::NORMAL,
+    Material::TextureType::OCCLUSION,
+    Material::TextureType::EMISSIVE};
+  for(uint32_t slot = 0u; slot < TEXTURE_SLOT_COUNT; ++slot)
+  {
+    if(material.textures[slot] < textures.size())
+    {
+      result.SetTexture(TEXTURE_TYPES[slot], textures[material.textures[slot]]);
+    }
+  }
+  return result;
+}
+
+/**
+ * Builds a model from a baked scene.
+ *
+ * The nodes are added under a single root which turns the Y up space of the source formats into
+ * the Y down space of DALi, centres the scene and scales it to fit the given size.
+ * @param[in] file The mapped scene
+ * @param[in] size Size of the model, the largest side of the scene bounds fits in it
+ * @return The model, which is empty if the file isn't open
+ */
+inline Dali::Scene3D::Model CreateModel(const MappedFile& file, const Dali::Vector2& size)
+{
+  Dali::Scene3D::Model model = Dali::Scene3D::Model::New();
+  model.SetProperty(Dali::Actor::Property::SIZE, size);
+
+  const Header& header = file.GetHeader();
+
+  std::vector<Dali::Texture> textures;
+  textures.reserve(header.textures.count);
+  const Texture* bakedTextures = file.GetTable<Texture>(header.textures);
+  for(uint32_t i = 0u; i < header.textures.count; ++i)
+  {
+    textures.push_back(CreateTexture(file, bakedTextures[i]));
+  }
+
+  std::vector<Dali::Scene3D::Material> materials;
+  materials.reserve(header.materials.count);
+  const Material* bakedMaterials = file.GetTable<Material>(header.materials);
+  for(uint32_t i = 0u; i < header.materials.count; ++i)
+  {
+    materials.push_back(CreateMaterial(bakedMaterials[i], textures));
+  }
+
+  std::vector<Dali::Geometry> geometries;
+  geometries.reserve(header.meshes.count);
+  const Mesh* bakedMeshes = file.GetTable<Mesh>(header.meshes);
+  for(uint32_t i = 0u; i < header.meshes.count; ++i)
+  {
+    geometries.push_back(CreateGeometry(file, bakedMeshes[i]));
+  }
+
+  const Dali::Vector3 boundsMin(header.boundsMin);
+  const Dali::Vector3 boundsMax(header.boundsMax);
+  const Dali::Vector3 extent(boundsMax - boundsMin);
+  const Dali::Vector3 center((boundsMin + boundsMax) * 0.5f);
+  const float         largestSide = std::max(extent.x, std::max(extent.y, extent.z));
+  const float         scale       = largestSide > 0.0f ? std::min(size.x, size.y) / largestSide : 1.0f;
+
+  Dali::Scene3D::ModelNode root = Dali::Scene3D::ModelNode::New();
+  root.SetProperty(Dali::Actor::Property::ORIENTATION, Dali::Quaternion(Dali::Radian(Dali::Degree(180.0f)), Dali::Vector3::XAXIS));
+  root.SetProperty(Dali::Actor::Property::SCALE, scale);
+  root.SetProperty(Dali::Actor::Property::POSITION, Dali::Vector3(-center.x, center.y, center.z) * scale);
+  model.AddModelNode(root);
+
+  std::vector<Dali::Scene3D::ModelNode> nodes;
+  nodes.reserve(header.nodes.count);
+  const Node*      bakedNodes      = file.GetTable<Node>(header.nodes);
+  const Primitive* bakedPrimitives = file.GetTable<Primitive>(header.primitives);
+  for(uint32_t i = 0u; i < header.nodes.count; ++i)
+  {
+    const Node& bakedNode = bakedNodes[i];
+
+    Dali::Scene3D::ModelNode node = Dali::Scene3D::ModelNode::New();
+    node.SetProperty(Dali::Actor::Property::NAME, file.GetName(bakedNode.name));
+    node.SetProperty(Dali::Actor::Property::POSITION, Dali::Vector3(bakedNode.position));
+    node.SetProperty(Dali::Actor::Property::ORIENTATION, Dali::Quaternion(Dali::Vector4(bakedNode.orientation)));
+    node.SetProperty(Dali::Actor::Property::SCALE, Dali::Vector3(bakedNode.scale));
+
+    for(uint32_t p = bakedNode.firstPrimitive; p < bakedNode.firstPrimitive + bakedNode.primitiveCount && p < header.primitives.count; ++p)
+    {
+      const Primitive& bakedPrimitive = bakedPrimitives[p];
+      if(bakedPrimitive.mesh < geometries.size())
+      {
+        Dali::Scene3D::ModelPrimitive primitive = Dali::Scene3D::ModelPrimitive::New();
+        primitive.SetGeometry(geometries[bakedPrimitive.mesh]);
+        primitive.SetMaterial(bakedPrimitive.material < materials.size() ? materials[bakedPrimitive.material] : Dali::Scene3D::Material::New());
+        node.AddModelPrimitive(primitive);
+      }
+    }
+
+    // Parents come first, anything else is attached to the root
+    if(bakedNode.parent < i)
+    {
+      nodes[bakedNode.parent].Add(node);
+    }
+    else
+    {
+      root.Add(node);
+    }
+    nodes.push_back(node);
+  }
+
+  return model;
+}
+
+} // namespace BakedScene
+
+#endif // DALI_DEMO_BAKED_SCENE_LOADER_H
@@ -0,0 +1,361 @@
+#ifndef DALI_DEMO_BUILDER_SCRIPT_CACHE_H
+#define DALI_DEMO_BUILDER_SCRIPT_CACHE_H
+
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <dali-toolkit/devel-api/builder/json-parser.h>
+#include <dali-toolkit/devel-api/builder/tree-node.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <algorithm>
+#include <cctype>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <sstream>
+#include <string>
+
+/**
+ * Cache of precompiled builder scripts, keyed by a hash of the script text.
+ *
+ * Compiling a script checks that it parses, strips its comments and whitespace, and counts the
+ * nodes of its stage, constants, styles, templates and animations sections, so that a launcher
+ * can list scripts without parsing them. Builder only loads scripts from text, so the compiled
+ * script keeps the minified text to give to Builder::LoadFromString().
+ *
+ * An entry is a Header followed by the minified text. Entries which don't match the script, e.g.
+ * written by another version, are compiled again. Scripts which don't parse aren't cached: their
+ * text is left for Builder to load and report the error.
+ *
+ * The entries are loaded as scripts, so the cache is only used if its directory belongs to the
+ * user and can't be written by anyone else.
+ */
+namespace BuilderScript
+{
+constexpr char     MAGIC[4] = {'D', 'B', 'S', 'C'};
+constexpr uint32_t VERSION  = 2u; ///< Bumped on any change of the layout or of the compilation
+
+struct Header
+{
+  char     magic[4];
+  uint32_t version;
+  uint64_t sourceHash;
+  uint32_t sourceSize;
+  uint32_t textSize; ///< Size of the minified text following the header
+  uint32_t stageNodes;
+  uint32_t constants;
+  uint32_t styles;
+  uint32_t templates;
+  uint32_t animations;
+  uint32_t reserved;
+};
+
+static_assert(sizeof(Header) == 48u, "The header layout must not depend on the compiler");
+
+struct Script
+{
+  std::string text; ///< Minified script, or the script as given if it doesn't parse
+  std::string error;
+  uint32_t    stageNodes{0u};
+  uint32_t    constants{0u};
+  uint32_t    styles{0u};
+  uint32_t    templates{0u};
+  uint32_t    animations{0u};
+  bool        compiled{false};  ///< Whether the script parsed
+  bool        fromCache{false}; ///< Whether the script was read from the cache rather than compiled
+};
+
+/**
+ * 64-bit FNV-1a hash of the script text
+ */
+inline uint64_t Hash(const std::string& source)
+{
+  uint64_t hash = 14695981039346656037ull;
+  for(unsigned char c : source)
+  {
+    hash = (hash ^ c) * 1099511628211ull;
+  }
+  return hash;
+}
+
+/**
+ * Removes the comments and the whitespace outside of strings.
+ * A space is kept between two barewords, which a valid script never has.
+ */
+inline std::string Minify(const std::string& source)
+{
+  auto isWord = [](char c) { return std::isalnum(static_cast<unsigned char>(c)) || c == '.' || c == '-' || c == '+'; };
+
+  std::string text;
+  text.reserve(source.size());
+  bool         separated = false;
+  const size_t size      = source.size();
+  for(size_t i = 0u; i < size; ++i)
+  {
+    const char c = source[i];
+    if(c == '"')
+    {
+      size_t end = i + 1u;
+      while(end < size && source[end] != '"')
+      {
+        end += (source[end] == '\\') ? 2u : 1u;
+      }
+      end = std::min(end, size - 1u);
+      text.append(source, i, end + 1u - i);
+      separated = false;
+      i         = end;
+    }
+    else if(c == '/' && i + 1u < size && source[i + 1u] == '/')
+    {
+      i = std::min(source.find('\n', i), size);
+      separated = true;
+    }
+    else if(c == '/' && i + 1u < size && source[i + 1u] == '*')
+    {
+      const size_t end = source.find("*/", i + 2u);
+      i                = (end == std::string::npos) ? size : end + 1u;
+      separated        = true;
+    }
+    else if(std::isspace(static_cast<unsigned char>(c)))
+    {
+      separated = true;
+    }
+    else
+    {
+      if(separated && !text.empty() && isWord(text.back()) && isWord(c))
+      {
+        text += ' ';
+      }
+      text += c;
+      separated = false;
+    }
+  }
+  return text;
+}
+
+/**
+ * Parses and minifies a script.
+ * @param[in]  source The script text
+ * @param[out] script The compiled script, or the source and the parse error
+ * @return Whether the script parsed
+ */
+inline bool Compile(const std::string& source, Script& script)
+{
+  using Dali::Toolkit::TreeNode;
+
+  script = Script();
+
+  Dali::Toolkit::JsonParser parser = Dali::Toolkit::JsonParser::New();
+  parser.Parse(source);
+  if(parser.ParseError() || !parser.GetRoot())
+  {
+    std::ostringstream error;
+    error << parser.GetErrorLineNumber() << "(" << parser.GetErrorColumn() << "):" << parser.GetErrorDescription();
+    script.text  = source;
+    script.error = error.str();
+    return false;
+  }
+
+  const TreeNode& root       = *parser.GetRoot();
+  auto            countNodes = [](const TreeNode* node) -> uint32_t {
+    return node ? uint32_t(node->Size()) : 0u;
+  };
+
+  // The launcher has always searched the whole script for the stage, the other sections are top level
+  script.text       = Minify(source);
+  script.stageNodes = countNodes(root.Find("stage"));
+  script.constants  = countNodes(root.GetChild("constants"));
+  script.styles     = countNodes(root.GetChild("styles"));
+  script.templates  = countNodes(root.GetChild("templates"));
+  script.animations = countNodes(root.GetChild("animations"));
+  script.compiled   = true;
+  return true;
+}
+
+class Cache
+{
+public:
+  /**
+   * @param[in] directory Where the entries are kept, created if missing. Empty to only compile.
+   */
+  explicit Cache(const std::string& directory)
+  : mDirectory(directory)
+  {
+    if(!mDirectory.empty())
+    {
+      if(mDirectory.back() != '/')
+      {
+        mDirectory += '/';
+      }
+      if(!MakePrivateDirectory(mDirectory))
+      {
+        mDirectory.clear();
+      }
+    }
+  }
+
+  /**
+   * @return $DALI_BUILDER_CACHE_DIR, or dali-builder/ in $XDG_CACHE_HOME or ~/.cache, or an empty
+   * string if there is no home directory
+   */
+  static std::string GetDefaultDirectory()
+  {
+    if(const char* directory = std::getenv("DALI_BUILDER_CACHE_DIR"))
+    {
+      return directory;
+    }
+    const char* cache = std::getenv("XDG_CACHE_HOME");
+    if(cache && cache[0] == '/')
+    {
+      return std::string(cache) + "/dali-builder/";
+    }
+    const char* home = std::getenv("HOME");
+    return (home && home[0] == '/') ? std::string(home) + "/.cache/dali-builder/" : std::string();
+  }
+
+  /**
+   * @return Where the entries are kept, empty if the cache is disabled
+   */
+  const std::string& GetDirectory() const
+  {
+    return mDirectory;
+  }
+
+  /**
+   * Reads the compiled script from the cache, or compiles it and adds it to the cache.
+   * @param[in]  source The script text
+   * @param[out] script The compiled script, or the source and the parse error
+   * @return Whether the script parsed
+   */
+  bool Load(const std::string& source, Script& script) const
+  {
+    const uint64_t hash = Hash(source);
+    if(!mDirectory.empty() && Read(hash, source.size(), script))
+    {
+      return true;
+    }
+
+    if(!Compile(source, script))
+    {
+      return false;
+    }
+
+    if(!mDirectory.empty())
+    {
+      Write(hash, source.size(), script);
+    }
+    return true;
+  }
+
+private:
+  /**
+   * Creates the directory and its missing parents, accessible to the user only.
+   * @return Whether the directory is owned by the user and can't be written by anyone else
+   */
+  static bool MakePrivateDirectory(const std::string& directory)
+  {
+    for(size_t slash = directory.find('/', 1u); slash != std::string::npos; slash = directory.find('/', slash + 1u))
+    {
+      mkdir(directory.substr(0u, slash).c_str(), 0700);
+    }
+
+    struct stat status;
+    return stat(directory.c_str(), &status) == 0 && S_ISDIR(status.st_mode) && status.st_uid == geteuid() &&
+           (status.st_mode & (S_IWGRP | S_IWOTH)) == 0;
+  }
+
+  std::string GetEntryPath(uint64_t hash) const
+  {
+    char name[24];
+    snprintf(name, sizeof(name), "%016llx.dbsc", static_cast<unsigned long long>(hash));
+    return mDirectory + name;
+  }
+
+  bool Read(uint64_t hash, size_t sourceSize, Script& script) const
+  {
+    std::ifstream file(GetEntryPath(hash), std::ios::binary);
+    Header        header;
+    if(!file.read(reinterpret_cast<char*>(&header), sizeof(header)) ||
+       memcmp(header.magic, MAGIC, sizeof(MAGIC)) != 0 || header.version != VERSION ||
+       header.sourceHash != hash || header.sourceSize != sourceSize)
+    {
+      return false;
+    }
+
+    // A corrupt size mustn't allocate more than the entry holds
+    if(!file.seekg(0, std::ios::end) || uint64_t(file.tellg()) != sizeof(Header) + uint64_t(header.textSize) ||
+       !file.seekg(sizeof(Header)))
+    {
+      return false;
+    }
+
+    script = Script();
+    script.text.resize(header.textSize);
+    if(!file.read(&script.text[0], header.textSize))
+    {
+      return false;
+    }
+    script.stageNodes = header.stageNodes;
+    script.constants  = header.constants;
+    script.styles     = header.styles;
+    script.templates  = header.templates;
+    script.animations = header.animations;
+    script.compiled   = true;
+    script.fromCache  = true;
+    return true;
+  }
+
+  /**
+   * Writes to a temporary file renamed over the entry, so that readers never see a partial entry.
+   */
+  void Write(uint64_t hash, size_t sourceSize, const Script& script) const
+  {
+    Header header{};
+    memcpy(header.magic, MAGIC, sizeof(MAGIC));
+    header.version    = VERSION;
+    header.sourceHash = hash;
+    header.sourceSize = uint32_t(sourceSize);
+    header.textSize   = uint32_t(script.text.size());
+    header.stageNodes = script.stageNodes;
+    header.constants  = script.constants;
+    header.styles     = script.styles;
+    header.templates  = script.templates;
+    header.animations = script.animations;
+
+    const std::string path      = GetEntryPath(hash);
+    const std::string temporary = path + ".tmp";
+    bool              written;
+    {
+      std::ofstream file(temporary, std::ios::binary | std::ios::trunc);
+      written = file.write(reinterpret_cast<const char*>(&header), sizeof(header)) &&
+                file.write(script.text.data(), script.text.size());
+    }
+    if(!written || std::rename(temporary.c_str(), path.c_str()) != 0)
+    {
+      std::remove(temporary.c_str());
+    }
+  }
+
+  std::string mDirectory;
+};
+
+} // namespace BuilderScript
+
+#endif // DALI_DEMO_BUILDER_SCRIPT_CACHE_H
@@ -0,0 +1,136 @@
+#ifndef DALI_DEMO_FRAME_STATS_H
+#define DALI_DEMO_FRAME_STATS_H
+
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <dali/devel-api/update/frame-callback-interface.h>
+#include <time.h>
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+
+namespace DemoHelper
+{
+/**
+ * Frame callback measuring the frame times and the CPU time of the update thread, which also
+ * renders. The time between two callbacks covers rendering of the previous frame and the update
+ * of the current one, including any other frame callback.
+ *
+ * Update() runs on the update thread, the counters are read and reset from the event thread.
+ */
+class FrameStats : public Dali::FrameCallbackInterface
+{
+public:
+  /**
+   * Counters accumulated since the previous reset
+   */
+  struct Sample
+  {
+    uint32_t frames{0u};
+    uint64_t elapsedUs{0u};
+    uint64_t maxElapsedUs{0u};
+    uint64_t cpuTimeUs{0u}; ///< CPU time of the update thread
+
+    float GetAverageFrameMs() const
+    {
+      return frames ? elapsedUs / 1000.0f / frames : 0.0f;
+    }
+
+    float GetMaxFrameMs() const
+    {
+      return maxElapsedUs / 1000.0f;
+    }
+
+    float GetAverageUpdateMs() const
+    {
+      return frames ? cpuTimeUs / 1000.0f / frames : 0.0f;
+    }
+  };
+
+  /**
+   * @param[in] keepRendering Whether to request the next frame, so that idle time doesn't add to the frame times
+   */
+  explicit FrameStats(bool keepRendering = true)
+  : mKeepRendering(keepRendering)
+  {
+  }
+
+  /**
+   * @return The counters since the previous reset
+   */
+  Sample Get() const
+  {
+    Sample sample;
+    sample.frames       = mFrames;
+    sample.elapsedUs    = mElapsedUs;
+    sample.maxElapsedUs = mMaxElapsedUs;
+    sample.cpuTimeUs    = mCpuTimeUs;
+    return sample;
+  }
+
+  /**
+   * @return The counters since the previous reset, which are restarted
+   */
+  Sample Reset()
+  {
+    Sample sample;
+    sample.frames       = mFrames.exchange(0u);
+    sample.elapsedUs    = mElapsedUs.exchange(0u);
+    sample.maxElapsedUs = mMaxElapsedUs.exchange(0u);
+    sample.cpuTimeUs    = mCpuTimeUs.exchange(0u);
+    return sample;
+  }
+
+  /**
+   * @return The CPU time of the calling thread in microseconds
+   */
+  static uint64_t GetThreadCpuTimeUs()
+  {
+    timespec time;
+    clock_gettime(CLOCK_THREAD_CPUTIME_ID, &time);
+    return uint64_t(time.tv_sec) * 1000000u + time.tv_nsec / 1000u;
+  }
+
+private:
+  virtual bool Update(Dali::UpdateProxy& updateProxy, float elapsedSeconds)
+  {
+    const uint64_t cpuTime = GetThreadCpuTimeUs();
+    if(mLastCpuTimeUs)
+    {
+      const uint64_t elapsed = uint64_t(elapsedSeconds * 1000000.0f);
+      mCpuTimeUs += cpuTime - mLastCpuTimeUs;
+      mElapsedUs += elapsed;
+      mMaxElapsedUs = std::max<uint64_t>(mMaxElapsedUs, elapsed);
+      ++mFrames;
+    }
+    mLastCpuTimeUs = cpuTime;
+    return mKeepRendering;
+  }
+
+private:
+  std::atomic<uint32_t> mFrames{0u};
+  std::atomic<uint64_t> mElapsedUs{0u};
+  std::atomic<uint64_t> mMaxElapsedUs{0u};
+  std::atomic<uint64_t> mCpuTimeUs{0u};
+  uint64_t              mLastCpuTimeUs{0u}; ///< Update thread only
+  const bool            mKeepRendering;
+};
+
+} // namespace DemoHelper
+
+#endif // DALI_DEMO_FRAME_STATS_H
@@ -0,0 +1,771 @@
+#ifndef DALI_DEMO_JSON_READER_H
+#define DALI_DEMO_JSON_READER_H
+
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+
+namespace DemoHelper
+{
+/**
+ * Streaming JSON reader pulling values straight out of a buffer, without building a document.
+ *
+ * The caller walks the document in order, e.g. for {"a":[1,2],"b":true}:
+ * @code
+ * JsonReader       reader(data, size);
+ * std::string_view key;
+ * if(reader.BeginObject())
+ * {
+ *   while(reader.NextMember(key))
+ *   {
+ *     if(key == "a" && reader.BeginArray())
+ *     {
+ *       float value;
+ *       while(reader.NextElement() && reader.ReadNumber(value)) {...}
+ *     }
+ *     else
+ *     {
+ *       reader.Skip();
+ *     }
+ *   }
+ * }
+ * bool ok = reader.Finish();
+ * @endcode
+ *
+ * Nothing is allocated: keys and strings without escapes are views into the buffer, which must
+ * outlive them. Numbers are parsed without the locale. They are exact with up to 15 significant
+ * digits and an exponent within +/-22, which covers the values written by exporters, and within
+ * a few ulps otherwise.
+ *
+ * The first error stops the reader: every later call fails and GetError() describes it.
+ */
+class JsonReader
+{
+public:
+  enum class Type
+  {
+    INVALID, ///< End of the buffer, an unexpected character or after an error
+    OBJECT,
+    ARRAY,
+    STRING,
+    NUMBER,
+    BOOLEAN,
+    NULL_VALUE
+  };
+
+  static constexpr unsigned int MAX_DEPTH = 256u; ///< Nesting limit, which bounds the recursion of Skip()
+
+  /**
+   * @param[in] data The JSON text, which doesn't need to be null-terminated
+   * @param[in] size The size of the text in bytes
+   */
+  JsonReader(const char* data, size_t size)
+  : mBegin(data),
+    mPosition(data),
+    mEnd(data + size)
+  {
+    // Skip a UTF-8 byte order mark
+    if(size >= 3u && uint8_t(data[0]) == 0xEFu && uint8_t(data[1]) == 0xBBu && uint8_t(data[2]) == 0xBFu)
+    {
+      mPosition += 3;
+    }
+  }
+
+  /**
+   * @return The type of the next value, without consuming it
+   */
+  Type Peek()
+  {
+    if(!SkipWhitespace())
+    {
+      return Type::INVALID;
+    }
+
+    switch(*mPosition)
+    {
+      case '{':
+        return Type::OBJECT;
+      case '[':
+        return Type::ARRAY;
+      case '"':
+        return Type::STRING;
+      case 't':
+      case 'f':
+        return Type::BOOLEAN;
+      case 'n':
+        return Type::NULL_VALUE;
+      default:
+        return (*mPosition == '-' || IsDigit(*mPosition)) ? Type::NUMBER : Type::INVALID;
+    }
+  }
+
+  /**
+   * Enters the object which is the next value. Its members are then read with NextMember().
+   * @return false if the next value isn't an object
+   */
+  bool BeginObject()
+  {
+    return Open('{', "expected an object");
+  }
+
+  /**
+   * Moves to the next member of the current object and reads its key. The value must then be
+   * read or skipped before the next call.
+   * @param[out] key The key, as written in the buffer: escapes aren't decoded
+   * @return false once the end of the object has been consumed, or on error
+   */
+  bool NextMember(std::string_view& key)
+  {
+    if(!NextItem('}'))
+    {
+      return false;
+    }
+    if(!SkipWhitespace() || *mPosition != '"')
+    {
+      return Fail("expected a key");
+    }
+    if(!ScanString(key, nullptr))
+    {
+      return false;
+    }
+    if(!SkipWhitespace() || *mPosition != ':')
+    {
+      return Fail("expected ':'");
+    }
+    ++mPosition;
+    return true;
+  }
+
+  /**
+   * Enters the array which is the next value. Its elements are then read after each NextElement().
+   * @return false if the next value isn't an array
+   */
+  bool BeginArray()
+  {
+    return Open('[', "expected an array");
+  }
+
+  /**
+   * Moves to the next element of the current array, which must then be read or skipped.
+   * @return false once the end of the array has been consumed, or on error
+   */
+  bool NextElement()
+  {
+    return NextItem(']');
+  }
+
+  /**
+   * Reads a number.
+   * @return false if the next value isn't a number
+   */
+  bool ReadNumber(double& value)
+  {
+    if(!SkipWhitespace())
+    {
+      return Fail("expected a number");
+    }
+
+    const char* position = mPosition;
+    const bool  negative = (*position == '-');
+    if(negative)
+    {
+      ++position;
+    }
+    if(position == mEnd || !IsDigit(*position))
+    {
+      return Fail("expected a number");
+    }
+
+    // Accumulate up to 19 significant digits, the others only move the decimal point
+    uint64_t mantissa(0u);
+    int      digits(0);
+    int      exponent(0);
+    if(*position == '0')
+    {
+      ++position;
+    }
+    else
+    {
+      for(; position != mEnd && IsDigit(*position); ++position)
+      {
+        AccumulateDigit(*position, mantissa, digits, exponent, false);
+      }
+    }
+
+    if(position != mEnd && *position == '.')
+    {
+      ++position;
+      if(position == mEnd || !IsDigit(*position))
+      {
+        return Fail("expected a digit after '.'");
+      }
+      for(; position != mEnd && IsDigit(*position); ++position)
+      {
+        AccumulateDigit(*position, mantissa, digits, exponent, true);
+      }
+    }
+
+    if(position != mEnd && (*position == 'e' || *position == 'E'))
+    {
+      ++position;
+      bool negativeExponent(false);
+      if(position != mEnd && (*position == '+' || *position == '-'))
+      {
+        negativeExponent = (*position == '-');
+        ++position;
+      }
+      if(position == mEnd || !IsDigit(*position))
+      {
+        return Fail("expected a digit in the exponent");
+      }
+      int writtenExponent(0);
+      for(; position != mEnd && IsDigit(*position); ++position)
+      {
+        if(writtenExponent < 100000)
+        {
+          writtenExponent = writtenExponent * 10 + (*position - '0');
+        }
+      }
+      exponent += negativeExponent ? -writtenExponent : writtenExponent;
+    }
+
+    double result = double(mantissa);
+    if(mantissa != 0u && exponent != 0)
+    {
+      result = ScaleByPowerOfTen(result, exponent);
+    }
+    value       = negative ? -result : result;
+    mPosition   = position;
+    mAfterValue = true;
+    return true;
+  }
+
+  bool ReadNumber(float& value)
+  {
+    double number;
+    if(!ReadNumber(number))
+    {
+      return false;
+    }
+    value = float(number);
+    return true;
+  }
+
+  /**
+   * Reads a number which must be a non-negative integer fitting in 32 bits, e.g. an index.
+   */
+  bool ReadNumber(uint32_t& value)
+  {
+    double number;
+    if(!ReadNumber(number))
+    {
+      return false;
+    }
+    if(!(number >= 0.0 && number <= 4294967295.0) || number != std::floor(number))
+    {
+      return Fail("expected an unsigned integer");
+    }
+    value = uint32_t(number);
+    return true;
+  }
+
+  /**
+   * Reads a string as written in the buffer, without decoding its escapes. Enough to compare
+   * with ASCII names or to read paths, and allocation free.
+   */
+  bool ReadString(std::string_view& value)
+  {
+    if(!SkipWhitespace() || *mPosition != '"')
+    {
+      return Fail("expected a string");
+    }
+    return ScanString(value, nullptr);
+  }
+
+  /**
+   * Reads a string and decodes its escapes, including \\u escapes which are written as UTF-8.
+   */
+  bool ReadString(std::string& value)
+  {
+    if(!SkipWhitespace() || *mPosition != '"')
+    {
+      return Fail("expected a string");
+    }
+
+    std::string_view raw;
+    bool             escaped(false);
+    if(!ScanString(raw, &escaped))
+    {
+      return false;
+    }
+    if(!escaped)
+    {
+      value.assign(raw.data(), raw.size());
+      return true;
+    }
+    return Unescape(raw, value);
+  }
+
+  bool ReadBool(bool& value)
+  {
+    if(MatchLiteral("true"))
+    {
+      value = true;
+      return true;
+    }
+    if(MatchLiteral("false"))
+    {
+      value = false;
+      return true;
+    }
+    return Fail("expected a boolean");
+  }
+
+  bool ReadNull()
+  {
+    return MatchLiteral("null") || Fail("expected null");
+  }
+
+  /**
+   * Skips the next value, checking its syntax.
+   */
+  bool Skip()
+  {
+    switch(Peek())
+    {
+      case Type::OBJECT:
+      {
+        std::string_view key;
+        if(!BeginObject())
+        {
+          return false;
+        }
+        while(NextMember(key))
+        {
+          if(!Skip())
+          {
+            return false;
+          }
+        }
+        return !HasError();
+      }
+      case Type::ARRAY:
+      {
+        if(!BeginArray())
+        {
+          return false;
+        }
+        while(NextElement())
+        {
+          if(!Skip())
+          {
+            return false;
+          }
+        }
+        return !HasError();
+      }
+      case Type::STRING:
+      {
+        std::string_view value;
+        return ReadString(value);
+      }
+      case Type::NUMBER:
+      {
+        double value;
+        return ReadNumber(value);
+      }
+      case Type::BOOLEAN:
+      {
+        bool value;
+        return ReadBool(value);
+      }
+      case Type::NULL_VALUE:
+      {
+        return ReadNull();
+      }
+      default:
+      {
+        return Fail("expected a value");
+      }
+    }
+  }
+
+  /**
+   * Checks that only whitespace follows the document.
+   * @return false if the document is incomplete, followed by other text or an error occurred
+   */
+  bool Finish()
+  {
+    if(HasError())
+    {
+      return false;
+    }
+    if(mDepth != 0u)
+    {
+      return Fail("unexpected end of the document");
+    }
+    return !SkipWhitespace() || Fail("unexpected text after the document");
+  }
+
+  /**
+   * @return The offset in the buffer of the next character to read, e.g. the start of the next
+   * value after Peek(), or the end of the value after reading or skipping it
+   */
+  size_t GetOffset() const
+  {
+    return size_t(mPosition - mBegin);
+  }
+
+  bool HasError() const
+  {
+    return mError != nullptr;
+  }
+
+  /**
+   * @return A description of the first error, or nullptr
+   */
+  const char* GetError() const
+  {
+    return mError;
+  }
+
+  /**
+   * @return The offset in the buffer of the first error
+   */
+  size_t GetErrorOffset() const
+  {
+    return mErrorOffset;
+  }
+
+private:
+  static bool IsDigit(char c)
+  {
+    return c >= '0' && c <= '9';
+  }
+
+  static void AccumulateDigit(char c, uint64_t& mantissa, int& digits, int& exponent, bool fraction)
+  {
+    if(digits < 19)
+    {
+      mantissa = mantissa * 10u + uint64_t(c - '0');
+      if(mantissa != 0u)
+      {
+        ++digits; // Leading zeros of a fraction aren't significant
+      }
+      exponent -= fraction ? 1 : 0;
+    }
+    else
+    {
+      exponent += fraction ? 0 : 1;
+    }
+  }
+
+  static double ScaleByPowerOfTen(double value, int exponent)
+  {
+    // Powers of ten which are exact doubles
+    static constexpr double POWERS[] = {1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11, 1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22};
+    static constexpr int    MAX_EXACT = 22;
+
+    if(exponent < 0)
+    {
+      for(; exponent < -MAX_EXACT; exponent += MAX_EXACT)
+      {
+        value /= POWERS[MAX_EXACT];
+      }
+      return value / POWERS[-exponent];
+    }
+    for(; exponent > MAX_EXACT; exponent -= MAX_EXACT)
+    {
+      value *= POWERS[MAX_EXACT];
+    }
+    return value * POWERS[exponent];
+  }
+
+  bool Fail(const char* error)
+  {
+    if(!mError)
+    {
+      mError       = error;
+      mErrorOffset = size_t(mPosition - mBegin);
+      mPosition    = mEnd;
+    }
+    return false;
+  }
+
+  /**
+   * @return false at the end of the buffer
+   */
+  bool SkipWhitespace()
+  {
+    while(mPosition != mEnd && (*mPosition == ' ' || *mPosition == '\n' || *mPosition == '\r' || *mPosition == '\t'))
+    {
+      ++mPosition;
+    }
+    return mPosition != mEnd;
+  }
+
+  bool Open(char bracket, const char* error)
+  {
+    if(!SkipWhitespace() || *mPosition != bracket)
+    {
+      return Fail(error);
+    }
+    if(++mDepth > MAX_DEPTH)
+    {
+      return Fail("too deeply nested");
+    }
+    ++mPosition;
+    mAfterValue = false;
+    return true;
+  }
+
+  /**
+   * Consumes the separator before the next member or element, or the closing bracket.
+   */
+  bool NextItem(char closingBracket)
+  {
+    if(!SkipWhitespace())
+    {
+      return Fail("unexpected end of the document");
+    }
+    if(*mPosition == closingBracket)
+    {
+      ++mPosition;
+      --mDepth;
+      mAfterValue = true;
+      return false;
+    }
+    if(mAfterValue)
+    {
+      if(*mPosition != ',')
+      {
+        return Fail(closingBracket == '}' ? "expected ',' or '}'" : "expected ',' or ']'");
+      }
+      ++mPosition;
+      if(!SkipWhitespace() || *mPosition == closingBracket)
+      {
+        return Fail("expected a value after ','");
+      }
+    }
+    mAfterValue = false;
+    return true;
+  }
+
+  /**
+   * Finds the end of the string at the current position, which must be its opening quote.
+   * The escapes are checked but not decoded.
+   */
+  bool ScanString(std::string_view& value, bool* escaped)
+  {
+    const char* start = ++mPosition;
+    for(const char* position = start; position != mEnd; ++position)
+    {
+      const char c = *position;
+      if(c == '"')
+      {
+        value       = std::string_view(start, size_t(position - start));
+        mPosition   = position + 1;
+        mAfterValue = true;
+        return true;
+      }
+      if(c == '\\')
+      {
+        if(escaped)
+        {
+          *escaped = true;
+        }
+        if(++position == mEnd)
+        {
+          break;
+        }
+        if(*position == 'u')
+        {
+          uint32_t codeUnit;
+          if(!ReadHex4(std::string_view(position + 1, size_t(mEnd - position - 1)), 0u, codeUnit))
+          {
+            mPosition = position - 1;
+            return Fail("invalid \\u escape");
+          }
+          position += 4;
+        }
+        else if(std::string_view("\"\\/bfnrt").find(*position) == std::string_view::npos)
+        {
+          mPosition = position - 1;
+          return Fail("invalid escape");
+        }
+      }
+      else if(uint8_t(c) < 0x20u)
+      {
+        mPosition = position;
+        return Fail("control character in a string");
+      }
+    }
+    return Fail("unterminated string");
+  }
+
+  static int HexValue(char c)
+  {
+    if(c >= '0' && c <= '9')
+    {
+      return c - '0';
+    }
+    if(c >= 'a' && c <= 'f')
+    {
+      return c - 'a' + 10;
+    }
+    if(c >= 'A' && c <= 'F')
+    {
+      return c - 'A' + 10;
+    }
+    return -1;
+  }
+
+  static bool ReadHex4(std::string_view raw, size_t position, uint32_t& codeUnit)
+  {
+    if(position + 4u > raw.size())
+    {
+      return false;
+    }
+    codeUnit = 0u;
+    for(size_t i = position; i < position + 4u; ++i)
+    {
+      const int digit = HexValue(raw[i]);
+      if(digit < 0)
+      {
+        return false;
+      }
+      codeUnit = (codeUnit << 4) | uint32_t(digit);
+    }
+    return true;
+  }
+
+  static void AppendUtf8(uint32_t codePoint, std::string& value)
+  {
+    if(codePoint < 0x80u)
+    {
+      value += char(codePoint);
+    }
+    else if(codePoint < 0x800u)
+    {
+      value += char(0xC0u | (codePoint >> 6));
+      value += char(0x80u | (codePoint & 0x3Fu));
+    }
+    else if(codePoint < 0x10000u)
+    {
+      value += char(0xE0u | (codePoint >> 12));
+      value += char(0x80u | ((codePoint >> 6) & 0x3Fu));
+      value += char(0x80u | (codePoint & 0x3Fu));
+    }
+    else
+    {
+      value += char(0xF0u | (codePoint >> 18));
+      value += char(0x80u | ((codePoint >> 12) & 0x3Fu));
+      value += char(0x80u | ((codePoint >> 6) & 0x3Fu));
+      value += char(0x80u | (codePoint & 0x3Fu));
+    }
+  }
+
+  bool Unescape(std::string_view raw, std::string& value)
+  {
+    value.clear();
+    value.reserve(raw.size());
+    for(size_t i = 0u; i < raw.size(); ++i)
+    {
+      if(raw[i] != '\\')
+      {
+        value += raw[i];
+        continue;
+      }
+
+      switch(raw[++i])
+      {
+        case '"':
+        case '\\':
+        case '/':
+          value += raw[i];
+          break;
+        case 'b':
+          value += '\b';
+          break;
+        case 'f':
+          value += '\f';
+          break;
+        case 'n':
+          value += '\n';
+          break;
+        case 'r':
+          value += '\r';
+          break;
+        case 't':
+          value += '\t';
+          break;
+        case 'u':
+        {
+          uint32_t codePoint;
+          if(!ReadHex4(raw, i + 1u, codePoint))
+          {
+            return Fail("invalid \\u escape");
+          }
+          i += 4u;
+
+          // Combine a surrogate pair, a lone surrogate is kept as is
+          uint32_t low;
+          if(codePoint >= 0xD800u && codePoint < 0xDC00u && i + 2u < raw.size() && raw[i + 1u] == '\\' && raw[i + 2u] == 'u' &&
+             ReadHex4(raw, i + 3u, low) && low >= 0xDC00u && low < 0xE000u)
+          {
+            codePoint = 0x10000u + ((codePoint - 0xD800u) << 10) + (low - 0xDC00u);
+            i += 6u;
+          }
+          AppendUtf8(codePoint, value);
+          break;
+        }
+        default:
+          return Fail("invalid escape");
+      }
+    }
+    return true;
+  }
+
+  bool MatchLiteral(std::string_view literal)
+  {
+    if(SkipWhitespace() && size_t(mEnd - mPosition) >= literal.size() && std::string_view(mPosition, literal.size()) == literal)
+    {
+      mPosition += literal.size();
+      mAfterValue = true;
+      return true;
+    }
+    return false;
+  }
+
+private:
+  const char*  mBegin;
+  const char*  mPosition;
+  const char*  mEnd;
+  const char*  mError{nullptr};
+  size_t       mErrorOffset{0u};
+  unsigned int mDepth{0u};
+  bool         mAfterValue{false}; ///< Whether a value was read since the last '{', '[' or key, so a ',' is expected
+};
+
+} // namespace DemoHelper
+
+#endif // DALI_DEMO_JSON_READER_H
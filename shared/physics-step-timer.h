@@ -0,0 +1,161 @@
+#ifndef DALI_DEMO_PHYSICS_STEP_TIMER_H
+#define DALI_DEMO_PHYSICS_STEP_TIMER_H
+
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <dali/devel-api/common/stage-devel.h>
+#include <dali/devel-api/update/frame-callback-interface.h>
+#include <dali/public-api/actors/actor.h>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+
+namespace DemoHelper
+{
+/**
+ * Measures the time the physics adaptor spends on the update thread per frame.
+ *
+ * Frame callbacks are called in the order they were added, so the start callback is added
+ * before the PhysicsAdaptor is created and the end callback after; the time between them
+ * covers the step of the world and the sync of the actors. Engines reporting their substeps
+ * can also time the step alone with StartStep() and EndStep().
+ */
+class PhysicsStepTimer
+{
+public:
+  /**
+   * Counters accumulated since the previous reset, in microseconds
+   */
+  struct Sample
+  {
+    uint32_t frames{0u};
+    uint64_t totalUs{0u}; ///< Time between the start and the end callbacks
+    uint64_t maxUs{0u};   ///< Longest of those times
+    uint64_t stepUs{0u};  ///< Time between StartStep() and EndStep()
+  };
+
+  /**
+   * Adds the callback starting the measure of a frame, must be called before the PhysicsAdaptor is created.
+   * @param[in] rootActor The root actor of the frame callback
+   */
+  void AddStartCallback(Dali::Actor rootActor)
+  {
+    Dali::DevelStage::AddFrameCallback(Dali::Stage::GetCurrent(), mStartCallback, rootActor);
+  }
+
+  /**
+   * Adds the callback ending the measure of a frame, must be called after the PhysicsAdaptor is created.
+   * @param[in] rootActor The root actor of the frame callback
+   */
+  void AddEndCallback(Dali::Actor rootActor)
+  {
+    Dali::DevelStage::AddFrameCallback(Dali::Stage::GetCurrent(), mEndCallback, rootActor);
+  }
+
+  /**
+   * Removes both frame callbacks.
+   */
+  void RemoveCallbacks()
+  {
+    Dali::DevelStage::RemoveFrameCallback(Dali::Stage::GetCurrent(), mStartCallback);
+    Dali::DevelStage::RemoveFrameCallback(Dali::Stage::GetCurrent(), mEndCallback);
+  }
+
+  /**
+   * @return The counters since the previous reset, which are restarted
+   */
+  Sample Reset()
+  {
+    Sample sample;
+    sample.frames  = mFrames.exchange(0u);
+    sample.totalUs = mTotalUs.exchange(0u);
+    sample.maxUs   = mMaxUs.exchange(0u);
+    sample.stepUs  = mStepUs.exchange(0u);
+    return sample;
+  }
+
+  /**
+   * Starts timing a step of the world, called on the update thread.
+   */
+  void StartStep()
+  {
+    mStepStart = std::chrono::steady_clock::now();
+  }
+
+  /**
+   * Ends timing a step of the world, called on the update thread.
+   */
+  void EndStep()
+  {
+    mStepUs += std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - mStepStart).count();
+  }
+
+private:
+  class Start : public Dali::FrameCallbackInterface
+  {
+  public:
+    Start(PhysicsStepTimer& timer)
+    : mTimer(timer)
+    {
+    }
+
+  private:
+    virtual bool Update(Dali::UpdateProxy& updateProxy, float elapsedSeconds)
+    {
+      mTimer.mFrameStart = std::chrono::steady_clock::now();
+      return true;
+    }
+
+    PhysicsStepTimer& mTimer;
+  };
+
+  class End : public Dali::FrameCallbackInterface
+  {
+  public:
+    End(PhysicsStepTimer& timer)
+    : mTimer(timer)
+    {
+    }
+
+  private:
+    virtual bool Update(Dali::UpdateProxy& updateProxy, float elapsedSeconds)
+    {
+      const uint64_t frameUs = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - mTimer.mFrameStart).count();
+      mTimer.mTotalUs += frameUs;
+      mTimer.mMaxUs = std::max<uint64_t>(mTimer.mMaxUs, frameUs);
+      ++mTimer.mFrames;
+      return true;
+    }
+
+    PhysicsStepTimer& mTimer;
+  };
+
+  Start                                 mStartCallback{*this};
+  End                                   mEndCallback{*this};
+  std::chrono::steady_clock::time_point mFrameStart; ///< Update thread only
+  std::chrono::steady_clock::time_point mStepStart;  ///< Update thread only
+  std::atomic<uint32_t>                 mFrames{0u};
+  std::atomic<uint64_t>                 mTotalUs{0u};
+  std::atomic<uint64_t>                 mMaxUs{0u};
+  std::atomic<uint64_t>                 mStepUs{0u};
+};
+
+} // namespace DemoHelper
+
+#endif // DALI_DEMO_PHYSICS_STEP_TIMER_H
@@ -0,0 +1,379 @@
+#ifndef DALI_DEMO_SIMD_MATRIX_H
+#define DALI_DEMO_SIMD_MATRIX_H
+
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <cmath>
+#include <cstddef>
+
+// Define DEMO_MATRIX_NO_SIMD to force the scalar implementation.
+#if !defined(DEMO_MATRIX_NO_SIMD)
+#if defined(__SSE__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 1)
+#define DEMO_MATRIX_SSE 1
+#include <xmmintrin.h>
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+#define DEMO_MATRIX_NEON 1
+#include <arm_neon.h>
+#endif
+#endif
+
+/**
+ * Column-major 4x4 matrices for examples issuing GL calls directly, laid out as expected by
+ * glUniformMatrix4fv() with transpose set to GL_FALSE.
+ *
+ * Operations are written once against a 4-wide vector abstraction, which is implemented
+ * with SSE, NEON or plain floats. Matrix4Ops uses the best one available for the target,
+ * Matrix4ScalarOps always uses plain floats.
+ *
+ * Translate(), Scale() and RotateX/Y/Z() pre-multiply the matrix in place, i.e. m = T * m,
+ * touching only the lanes the transformation changes rather than doing a full product.
+ */
+namespace DemoHelper
+{
+struct alignas(16) Matrix4
+{
+  float m[16];
+};
+
+namespace Detail
+{
+/**
+ * Plain float implementation of the vector operations
+ */
+struct ScalarVec4
+{
+  struct Type
+  {
+    float v[4];
+  };
+
+  static Type Load(const float* p)
+  {
+    return Type{{p[0], p[1], p[2], p[3]}};
+  }
+
+  static void Store(float* p, const Type& a)
+  {
+    p[0] = a.v[0];
+    p[1] = a.v[1];
+    p[2] = a.v[2];
+    p[3] = a.v[3];
+  }
+
+  static Type Set(float x, float y, float z, float w)
+  {
+    return Type{{x, y, z, w}};
+  }
+
+  template<int I>
+  static Type Splat(const Type& a)
+  {
+    return Type{{a.v[I], a.v[I], a.v[I], a.v[I]}};
+  }
+
+  static Type Add(const Type& a, const Type& b)
+  {
+    return Type{{a.v[0] + b.v[0], a.v[1] + b.v[1], a.v[2] + b.v[2], a.v[3] + b.v[3]}};
+  }
+
+  static Type Mul(const Type& a, const Type& b)
+  {
+    return Type{{a.v[0] * b.v[0], a.v[1] * b.v[1], a.v[2] * b.v[2], a.v[3] * b.v[3]}};
+  }
+
+  /// Returns a * b + c
+  static Type MulAdd(const Type& a, const Type& b, const Type& c)
+  {
+    return Type{{a.v[0] * b.v[0] + c.v[0], a.v[1] * b.v[1] + c.v[1], a.v[2] * b.v[2] + c.v[2], a.v[3] * b.v[3] + c.v[3]}};
+  }
+};
+
+#if defined(DEMO_MATRIX_SSE)
+/**
+ * SSE implementation of the vector operations, data must be 16 byte aligned
+ */
+struct SimdVec4
+{
+  using Type = __m128;
+
+  static Type Load(const float* p)
+  {
+    return _mm_load_ps(p);
+  }
+
+  static void Store(float* p, Type a)
+  {
+    _mm_store_ps(p, a);
+  }
+
+  static Type Set(float x, float y, float z, float w)
+  {
+    return _mm_setr_ps(x, y, z, w);
+  }
+
+  template<int I>
+  static Type Splat(Type a)
+  {
+    return _mm_shuffle_ps(a, a, _MM_SHUFFLE(I, I, I, I));
+  }
+
+  static Type Add(Type a, Type b)
+  {
+    return _mm_add_ps(a, b);
+  }
+
+  static Type Mul(Type a, Type b)
+  {
+    return _mm_mul_ps(a, b);
+  }
+
+  static Type MulAdd(Type a, Type b, Type c)
+  {
+    return _mm_add_ps(_mm_mul_ps(a, b), c);
+  }
+};
+#elif defined(DEMO_MATRIX_NEON)
+/**
+ * NEON implementation of the vector operations
+ */
+struct SimdVec4
+{
+  using Type = float32x4_t;
+
+  static Type Load(const float* p)
+  {
+    return vld1q_f32(p);
+  }
+
+  static void Store(float* p, Type a)
+  {
+    vst1q_f32(p, a);
+  }
+
+  static Type Set(float x, float y, float z, float w)
+  {
+    const float values[4] = {x, y, z, w};
+    return vld1q_f32(values);
+  }
+
+  template<int I>
+  static Type Splat(Type a)
+  {
+    return vdupq_n_f32(vgetq_lane_f32(a, I));
+  }
+
+  static Type Add(Type a, Type b)
+  {
+    return vaddq_f32(a, b);
+  }
+
+  static Type Mul(Type a, Type b)
+  {
+    return vmulq_f32(a, b);
+  }
+
+  static Type MulAdd(Type a, Type b, Type c)
+  {
+    return vmlaq_f32(c, a, b);
+  }
+};
+#else
+using SimdVec4 = ScalarVec4;
+#endif
+
+/**
+ * Matrix operations implemented with the vector operations V
+ */
+template<typename V>
+struct Matrix4Ops
+{
+  using Vec = typename V::Type;
+
+  static void Identity(Matrix4& out)
+  {
+    V::Store(out.m, V::Set(1.0f, 0.0f, 0.0f, 0.0f));
+    V::Store(out.m + 4, V::Set(0.0f, 1.0f, 0.0f, 0.0f));
+    V::Store(out.m + 8, V::Set(0.0f, 0.0f, 1.0f, 0.0f));
+    V::Store(out.m + 12, V::Set(0.0f, 0.0f, 0.0f, 1.0f));
+  }
+
+  /**
+   * out = a * b, out may alias either operand
+   */
+  static void Multiply(Matrix4& out, const Matrix4& a, const Matrix4& b)
+  {
+    const Vec a0 = V::Load(a.m), a1 = V::Load(a.m + 4), a2 = V::Load(a.m + 8), a3 = V::Load(a.m + 12);
+    for(int i = 0; i < 16; i += 4)
+    {
+      const Vec col = V::Load(b.m + i);
+      V::Store(out.m + i, V::MulAdd(a3, V::template Splat<3>(col), V::MulAdd(a2, V::template Splat<2>(col), V::MulAdd(a1, V::template Splat<1>(col), V::Mul(a0, V::template Splat<0>(col))))));
+    }
+  }
+
+  /**
+   * out = a * b where both have the last row of ( 0, 0, 0, 1 ), out may alias either operand
+   */
+  static void MultiplyAffine(Matrix4& out, const Matrix4& a, const Matrix4& b)
+  {
+    const Vec a0 = V::Load(a.m), a1 = V::Load(a.m + 4), a2 = V::Load(a.m + 8), a3 = V::Load(a.m + 12);
+    for(int i = 0; i < 16; i += 4)
+    {
+      const Vec col = V::Load(b.m + i);
+      const Vec xyz = V::MulAdd(a2, V::template Splat<2>(col), V::MulAdd(a1, V::template Splat<1>(col), V::Mul(a0, V::template Splat<0>(col))));
+      V::Store(out.m + i, i < 12 ? xyz : V::Add(xyz, a3));
+    }
+  }
+
+  /**
+   * out[i] = a * b[i] for count matrices, a is kept in registers
+   */
+  static void Multiply(Matrix4* out, const Matrix4& a, const Matrix4* b, size_t count)
+  {
+    const Vec a0 = V::Load(a.m), a1 = V::Load(a.m + 4), a2 = V::Load(a.m + 8), a3 = V::Load(a.m + 12);
+    for(size_t n = 0; n < count; ++n)
+    {
+      for(int i = 0; i < 16; i += 4)
+      {
+        const Vec col = V::Load(b[n].m + i);
+        V::Store(out[n].m + i, V::MulAdd(a3, V::template Splat<3>(col), V::MulAdd(a2, V::template Splat<2>(col), V::MulAdd(a1, V::template Splat<1>(col), V::Mul(a0, V::template Splat<0>(col))))));
+      }
+    }
+  }
+
+  /**
+   * out[i] = Translation( positions[i] ) * m for count matrices, positions hold x, y, z triples
+   */
+  static void TranslateBatch(Matrix4* out, const Matrix4& m, const float* positions, size_t count)
+  {
+    const Vec c0 = V::Load(m.m), c1 = V::Load(m.m + 4), c2 = V::Load(m.m + 8), c3 = V::Load(m.m + 12);
+    const Vec w0 = V::template Splat<3>(c0), w1 = V::template Splat<3>(c1), w2 = V::template Splat<3>(c2), w3 = V::template Splat<3>(c3);
+    for(size_t n = 0; n < count; ++n, positions += 3)
+    {
+      const Vec t = V::Set(positions[0], positions[1], positions[2], 0.0f);
+      V::Store(out[n].m, V::MulAdd(t, w0, c0));
+      V::Store(out[n].m + 4, V::MulAdd(t, w1, c1));
+      V::Store(out[n].m + 8, V::MulAdd(t, w2, c2));
+      V::Store(out[n].m + 12, V::MulAdd(t, w3, c3));
+    }
+  }
+
+  /**
+   * m = Translation( x, y, z ) * m
+   */
+  static void Translate(Matrix4& m, float x, float y, float z)
+  {
+    const Vec t = V::Set(x, y, z, 0.0f);
+    for(int i = 0; i < 16; i += 4)
+    {
+      const Vec col = V::Load(m.m + i);
+      V::Store(m.m + i, V::MulAdd(t, V::template Splat<3>(col), col));
+    }
+  }
+
+  /**
+   * m = Scale( x, y, z ) * m
+   */
+  static void Scale(Matrix4& m, float x, float y, float z)
+  {
+    const Vec s = V::Set(x, y, z, 1.0f);
+    for(int i = 0; i < 16; i += 4)
+    {
+      V::Store(m.m + i, V::Mul(V::Load(m.m + i), s));
+    }
+  }
+
+  /**
+   * m = RotationX( degrees ) * m
+   */
+  static void RotateX(Matrix4& m, float degrees)
+  {
+    const float c = std::cos(degrees * float(M_PI) / 180.0f);
+    const float s = std::sin(degrees * float(M_PI) / 180.0f);
+    const Vec   diagonal(V::Set(1.0f, c, c, 1.0f)), fromY(V::Set(0.0f, 0.0f, s, 0.0f)), fromZ(V::Set(0.0f, -s, 0.0f, 0.0f));
+    for(int i = 0; i < 16; i += 4)
+    {
+      const Vec col = V::Load(m.m + i);
+      V::Store(m.m + i, V::MulAdd(V::template Splat<2>(col), fromZ, V::MulAdd(V::template Splat<1>(col), fromY, V::Mul(col, diagonal))));
+    }
+  }
+
+  /**
+   * m = RotationY( degrees ) * m
+   */
+  static void RotateY(Matrix4& m, float degrees)
+  {
+    const float c = std::cos(degrees * float(M_PI) / 180.0f);
+    const float s = std::sin(degrees * float(M_PI) / 180.0f);
+    const Vec   diagonal(V::Set(c, 1.0f, c, 1.0f)), fromX(V::Set(0.0f, 0.0f, -s, 0.0f)), fromZ(V::Set(s, 0.0f, 0.0f, 0.0f));
+    for(int i = 0; i < 16; i += 4)
+    {
+      const Vec col = V::Load(m.m + i);
+      V::Store(m.m + i, V::MulAdd(V::template Splat<2>(col), fromZ, V::MulAdd(V::template Splat<0>(col), fromX, V::Mul(col, diagonal))));
+    }
+  }
+
+  /**
+   * m = RotationZ( degrees ) * m
+   */
+  static void RotateZ(Matrix4& m, float degrees)
+  {
+    const float c = std::cos(degrees * float(M_PI) / 180.0f);
+    const float s = std::sin(degrees * float(M_PI) / 180.0f);
+    const Vec   diagonal(V::Set(c, c, 1.0f, 1.0f)), fromX(V::Set(0.0f, s, 0.0f, 0.0f)), fromY(V::Set(-s, 0.0f, 0.0f, 0.0f));
+    for(int i = 0; i < 16; i += 4)
+    {
+      const Vec col = V::Load(m.m + i);
+      V::Store(m.m + i, V::MulAdd(V::template Splat<1>(col), fromY, V::MulAdd(V::template Splat<0>(col), fromX, V::Mul(col, diagonal))));
+    }
+  }
+
+  /**
+   * Sets perspective projection, fieldOfView is vertical and in degrees
+   */
+  static void Perspective(Matrix4& out, float fieldOfView, float aspectRatio, float zNear, float zFar)
+  {
+    const float yMax = zNear * std::tan(fieldOfView * float(M_PI) / 360.0f);
+    const float xMax = yMax * aspectRatio;
+    const float zDistance = zFar - zNear;
+    V::Store(out.m, V::Set(zNear / xMax, 0.0f, 0.0f, 0.0f));
+    V::Store(out.m + 4, V::Set(0.0f, zNear / yMax, 0.0f, 0.0f));
+    V::Store(out.m + 8, V::Set(0.0f, 0.0f, (-zFar - zNear) / zDistance, -1.0f));
+    V::Store(out.m + 12, V::Set(0.0f, 0.0f, (-2.0f * zNear * zFar) / zDistance, 0.0f));
+  }
+};
+} // namespace Detail
+
+/// Matrix operations using SIMD instructions when available for the target
+using Matrix4Ops = Detail::Matrix4Ops<Detail::SimdVec4>;
+
+/// Matrix operations always using plain floats
+using Matrix4ScalarOps = Detail::Matrix4Ops<Detail::ScalarVec4>;
+
+/// Returns true if Matrix4Ops uses SIMD instructions
+inline constexpr bool IsMatrix4OpsVectorised()
+{
+#if defined(DEMO_MATRIX_SSE) || defined(DEMO_MATRIX_NEON)
+  return true;
+#else
+  return false;
+#endif
+}
+
+} // namespace DemoHelper
+
+#endif // DALI_DEMO_SIMD_MATRIX_H
@@ -23,14 +23,15 @@
 #include <dali/public-api/math/uint-16-pair.h>
 #include <dali/public-api/rendering/geometry.h>
 #include <dali/public-api/rendering/texture.h>
+#include <chrono>
 
 namespace DemoHelper
 {
-Dali::Texture LoadTexture(const char*              imagePath,
-                          Dali::ImageDimensions    size                  = Dali::ImageDimensions(),
-                          Dali::FittingMode::Type  fittingMode           = Dali::FittingMode::DEFAULT,
-                          Dali::SamplingMode::Type samplingMode          = Dali::SamplingMode::DEFAULT,
-                          bool                     orientationCorrection = true)
+inline Dali::Texture LoadTexture(const char*              imagePath,
+                                 Dali::ImageDimensions    size                  = Dali::ImageDimensions(),
+                                 Dali::FittingMode::Type  fittingMode           = Dali::FittingMode::DEFAULT,
+                                 Dali::SamplingMode::Type samplingMode          = Dali::SamplingMode::DEFAULT,
+                                 bool                     orientationCorrection = true)
 {
   Dali::Devel::PixelBuffer pixelBuffer = LoadImageFromFile(imagePath, size, fittingMode, samplingMode, orientationCorrection);
   Dali::Texture            texture     = Dali::Texture::New(Dali::TextureType::TEXTURE_2D,
@@ -44,12 +45,12 @@ Dali::Texture LoadTexture(const char*              imagePath,
   return texture;
 }
 
-Dali::Texture LoadWindowFillingTexture(Dali::Uint16Pair size, const char* imagePath)
+inline Dali::Texture LoadWindowFillingTexture(Dali::Uint16Pair size, const char* imagePath)
 {
   return LoadTexture(imagePath, size, Dali::FittingMode::SCALE_TO_FILL, Dali::SamplingMode::BOX_THEN_LINEAR);
 }
 
-Dali::Geometry CreateTexturedQuad()
+inline Dali::Geometry CreateTexturedQuad()
 {
   struct Vertex
   {
@@ -78,6 +79,14 @@ Dali::Geometry CreateTexturedQuad()
 
   return geometry;
 }
+
+/**
+ * @return The time elapsed since start, in milliseconds
+ */
+inline float MillisecondsSince(std::chrono::steady_clock::time_point start)
+{
+  return std::chrono::duration<float, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
 } // namespace DemoHelper
 
 #endif // DALI_DEMO_UTILITY_H